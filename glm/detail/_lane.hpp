@@ -0,0 +1,546 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref core
+/// @file glm/detail/_lane.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "setup.hpp"
+#include "type_int.hpp"
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Lanes of the batch functions: a SIMD register used like a scalar, each lane
+	// processing a different element. Kernels written for T work on lane<T>::type,
+	// the functions used by unqualified calls are found by argument dependent lookup.
+	// Comparisons return masks which are used with select.
+	template <typename T>
+	GLM_FUNC_QUALIFIER T select(bool Mask, T const & a, T const & b)
+	{
+		return Mask ? a : b;
+	}
+
+	// floor of scalars without a library call, valid for |x| < 2^31 like the lanes floor
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_floor(L const & x)
+	{
+		return floor(x);
+	}
+
+	GLM_FUNC_QUALIFIER float fast_floor(float x)
+	{
+		float const Trunc = static_cast<float>(static_cast<int>(x));
+		return Trunc > x ? Trunc - 1.0f : Trunc;
+	}
+
+	GLM_FUNC_QUALIFIER double fast_floor(double x)
+	{
+		double const Trunc = static_cast<double>(static_cast<int>(x));
+		return Trunc > x ? Trunc - 1.0 : Trunc;
+	}
+
+	// 2^n built in the exponent bits, n must be an integer of the range of normal numbers
+	GLM_FUNC_QUALIFIER float pow2i(float n)
+	{
+		uint32 const Bits = static_cast<uint32>(static_cast<int32>(n) + 127) << 23;
+		float Result;
+		std::memcpy(&Result, &Bits, sizeof(Result));
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER double pow2i(double n)
+	{
+		uint64 const Bits = static_cast<uint64>(static_cast<int32>(n) + 1023) << 52;
+		double Result;
+		std::memcpy(&Result, &Bits, sizeof(Result));
+		return Result;
+	}
+
+	// Estimate of 1 / sqrt(x), the relative error is lower than 1.5 * 2^-12 with SSE
+	// and lower than 1.8e-3 with the bit trick refined by one Newton-Raphson step
+	GLM_FUNC_QUALIFIER float rsqrt(float x)
+	{
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+		return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#	else
+		uint32 Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		Bits = 0x5f375a86 - (Bits >> 1);
+		float Estimate;
+		std::memcpy(&Estimate, &Bits, sizeof(Estimate));
+		return Estimate * (1.5f - 0.5f * x * Estimate * Estimate);
+#	endif
+	}
+
+	// Split a positive normal x in m * 2^Exponent with m in [1, 2) and return m
+	GLM_FUNC_QUALIFIER float split_exponent(float x, float & Exponent)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		Exponent = static_cast<float>(static_cast<int32>(Bits >> 23) - 127);
+		Bits = (Bits & 0x007fffff) | 0x3f800000;
+		std::memcpy(&x, &Bits, sizeof(x));
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER double split_exponent(double x, double & Exponent)
+	{
+		uint64 Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		Exponent = static_cast<double>(static_cast<int32>(Bits >> 52) - 1023);
+		Bits = (Bits & 0x000fffffffffffffull) | 0x3ff0000000000000ull;
+		std::memcpy(&x, &Bits, sizeof(x));
+		return x;
+	}
+
+	// The float estimate, normal doubles out of the float range are scaled by an
+	// even power of two first
+	GLM_FUNC_QUALIFIER double rsqrt(double x)
+	{
+		if((x < static_cast<double>(std::numeric_limits<float>::min()) || x > static_cast<double>(std::numeric_limits<float>::max()))
+			&& x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max())
+		{
+			double Exponent;
+			double const Mantissa = split_exponent(x, Exponent);
+			double const Half = fast_floor(Exponent * 0.5);
+			return static_cast<double>(rsqrt(static_cast<float>(Mantissa * pow2i(Exponent - 2.0 * Half)))) * pow2i(-Half);
+		}
+		return static_cast<double>(rsqrt(static_cast<float>(x)));
+	}
+
+	template <typename T>
+	struct lane
+	{
+		typedef T type;
+
+		static std::size_t const size = 1;
+
+		GLM_FUNC_QUALIFIER static type load(T const * Base, std::size_t)
+		{
+			return *Base;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T * Out, type const & Value)
+		{
+			*Out = Value;
+		}
+
+		GLM_FUNC_QUALIFIER static type index()
+		{
+			return T(0);
+		}
+
+		// Bit i is set when lane i of the comparison result Mask is true
+		GLM_FUNC_QUALIFIER static int movemask(type const & Mask)
+		{
+			return Mask != T(0) ? 1 : 0;
+		}
+
+		// Load the Components components of size elements, Stride values apart, one lane per element
+		template <length_t Components>
+		GLM_FUNC_QUALIFIER static void load_soa(T const * Base, std::size_t, type Out[Components])
+		{
+			for(length_t i = 0; i < Components; ++i)
+				Out[i] = Base[i];
+		}
+
+		template <length_t Components>
+		GLM_FUNC_QUALIFIER static void store_soa(T * Base, std::size_t, type const In[Components])
+		{
+			for(length_t i = 0; i < Components; ++i)
+				Base[i] = In[i];
+		}
+
+		// Load the 4 components at Bases[i] in lane i
+		GLM_FUNC_QUALIFIER static void gather_soa4(T const * const Bases[1], type Out[4])
+		{
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = Bases[0][i];
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	struct lane4_ps
+	{
+		__m128 data;
+
+		GLM_FUNC_QUALIFIER lane4_ps(){}
+		GLM_FUNC_QUALIFIER lane4_ps(__m128 const & v) : data(v){}
+		GLM_FUNC_QUALIFIER lane4_ps(float s) : data(_mm_set1_ps(s)){}
+
+		GLM_FUNC_QUALIFIER friend lane4_ps operator+(lane4_ps const & a, lane4_ps const & b){return _mm_add_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator-(lane4_ps const & a, lane4_ps const & b){return _mm_sub_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator*(lane4_ps const & a, lane4_ps const & b){return _mm_mul_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator/(lane4_ps const & a, lane4_ps const & b){return _mm_div_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator-(lane4_ps const & a){return _mm_xor_ps(a.data, _mm_set1_ps(-0.0f));}
+
+		GLM_FUNC_QUALIFIER friend lane4_ps operator<(lane4_ps const & a, lane4_ps const & b){return _mm_cmplt_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator<=(lane4_ps const & a, lane4_ps const & b){return _mm_cmple_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator>(lane4_ps const & a, lane4_ps const & b){return _mm_cmpgt_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator>=(lane4_ps const & a, lane4_ps const & b){return _mm_cmpge_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator==(lane4_ps const & a, lane4_ps const & b){return _mm_cmpeq_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator&(lane4_ps const & a, lane4_ps const & b){return _mm_and_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps operator|(lane4_ps const & a, lane4_ps const & b){return _mm_or_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps select(lane4_ps const & Mask, lane4_ps const & a, lane4_ps const & b){return _mm_or_ps(_mm_and_ps(Mask.data, a.data), _mm_andnot_ps(Mask.data, b.data));}
+
+		GLM_FUNC_QUALIFIER friend lane4_ps floor(lane4_ps const & x)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE4)
+			return _mm_floor_ps(x.data);
+#		else
+			// Truncation is a floor for positive values, valid for |x| < 2^31
+			__m128 const Trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.data));
+			return _mm_sub_ps(Trunc, _mm_and_ps(_mm_cmpgt_ps(Trunc, x.data), _mm_set1_ps(1.0f)));
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER friend lane4_ps fract(lane4_ps const & x){return x - floor(x);}
+		GLM_FUNC_QUALIFIER friend lane4_ps abs(lane4_ps const & x){return _mm_andnot_ps(_mm_set1_ps(-0.0f), x.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps min(lane4_ps const & a, lane4_ps const & b){return _mm_min_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps max(lane4_ps const & a, lane4_ps const & b){return _mm_max_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps step(lane4_ps const & edge, lane4_ps const & x){return _mm_and_ps(_mm_cmpge_ps(x.data, edge.data), _mm_set1_ps(1.0f));}
+		GLM_FUNC_QUALIFIER friend lane4_ps sqrt(lane4_ps const & x){return _mm_sqrt_ps(x.data);}
+		GLM_FUNC_QUALIFIER friend lane4_ps rsqrt(lane4_ps const & x){return _mm_rsqrt_ps(x.data);}
+
+		GLM_FUNC_QUALIFIER friend lane4_ps pow2i(lane4_ps const & n)
+		{
+			return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(n.data), _mm_set1_epi32(127)), 23));
+		}
+
+		GLM_FUNC_QUALIFIER friend lane4_ps split_exponent(lane4_ps const & x, lane4_ps & Exponent)
+		{
+			__m128i const Bits = _mm_srli_epi32(_mm_castps_si128(x.data), 23);
+			Exponent = _mm_cvtepi32_ps(_mm_sub_epi32(Bits, _mm_set1_epi32(127)));
+			return _mm_or_ps(_mm_and_ps(x.data, _mm_castsi128_ps(_mm_set1_epi32(0x007fffff))), _mm_set1_ps(1.0f));
+		}
+	};
+
+	// Deinterleave 4 xyz points (a = x0y0z0x1, b = y1z1x2y2, c = z2x3y3z3) into x, y and z.
+	GLM_FUNC_QUALIFIER void sse_aos3_to_soa_ps(__m128 a, __m128 b, __m128 c, __m128 & x, __m128 & y, __m128 & z)
+	{
+		x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	// Interleave x, y and z back into 4 xyz points.
+	GLM_FUNC_QUALIFIER void sse_soa_to_aos3_ps(__m128 x, __m128 y, __m128 z, __m128 & a, __m128 & b, __m128 & c)
+	{
+		a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+	struct lane8_ps
+	{
+		__m256 data;
+
+		GLM_FUNC_QUALIFIER lane8_ps(){}
+		GLM_FUNC_QUALIFIER lane8_ps(__m256 const & v) : data(v){}
+		GLM_FUNC_QUALIFIER lane8_ps(float s) : data(_mm256_set1_ps(s)){}
+
+		GLM_FUNC_QUALIFIER friend lane8_ps operator+(lane8_ps const & a, lane8_ps const & b){return _mm256_add_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator-(lane8_ps const & a, lane8_ps const & b){return _mm256_sub_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator*(lane8_ps const & a, lane8_ps const & b){return _mm256_mul_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator/(lane8_ps const & a, lane8_ps const & b){return _mm256_div_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator-(lane8_ps const & a){return _mm256_xor_ps(a.data, _mm256_set1_ps(-0.0f));}
+
+		GLM_FUNC_QUALIFIER friend lane8_ps operator<(lane8_ps const & a, lane8_ps const & b){return _mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator<=(lane8_ps const & a, lane8_ps const & b){return _mm256_cmp_ps(a.data, b.data, _CMP_LE_OQ);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator>(lane8_ps const & a, lane8_ps const & b){return _mm256_cmp_ps(a.data, b.data, _CMP_GT_OQ);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator>=(lane8_ps const & a, lane8_ps const & b){return _mm256_cmp_ps(a.data, b.data, _CMP_GE_OQ);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator==(lane8_ps const & a, lane8_ps const & b){return _mm256_cmp_ps(a.data, b.data, _CMP_EQ_OQ);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator&(lane8_ps const & a, lane8_ps const & b){return _mm256_and_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps operator|(lane8_ps const & a, lane8_ps const & b){return _mm256_or_ps(a.data, b.data);}
+		// Masks are all ones or all zeros, a blend on the sign bit is turned into branches by some compilers
+		GLM_FUNC_QUALIFIER friend lane8_ps select(lane8_ps const & Mask, lane8_ps const & a, lane8_ps const & b){return _mm256_or_ps(_mm256_and_ps(Mask.data, a.data), _mm256_andnot_ps(Mask.data, b.data));}
+
+		GLM_FUNC_QUALIFIER friend lane8_ps floor(lane8_ps const & x){return _mm256_floor_ps(x.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps fract(lane8_ps const & x){return x - floor(x);}
+		GLM_FUNC_QUALIFIER friend lane8_ps abs(lane8_ps const & x){return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps min(lane8_ps const & a, lane8_ps const & b){return _mm256_min_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps max(lane8_ps const & a, lane8_ps const & b){return _mm256_max_ps(a.data, b.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps step(lane8_ps const & edge, lane8_ps const & x){return _mm256_and_ps(_mm256_cmp_ps(x.data, edge.data, _CMP_GE_OQ), _mm256_set1_ps(1.0f));}
+		GLM_FUNC_QUALIFIER friend lane8_ps sqrt(lane8_ps const & x){return _mm256_sqrt_ps(x.data);}
+		GLM_FUNC_QUALIFIER friend lane8_ps rsqrt(lane8_ps const & x){return _mm256_rsqrt_ps(x.data);}
+
+		// Without AVX2, the integer operations are done on the two 128 bits halves
+		GLM_FUNC_QUALIFIER friend lane8_ps pow2i(lane8_ps const & n)
+		{
+			__m256i const Int = _mm256_cvttps_epi32(n.data);
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(Int, _mm256_set1_epi32(127)), 23));
+#		else
+			__m128i const Bias = _mm_set1_epi32(127);
+			__m128i const Lo = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(Int), Bias), 23);
+			__m128i const Hi = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(Int, 1), Bias), 23);
+			return _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(Lo), Hi, 1));
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER friend lane8_ps split_exponent(lane8_ps const & x, lane8_ps & Exponent)
+		{
+			__m256i const Bits = _mm256_castps_si256(x.data);
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			Exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(127)));
+#		else
+			__m128i const Bias = _mm_set1_epi32(127);
+			__m128i const Lo = _mm_sub_epi32(_mm_srli_epi32(_mm256_castsi256_si128(Bits), 23), Bias);
+			__m128i const Hi = _mm_sub_epi32(_mm_srli_epi32(_mm256_extractf128_si256(Bits, 1), 23), Bias);
+			Exponent = _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(Lo), Hi, 1));
+#		endif
+			return _mm256_or_ps(_mm256_and_ps(x.data, _mm256_castsi256_ps(_mm256_set1_epi32(0x007fffff))), _mm256_set1_ps(1.0f));
+		}
+	};
+
+	// Same as sse_aos3_to_soa_ps, each 128 bits lane deinterleaves its own 4 points.
+	GLM_FUNC_QUALIFIER void avx_aos3_to_soa_ps(__m256 a, __m256 b, __m256 c, __m256 & x, __m256 & y, __m256 & z)
+	{
+		x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	GLM_FUNC_QUALIFIER void avx_soa_to_aos3_ps(__m256 x, __m256 y, __m256 z, __m256 & a, __m256 & b, __m256 & c)
+	{
+		a = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		b = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		c = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	// Load two unaligned 128 bits vectors into the low and high lanes of a 256 bits vector.
+	GLM_FUNC_QUALIFIER __m256 avx_loadu2_ps(float const * lo, float const * hi)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+	}
+
+	GLM_FUNC_QUALIFIER void avx_storeu2_ps(float * lo, float * hi, __m256 v)
+	{
+		_mm_storeu_ps(lo, _mm256_castps256_ps128(v));
+		_mm_storeu_ps(hi, _mm256_extractf128_ps(v, 1));
+	}
+
+	// _MM_TRANSPOSE4_PS within each 128 bits lane
+	GLM_FUNC_QUALIFIER void avx_transpose4_ps(__m256 & a, __m256 & b, __m256 & c, __m256 & d)
+	{
+		__m256 const t0 = _mm256_unpacklo_ps(a, b);
+		__m256 const t1 = _mm256_unpacklo_ps(c, d);
+		__m256 const t2 = _mm256_unpackhi_ps(a, b);
+		__m256 const t3 = _mm256_unpackhi_ps(c, d);
+		a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+		b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+		c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	template <>
+	struct lane<float>
+	{
+		typedef lane8_ps type;
+
+		static std::size_t const size = 8;
+
+		GLM_FUNC_QUALIFIER static type load(float const * Base, std::size_t Stride)
+		{
+			return _mm256_setr_ps(
+				Base[0 * Stride], Base[1 * Stride], Base[2 * Stride], Base[3 * Stride],
+				Base[4 * Stride], Base[5 * Stride], Base[6 * Stride], Base[7 * Stride]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float * Out, type const & Value)
+		{
+			_mm256_storeu_ps(Out, Value.data);
+		}
+
+		GLM_FUNC_QUALIFIER static type index()
+		{
+			return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+		}
+
+		GLM_FUNC_QUALIFIER static int movemask(type const & Mask)
+		{
+			return _mm256_movemask_ps(Mask.data);
+		}
+
+		// Only 3 and 4 components are supported, 3 components elements must be contiguous (Stride == 3)
+		template <length_t Components>
+		GLM_FUNC_QUALIFIER static void load_soa(float const * Base, std::size_t Stride, type Out[Components])
+		{
+			if(Components == 3)
+			{
+				__m256 x, y, z;
+				avx_aos3_to_soa_ps(avx_loadu2_ps(Base + 0, Base + 12), avx_loadu2_ps(Base + 4, Base + 16), avx_loadu2_ps(Base + 8, Base + 20), x, y, z);
+				Out[0] = x;
+				Out[1] = y;
+				Out[2] = z;
+			}
+			else
+			{
+				__m256 x = avx_loadu2_ps(Base + 0 * Stride, Base + 4 * Stride);
+				__m256 y = avx_loadu2_ps(Base + 1 * Stride, Base + 5 * Stride);
+				__m256 z = avx_loadu2_ps(Base + 2 * Stride, Base + 6 * Stride);
+				__m256 w = avx_loadu2_ps(Base + 3 * Stride, Base + 7 * Stride);
+				avx_transpose4_ps(x, y, z, w);
+				Out[0] = x;
+				Out[1] = y;
+				Out[2] = z;
+				Out[3] = w;
+			}
+		}
+
+		template <length_t Components>
+		GLM_FUNC_QUALIFIER static void store_soa(float * Base, std::size_t Stride, type const In[Components])
+		{
+			if(Components == 3)
+			{
+				__m256 a, b, c;
+				avx_soa_to_aos3_ps(In[0].data, In[1].data, In[2].data, a, b, c);
+				avx_storeu2_ps(Base + 0, Base + 12, a);
+				avx_storeu2_ps(Base + 4, Base + 16, b);
+				avx_storeu2_ps(Base + 8, Base + 20, c);
+			}
+			else
+			{
+				__m256 x = In[0].data, y = In[1].data, z = In[2].data, w = In[3].data;
+				avx_transpose4_ps(x, y, z, w);
+				avx_storeu2_ps(Base + 0 * Stride, Base + 4 * Stride, x);
+				avx_storeu2_ps(Base + 1 * Stride, Base + 5 * Stride, y);
+				avx_storeu2_ps(Base + 2 * Stride, Base + 6 * Stride, z);
+				avx_storeu2_ps(Base + 3 * Stride, Base + 7 * Stride, w);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void gather_soa4(float const * const Bases[8], type Out[4])
+		{
+			__m256 x = avx_loadu2_ps(Bases[0], Bases[4]);
+			__m256 y = avx_loadu2_ps(Bases[1], Bases[5]);
+			__m256 z = avx_loadu2_ps(Bases[2], Bases[6]);
+			__m256 w = avx_loadu2_ps(Bases[3], Bases[7]);
+			avx_transpose4_ps(x, y, z, w);
+			Out[0] = x;
+			Out[1] = y;
+			Out[2] = z;
+			Out[3] = w;
+		}
+	};
+#elif(GLM_ARCH & GLM_ARCH_SSE2)
+	template <>
+	struct lane<float>
+	{
+		typedef lane4_ps type;
+
+		static std::size_t const size = 4;
+
+		GLM_FUNC_QUALIFIER static type load(float const * Base, std::size_t Stride)
+		{
+			return _mm_setr_ps(Base[0 * Stride], Base[1 * Stride], Base[2 * Stride], Base[3 * Stride]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float * Out, type const & Value)
+		{
+			_mm_storeu_ps(Out, Value.data);
+		}
+
+		GLM_FUNC_QUALIFIER static type index()
+		{
+			return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+		}
+
+		GLM_FUNC_QUALIFIER static int movemask(type const & Mask)
+		{
+			return _mm_movemask_ps(Mask.data);
+		}
+
+		// Only 3 and 4 components are supported, 3 components elements must be contiguous (Stride == 3)
+		template <length_t Components>
+		GLM_FUNC_QUALIFIER static void load_soa(float const * Base, std::size_t Stride, type Out[Components])
+		{
+			if(Components == 3)
+			{
+				__m128 x, y, z;
+				sse_aos3_to_soa_ps(_mm_loadu_ps(Base + 0), _mm_loadu_ps(Base + 4), _mm_loadu_ps(Base + 8), x, y, z);
+				Out[0] = x;
+				Out[1] = y;
+				Out[2] = z;
+			}
+			else
+			{
+				__m128 x = _mm_loadu_ps(Base + 0 * Stride);
+				__m128 y = _mm_loadu_ps(Base + 1 * Stride);
+				__m128 z = _mm_loadu_ps(Base + 2 * Stride);
+				__m128 w = _mm_loadu_ps(Base + 3 * Stride);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+				Out[0] = x;
+				Out[1] = y;
+				Out[2] = z;
+				Out[3] = w;
+			}
+		}
+
+		template <length_t Components>
+		GLM_FUNC_QUALIFIER static void store_soa(float * Base, std::size_t Stride, type const In[Components])
+		{
+			if(Components == 3)
+			{
+				__m128 a, b, c;
+				sse_soa_to_aos3_ps(In[0].data, In[1].data, In[2].data, a, b, c);
+				_mm_storeu_ps(Base + 0, a);
+				_mm_storeu_ps(Base + 4, b);
+				_mm_storeu_ps(Base + 8, c);
+			}
+			else
+			{
+				__m128 x = In[0].data, y = In[1].data, z = In[2].data, w = In[3].data;
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+				_mm_storeu_ps(Base + 0 * Stride, x);
+				_mm_storeu_ps(Base + 1 * Stride, y);
+				_mm_storeu_ps(Base + 2 * Stride, z);
+				_mm_storeu_ps(Base + 3 * Stride, w);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void gather_soa4(float const * const Bases[4], type Out[4])
+		{
+			__m128 x = _mm_loadu_ps(Bases[0]);
+			__m128 y = _mm_loadu_ps(Bases[1]);
+			__m128 z = _mm_loadu_ps(Bases[2]);
+			__m128 w = _mm_loadu_ps(Bases[3]);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			Out[0] = x;
+			Out[1] = y;
+			Out[2] = z;
+			Out[3] = w;
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
@@ -28,6 +28,9 @@
 
 #pragma once
 
+#include "_lane.hpp"
+#include <cstddef>
+
 namespace glm{
 namespace detail
 {
@@ -98,6 +101,12 @@ namespace detail
 	}
 */
 	
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fade(T const & t)
+	{
+		return (t * t * t) * (t * (t * T(6) - T(15)) + T(10));
+	}
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tvec2<T, P> fade(detail::tvec2<T, P> const & t)
 	{
@@ -122,6 +131,11 @@ namespace detail
 		return (t * t * t) * (t * (t * T(6) - T(15)) + T(10));
 	}
 */
+
+	// Lanes of the batch noise functions: each lane evaluates a different point.
+	template <typename T>
+	struct noise_lane : public lane<T>
+	{};
 }//namespace detail
 }//namespace glm
 
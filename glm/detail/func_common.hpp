@@ -293,6 +293,15 @@ namespace glm
 		T const & edge,
 		vecType<T, P> const & x);
 
+	/// Returns 0.0 if x < edge, otherwise it returns 1.0 for each component.
+	/// 
+	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/step.xml">GLSL step man page</a>
+	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.3 Common Functions</a>
+	template <template <typename, precision> class vecType, typename T, precision P>
+	GLM_FUNC_DECL vecType<T, P> step(
+		vecType<T, P> const & edge,
+		vecType<T, P> const & x);
+
 	/// Returns 0.0 if x <= edge0 and 1.0 if x >= edge1 and
 	/// performs smooth Hermite interpolation between 0 and 1
 	/// when edge0 < x < edge1. This is useful in cases where
@@ -563,7 +563,11 @@ namespace detail
 		genType const & x
 	)
 	{
-		return mix(genType(1), genType(0), glm::lessThan(x, edge));
+		GLM_STATIC_ASSERT(
+			std::numeric_limits<genType>::is_iec559,
+			"'step' only accept floating-point inputs");
+
+		return x < edge ? genType(0) : genType(1);
 	}
 
 	template <template <typename, precision> class vecType, typename T, precision P>
@@ -580,6 +584,20 @@ namespace detail
 		return mix(vecType<T, P>(1), vecType<T, P>(0), glm::lessThan(x, vecType<T, P>(edge)));
 	}
 
+	template <template <typename, precision> class vecType, typename T, precision P>
+	GLM_FUNC_QUALIFIER vecType<T, P> step
+	(
+		vecType<T, P> const & edge,
+		vecType<T, P> const & x
+	)
+	{
+		GLM_STATIC_ASSERT(
+			std::numeric_limits<T>::is_iec559,
+			"'step' only accept floating-point inputs");
+
+		return mix(vecType<T, P>(1), vecType<T, P>(0), glm::lessThan(x, edge));
+	}
+
 	// smoothstep
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType smoothstep
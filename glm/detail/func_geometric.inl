@@ -31,6 +31,9 @@
 #include "type_vec2.hpp"
 #include "type_vec4.hpp"
 #include "type_float.hpp"
+#if(GLM_HAS_SIMD_DISPATCH)
+#	include "intrinsic_geometric.hpp"
+#endif
 
 namespace glm{
 namespace detail
@@ -81,6 +84,40 @@ namespace detail
 			return (tmp.x + tmp.y) + (tmp.z + tmp.w);
 		}
 	};
+
+	template <typename T, precision P>
+	struct compute_normalize_vec4
+	{
+		GLM_FUNC_QUALIFIER static detail::tvec4<T, P> call(detail::tvec4<T, P> const & x)
+		{
+			T sqr = x.x * x.x + x.y * x.y + x.z * x.z + x.w * x.w;
+			return x * inversesqrt(sqr);
+		}
+	};
+
+#	if(GLM_HAS_SIMD_DISPATCH)
+	template <precision P>
+	struct compute_dot<detail::tvec4, float, P>
+	{
+		GLM_FUNC_QUALIFIER static float call(detail::tvec4<float, P> const & x, detail::tvec4<float, P> const & y)
+		{
+			return _mm_cvtss_f32(sse_dot_ss(x.data, y.data));
+		}
+	};
+
+	template <precision P>
+	struct compute_normalize_vec4<float, P>
+	{
+		GLM_FUNC_QUALIFIER static detail::tvec4<float, P> call(detail::tvec4<float, P> const & x)
+		{
+			__m128 const isr0 = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(sse_dot_ps(x.data, x.data)));
+
+			detail::tvec4<float, P> Result(detail::tvec4<float, P>::_null);
+			Result.data = _mm_mul_ps(x.data, isr0);
+			return Result;
+		}
+	};
+#	endif//GLM_HAS_SIMD_DISPATCH
 }//namespace detail
 
 	// length
@@ -272,8 +309,7 @@ namespace detail
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'normalize' only accept floating-point inputs");
 		
-		T sqr = x.x * x.x + x.y * x.y + x.z * x.z + x.w * x.w;
-		return x * inversesqrt(sqr);
+		return detail::compute_normalize_vec4<T, P>::call(x);
 	}
 
 	// faceforward
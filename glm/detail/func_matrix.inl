@@ -370,6 +370,40 @@ namespace detail
 		}
 	};
 
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_transpose<detail::tmat4x4, double, P>
+	{
+		GLM_FUNC_QUALIFIER static detail::tmat4x4<double, P> call(detail::tmat4x4<double, P> const & m)
+		{
+			detail::tmat4x4<double, P> result(detail::tmat4x4<double, P>::_null);
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				detail::avx_transpose_pd(&m[0][0], &result[0][0]);
+#			else
+				detail::sse_transpose_pd(&m[0][0], &result[0][0]);
+#			endif
+			return result;
+		}
+	};
+#	endif//GLM_ARCH
+
+#	if(GLM_HAS_SIMD_DISPATCH)
+	template <precision P>
+	struct compute_transpose<detail::tmat4x4, float, P>
+	{
+		GLM_FUNC_QUALIFIER static detail::tmat4x4<float, P> call(detail::tmat4x4<float, P> const & m)
+		{
+			detail::tmat4x4<float, P> result(detail::tmat4x4<float, P>::_null);
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				detail::avx_transpose_ps(&m[0].data, &result[0].data);
+#			else
+				detail::sse_transpose_ps(&m[0].data, &result[0].data);
+#			endif
+			return result;
+		}
+	};
+#	endif//GLM_HAS_SIMD_DISPATCH
+
 	template <template <class, precision> class matType, typename T, precision P>
 	struct compute_determinant{};
 
@@ -417,6 +451,21 @@ namespace detail
 				m[0][2] * DetCof[2] + m[0][3] * DetCof[3];
 		}
 	};
+
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_determinant<detail::tmat4x4, double, P>
+	{
+		GLM_FUNC_QUALIFIER static double call(detail::tmat4x4<double, P> const & m)
+		{
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				return detail::avx_det_pd(&m[0][0]);
+#			else
+				return detail::sse_det_pd(&m[0][0]);
+#			endif
+		}
+	};
+#	endif//GLM_ARCH
 }//namespace detail
 
 	template <typename T, precision P, template <typename, precision> class matType>
@@ -39,13 +39,13 @@
 namespace glm{
 namespace detail
 {
-	void sse_add_ps(__m128 in1[4], __m128 in2[4], __m128 out[4]);
+	void sse_add_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
 
-	void sse_sub_ps(__m128 in1[4], __m128 in2[4], __m128 out[4]);
+	void sse_sub_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
 
-	__m128 sse_mul_ps(__m128 m[4], __m128 v);
+	__m128 sse_mul_ps(__m128 const m[4], __m128 v);
 
-	__m128 sse_mul_ps(__m128 v, __m128 m[4]);
+	__m128 sse_mul_ps(__m128 v, __m128 const m[4]);
 
 	void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
 
@@ -59,6 +59,38 @@ namespace detail
 
 	__m128 sse_slow_det_ps(__m128 const m[4]);
 
+	void sse_mul_vec_pd(double const m[16], double const v[4], double out[4]);
+
+	void sse_mul_pd(double const in1[16], double const in2[16], double out[16]);
+
+	void sse_transpose_pd(double const in[16], double out[16]);
+
+	void sse_inverse_pd(double const in[16], double out[16]);
+
+	double sse_det_pd(double const in[16]);
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+	void avx_add_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
+
+	void avx_sub_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
+
+	void avx_comp_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
+
+	void avx_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
+
+	void avx_transpose_ps(__m128 const in[4], __m128 out[4]);
+
+	void avx_mul_vec_pd(double const m[16], double const v[4], double out[4]);
+
+	void avx_mul_pd(double const in1[16], double const in2[16], double out[16]);
+
+	void avx_transpose_pd(double const in[16], double out[16]);
+
+	void avx_inverse_pd(double const in[16], double out[16]);
+
+	double avx_det_pd(double const in[16]);
+#endif//GLM_ARCH
+
 }//namespace detail
 }//namespace glm
 
@@ -1066,5 +1066,472 @@ GLM_FUNC_QUALIFIER void sse_outer_ps(__m128 const & c, __m128 const & r, __m128
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+
+// Double precision 4x4 matrices are column major arrays of 16 doubles without alignment requirement.
+// Results are computed before being stored so that out may alias the inputs.
+
+GLM_FUNC_QUALIFIER void sse_mul_vec_pd(double const m[16], double const v[4], double out[4])
+{
+	__m128d v0 = _mm_load1_pd(v + 0);
+	__m128d v1 = _mm_load1_pd(v + 1);
+	__m128d v2 = _mm_load1_pd(v + 2);
+	__m128d v3 = _mm_load1_pd(v + 3);
+
+	__m128d m0 = _mm_mul_pd(_mm_loadu_pd(m + 0), v0);
+	__m128d m1 = _mm_mul_pd(_mm_loadu_pd(m + 4), v1);
+	__m128d m2 = _mm_mul_pd(_mm_loadu_pd(m + 8), v2);
+	__m128d m3 = _mm_mul_pd(_mm_loadu_pd(m + 12), v3);
+	__m128d XY = _mm_add_pd(_mm_add_pd(m0, m1), _mm_add_pd(m2, m3));
+
+	__m128d m4 = _mm_mul_pd(_mm_loadu_pd(m + 2), v0);
+	__m128d m5 = _mm_mul_pd(_mm_loadu_pd(m + 6), v1);
+	__m128d m6 = _mm_mul_pd(_mm_loadu_pd(m + 10), v2);
+	__m128d m7 = _mm_mul_pd(_mm_loadu_pd(m + 14), v3);
+	__m128d ZW = _mm_add_pd(_mm_add_pd(m4, m5), _mm_add_pd(m6, m7));
+
+	_mm_storeu_pd(out + 0, XY);
+	_mm_storeu_pd(out + 2, ZW);
+}
+
+GLM_FUNC_QUALIFIER void sse_mul_pd(double const in1[16], double const in2[16], double out[16])
+{
+	__m128d A0 = _mm_loadu_pd(in1 + 0);
+	__m128d A1 = _mm_loadu_pd(in1 + 2);
+	__m128d A2 = _mm_loadu_pd(in1 + 4);
+	__m128d A3 = _mm_loadu_pd(in1 + 6);
+	__m128d A4 = _mm_loadu_pd(in1 + 8);
+	__m128d A5 = _mm_loadu_pd(in1 + 10);
+	__m128d A6 = _mm_loadu_pd(in1 + 12);
+	__m128d A7 = _mm_loadu_pd(in1 + 14);
+
+	__m128d Result[8];
+	for(int i = 0; i < 4; ++i)
+	{
+		__m128d B0 = _mm_load1_pd(in2 + i * 4 + 0);
+		__m128d B1 = _mm_load1_pd(in2 + i * 4 + 1);
+		__m128d B2 = _mm_load1_pd(in2 + i * 4 + 2);
+		__m128d B3 = _mm_load1_pd(in2 + i * 4 + 3);
+
+		// Same summation order as the generic tmat4x4 product
+		__m128d XY = _mm_mul_pd(A0, B0);
+		XY = _mm_add_pd(XY, _mm_mul_pd(A2, B1));
+		XY = _mm_add_pd(XY, _mm_mul_pd(A4, B2));
+		XY = _mm_add_pd(XY, _mm_mul_pd(A6, B3));
+
+		__m128d ZW = _mm_mul_pd(A1, B0);
+		ZW = _mm_add_pd(ZW, _mm_mul_pd(A3, B1));
+		ZW = _mm_add_pd(ZW, _mm_mul_pd(A5, B2));
+		ZW = _mm_add_pd(ZW, _mm_mul_pd(A7, B3));
+
+		Result[i * 2 + 0] = XY;
+		Result[i * 2 + 1] = ZW;
+	}
+
+	for(int i = 0; i < 8; ++i)
+		_mm_storeu_pd(out + i * 2, Result[i]);
+}
+
+GLM_FUNC_QUALIFIER void sse_transpose_pd(double const in[16], double out[16])
+{
+	__m128d C0 = _mm_loadu_pd(in + 0);
+	__m128d C1 = _mm_loadu_pd(in + 2);
+	__m128d C2 = _mm_loadu_pd(in + 4);
+	__m128d C3 = _mm_loadu_pd(in + 6);
+	__m128d C4 = _mm_loadu_pd(in + 8);
+	__m128d C5 = _mm_loadu_pd(in + 10);
+	__m128d C6 = _mm_loadu_pd(in + 12);
+	__m128d C7 = _mm_loadu_pd(in + 14);
+
+	_mm_storeu_pd(out + 0, _mm_unpacklo_pd(C0, C2));
+	_mm_storeu_pd(out + 2, _mm_unpacklo_pd(C4, C6));
+	_mm_storeu_pd(out + 4, _mm_unpackhi_pd(C0, C2));
+	_mm_storeu_pd(out + 6, _mm_unpackhi_pd(C4, C6));
+	_mm_storeu_pd(out + 8, _mm_unpacklo_pd(C1, C3));
+	_mm_storeu_pd(out + 10, _mm_unpacklo_pd(C5, C7));
+	_mm_storeu_pd(out + 12, _mm_unpackhi_pd(C1, C3));
+	_mm_storeu_pd(out + 14, _mm_unpackhi_pd(C5, C7));
+}
+
+// Fac = (m[2][a], m[2][a], m[1][a], m[1][a]) * (m[3][b], m[3][b], m[3][b], m[2][b])
+//     - (m[3][a], m[3][a], m[3][a], m[2][a]) * (m[2][b], m[2][b], m[1][b], m[1][b])
+template <int a, int b>
+GLM_FUNC_QUALIFIER void sse_fac_pd(double const m[16], __m128d Fac[2])
+{
+	__m128d S1a = _mm_load1_pd(m + 4 + a);
+	__m128d S2a = _mm_load1_pd(m + 8 + a);
+	__m128d S3a = _mm_load1_pd(m + 12 + a);
+	__m128d S1b = _mm_load1_pd(m + 4 + b);
+	__m128d S2b = _mm_load1_pd(m + 8 + b);
+	__m128d S3b = _mm_load1_pd(m + 12 + b);
+
+	Fac[0] = _mm_sub_pd(_mm_mul_pd(S2a, S3b), _mm_mul_pd(S3a, S2b));
+	Fac[1] = _mm_sub_pd(_mm_mul_pd(S1a, _mm_move_sd(S2b, S3b)), _mm_mul_pd(_mm_move_sd(S2a, S3a), S1b));
+}
+
+// Columns of the adjugate matrix, the signed cofactors are computed in the same order as the generic compute_inverse
+GLM_FUNC_QUALIFIER void sse_adjugate_pd(double const m[16], __m128d out[8])
+{
+	__m128d Fac0[2], Fac1[2], Fac2[2], Fac3[2], Fac4[2], Fac5[2];
+	sse_fac_pd<2, 3>(m, Fac0);
+	sse_fac_pd<1, 3>(m, Fac1);
+	sse_fac_pd<1, 2>(m, Fac2);
+	sse_fac_pd<0, 3>(m, Fac3);
+	sse_fac_pd<0, 2>(m, Fac4);
+	sse_fac_pd<0, 1>(m, Fac5);
+
+	// VecN = (m[1][N], m[0][N], m[0][N], m[0][N])
+	__m128d Vec0[2] = {_mm_loadh_pd(_mm_load_sd(m + 4), m + 0), _mm_load1_pd(m + 0)};
+	__m128d Vec1[2] = {_mm_loadh_pd(_mm_load_sd(m + 5), m + 1), _mm_load1_pd(m + 1)};
+	__m128d Vec2[2] = {_mm_loadh_pd(_mm_load_sd(m + 6), m + 2), _mm_load1_pd(m + 2)};
+	__m128d Vec3[2] = {_mm_loadh_pd(_mm_load_sd(m + 7), m + 3), _mm_load1_pd(m + 3)};
+
+	__m128d SignA = _mm_set_pd(-1.0, 1.0);
+	__m128d SignB = _mm_set_pd( 1.0,-1.0);
+
+	for(int i = 0; i < 2; ++i)
+	{
+		out[0 + i] = _mm_mul_pd(SignA, _mm_add_pd(_mm_sub_pd(_mm_mul_pd(Vec1[i], Fac0[i]), _mm_mul_pd(Vec2[i], Fac1[i])), _mm_mul_pd(Vec3[i], Fac2[i])));
+		out[2 + i] = _mm_mul_pd(SignB, _mm_add_pd(_mm_sub_pd(_mm_mul_pd(Vec0[i], Fac0[i]), _mm_mul_pd(Vec2[i], Fac3[i])), _mm_mul_pd(Vec3[i], Fac4[i])));
+		out[4 + i] = _mm_mul_pd(SignA, _mm_add_pd(_mm_sub_pd(_mm_mul_pd(Vec0[i], Fac1[i]), _mm_mul_pd(Vec1[i], Fac3[i])), _mm_mul_pd(Vec3[i], Fac5[i])));
+		out[6 + i] = _mm_mul_pd(SignB, _mm_add_pd(_mm_sub_pd(_mm_mul_pd(Vec0[i], Fac2[i]), _mm_mul_pd(Vec1[i], Fac4[i])), _mm_mul_pd(Vec2[i], Fac5[i])));
+	}
+}
+
+GLM_FUNC_QUALIFIER void sse_inverse_pd(double const in[16], double out[16])
+{
+	__m128d Inv[8];
+	sse_adjugate_pd(in, Inv);
+
+	// Row0 = (Inv0[0], Inv1[0], Inv2[0], Inv3[0])
+	__m128d Dot0 = _mm_mul_pd(_mm_loadu_pd(in + 0), _mm_unpacklo_pd(Inv[0], Inv[2]));
+	__m128d Dot1 = _mm_mul_pd(_mm_loadu_pd(in + 2), _mm_unpacklo_pd(Inv[4], Inv[6]));
+
+	// Determinant = (Dot0.x + Dot0.y) + (Dot0.z + Dot0.w)
+	__m128d Add0 = _mm_add_pd(Dot0, _mm_shuffle_pd(Dot0, Dot0, 1));
+	__m128d Add1 = _mm_add_pd(Dot1, _mm_shuffle_pd(Dot1, Dot1, 1));
+	__m128d OneOverDeterminant = _mm_div_pd(_mm_set1_pd(1.0), _mm_add_pd(Add0, Add1));
+
+	for(int i = 0; i < 8; ++i)
+		_mm_storeu_pd(out + i * 2, _mm_mul_pd(Inv[i], OneOverDeterminant));
+}
+
+// The 6 sub factors of the generic compute_determinant
+GLM_FUNC_QUALIFIER void sse_det_sub_factors_pd(double const m[16], __m128d SubFactor[3])
+{
+	// SubFactor00, SubFactor01
+	SubFactor[0] = _mm_sub_pd(
+		_mm_mul_pd(_mm_loadh_pd(_mm_load_sd(m + 10), m + 9), _mm_load1_pd(m + 15)),
+		_mm_mul_pd(_mm_loadh_pd(_mm_load_sd(m + 14), m + 13), _mm_load1_pd(m + 11)));
+	// SubFactor02, SubFactor03
+	SubFactor[1] = _mm_sub_pd(
+		_mm_mul_pd(_mm_loadh_pd(_mm_load_sd(m + 9), m + 8), _mm_loadh_pd(_mm_load_sd(m + 14), m + 15)),
+		_mm_mul_pd(_mm_loadh_pd(_mm_load_sd(m + 13), m + 12), _mm_loadh_pd(_mm_load_sd(m + 10), m + 11)));
+	// SubFactor04, SubFactor05
+	SubFactor[2] = _mm_sub_pd(
+		_mm_mul_pd(_mm_load1_pd(m + 8), _mm_loadh_pd(_mm_load_sd(m + 14), m + 13)),
+		_mm_mul_pd(_mm_load1_pd(m + 12), _mm_loadh_pd(_mm_load_sd(m + 10), m + 9)));
+}
+
+GLM_FUNC_QUALIFIER double sse_det_pd(double const m[16])
+{
+	__m128d SubFactor[3];
+	sse_det_sub_factors_pd(m, SubFactor);
+
+	// DetCof = (m[1][1], m[1][0], m[1][0], m[1][0]) * (SubFactor00, SubFactor00, SubFactor01, SubFactor02)
+	//        - (m[1][2], m[1][2], m[1][1], m[1][1]) * (SubFactor01, SubFactor03, SubFactor03, SubFactor04)
+	//        + (m[1][3], m[1][3], m[1][3], m[1][2]) * (SubFactor02, SubFactor04, SubFactor05, SubFactor05)
+	__m128d Fac0XY = _mm_unpacklo_pd(SubFactor[0], SubFactor[0]);
+	__m128d Fac0ZW = _mm_shuffle_pd(SubFactor[0], SubFactor[1], 1);
+	__m128d Fac1XY = _mm_unpackhi_pd(SubFactor[0], SubFactor[1]);
+	__m128d Fac1ZW = _mm_shuffle_pd(SubFactor[1], SubFactor[2], 1);
+	__m128d Fac2XY = _mm_unpacklo_pd(SubFactor[1], SubFactor[2]);
+	__m128d Fac2ZW = _mm_unpackhi_pd(SubFactor[2], SubFactor[2]);
+
+	__m128d DetCofXY = _mm_add_pd(_mm_sub_pd(
+		_mm_mul_pd(_mm_loadh_pd(_mm_load_sd(m + 5), m + 4), Fac0XY),
+		_mm_mul_pd(_mm_load1_pd(m + 6), Fac1XY)),
+		_mm_mul_pd(_mm_load1_pd(m + 7), Fac2XY));
+	__m128d DetCofZW = _mm_add_pd(_mm_sub_pd(
+		_mm_mul_pd(_mm_load1_pd(m + 4), Fac0ZW),
+		_mm_mul_pd(_mm_load1_pd(m + 5), Fac1ZW)),
+		_mm_mul_pd(_mm_loadh_pd(_mm_load_sd(m + 7), m + 6), Fac2ZW));
+
+	// Determinant = ((Dot.x + Dot.y) + Dot.z) + Dot.w, like the generic determinant
+	__m128d DotXY = _mm_mul_pd(_mm_loadu_pd(m + 0), _mm_mul_pd(DetCofXY, _mm_set_pd(-1.0, 1.0)));
+	__m128d DotZW = _mm_mul_pd(_mm_loadu_pd(m + 2), _mm_mul_pd(DetCofZW, _mm_set_pd(-1.0, 1.0)));
+	__m128d Det = _mm_add_sd(DotXY, _mm_unpackhi_pd(DotXY, DotXY));
+	Det = _mm_add_sd(Det, DotZW);
+	Det = _mm_add_sd(Det, _mm_unpackhi_pd(DotZW, DotZW));
+	return _mm_cvtsd_f64(Det);
+}
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+
+GLM_FUNC_QUALIFIER void avx_add_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4])
+{
+	// Two columns per instruction
+	__m256 a0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in1[0]));
+	__m256 a1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in1[2]));
+	__m256 b0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0]));
+	__m256 b1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2]));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_add_ps(a0, b0));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_add_ps(a1, b1));
+}
+
+GLM_FUNC_QUALIFIER void avx_sub_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4])
+{
+	__m256 a0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in1[0]));
+	__m256 a1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in1[2]));
+	__m256 b0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0]));
+	__m256 b1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2]));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_sub_ps(a0, b0));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_sub_ps(a1, b1));
+}
+
+GLM_FUNC_QUALIFIER void avx_comp_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4])
+{
+	__m256 a0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in1[0]));
+	__m256 a1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in1[2]));
+	__m256 b0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0]));
+	__m256 b1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2]));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_mul_ps(a0, b0));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_mul_ps(a1, b1));
+}
+
+GLM_FUNC_QUALIFIER void avx_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4])
+{
+	// Each column of in1 duplicated in both 128 bits lanes
+	__m256 a0 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[0]), in1[0], 1);
+	__m256 a1 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[1]), in1[1], 1);
+	__m256 a2 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[2]), in1[2], 1);
+	__m256 a3 = _mm256_insertf128_ps(_mm256_castps128_ps256(in1[3]), in1[3], 1);
+
+	// Two columns of in2 per iteration, all inputs are loaded before out is written
+	__m256 b0 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[0]));
+	__m256 b1 = _mm256_loadu_ps(reinterpret_cast<float const*>(&in2[2]));
+
+	__m256 m00 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b0, b0, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 m01 = _mm256_mul_ps(a1, _mm256_shuffle_ps(b0, b0, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m256 m02 = _mm256_mul_ps(a2, _mm256_shuffle_ps(b0, b0, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m256 m03 = _mm256_mul_ps(a3, _mm256_shuffle_ps(b0, b0, _MM_SHUFFLE(3, 3, 3, 3)));
+
+	__m256 m10 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b1, b1, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 m11 = _mm256_mul_ps(a1, _mm256_shuffle_ps(b1, b1, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m256 m12 = _mm256_mul_ps(a2, _mm256_shuffle_ps(b1, b1, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m256 m13 = _mm256_mul_ps(a3, _mm256_shuffle_ps(b1, b1, _MM_SHUFFLE(3, 3, 3, 3)));
+
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_add_ps(_mm256_add_ps(m00, m01), _mm256_add_ps(m02, m03)));
+	_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_add_ps(_mm256_add_ps(m10, m11), _mm256_add_ps(m12, m13)));
+}
+
+GLM_FUNC_QUALIFIER void avx_transpose_ps(__m128 const in[4], __m128 out[4])
+{
+	__m256 a = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[0]));
+	__m256 b = _mm256_loadu_ps(reinterpret_cast<float const*>(&in[2]));
+
+	// (00, 20, 01, 21 | 10, 30, 11, 31) and (02, 22, 03, 23 | 12, 32, 13, 33)
+	__m256 t0 = _mm256_unpacklo_ps(a, b);
+	__m256 t1 = _mm256_unpackhi_ps(a, b);
+
+#	if(GLM_ARCH & GLM_ARCH_AVX2)
+		// Rows (0 | 1) and (2 | 3) with a single cross lane permutation each
+		__m256i Perm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+		_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_permutevar8x32_ps(t0, Perm));
+		_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_permutevar8x32_ps(t1, Perm));
+#	else
+		// (00, 20, 01, 21 | 02, 22, 03, 23) and (10, 30, 11, 31 | 12, 32, 13, 33)
+		__m256 u0 = _mm256_permute2f128_ps(t0, t1, 0x20);
+		__m256 u1 = _mm256_permute2f128_ps(t0, t1, 0x31);
+
+		// Rows (0 | 2) and (1 | 3)
+		__m256 r0 = _mm256_unpacklo_ps(u0, u1);
+		__m256 r1 = _mm256_unpackhi_ps(u0, u1);
+
+		_mm256_storeu_ps(reinterpret_cast<float*>(&out[0]), _mm256_permute2f128_ps(r0, r1, 0x20));
+		_mm256_storeu_ps(reinterpret_cast<float*>(&out[2]), _mm256_permute2f128_ps(r0, r1, 0x31));
+#	endif
+}
+
+#if(GLM_ARCH & GLM_ARCH_AVX2)
+// Broadcast lane Index of v, a single cross lane permutation
+template <int Index>
+GLM_FUNC_QUALIFIER __m256d avx_splat_pd(__m256d v)
+{
+	return _mm256_permute4x64_pd(v, Index * 0x55);
+}
+#endif//GLM_ARCH
+
+GLM_FUNC_QUALIFIER void avx_mul_vec_pd(double const m[16], double const v[4], double out[4])
+{
+	__m256d m0 = _mm256_mul_pd(_mm256_loadu_pd(m + 0), _mm256_broadcast_sd(v + 0));
+	__m256d m1 = _mm256_mul_pd(_mm256_loadu_pd(m + 4), _mm256_broadcast_sd(v + 1));
+	__m256d m2 = _mm256_mul_pd(_mm256_loadu_pd(m + 8), _mm256_broadcast_sd(v + 2));
+	__m256d m3 = _mm256_mul_pd(_mm256_loadu_pd(m + 12), _mm256_broadcast_sd(v + 3));
+
+	__m256d a0 = _mm256_add_pd(m0, m1);
+	__m256d a1 = _mm256_add_pd(m2, m3);
+	_mm256_storeu_pd(out, _mm256_add_pd(a0, a1));
+}
+
+GLM_FUNC_QUALIFIER void avx_mul_pd(double const in1[16], double const in2[16], double out[16])
+{
+	__m256d A0 = _mm256_loadu_pd(in1 + 0);
+	__m256d A1 = _mm256_loadu_pd(in1 + 4);
+	__m256d A2 = _mm256_loadu_pd(in1 + 8);
+	__m256d A3 = _mm256_loadu_pd(in1 + 12);
+
+	__m256d Result[4];
+	for(int i = 0; i < 4; ++i)
+	{
+		// Same summation order as the generic tmat4x4 product
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			// One load per column of in2, its components are splatted in registers
+			__m256d B = _mm256_loadu_pd(in2 + i * 4);
+			__m256d r = _mm256_mul_pd(A0, avx_splat_pd<0>(B));
+			r = _mm256_add_pd(r, _mm256_mul_pd(A1, avx_splat_pd<1>(B)));
+			r = _mm256_add_pd(r, _mm256_mul_pd(A2, avx_splat_pd<2>(B)));
+			r = _mm256_add_pd(r, _mm256_mul_pd(A3, avx_splat_pd<3>(B)));
+#		else
+			__m256d r = _mm256_mul_pd(A0, _mm256_broadcast_sd(in2 + i * 4 + 0));
+			r = _mm256_add_pd(r, _mm256_mul_pd(A1, _mm256_broadcast_sd(in2 + i * 4 + 1)));
+			r = _mm256_add_pd(r, _mm256_mul_pd(A2, _mm256_broadcast_sd(in2 + i * 4 + 2)));
+			r = _mm256_add_pd(r, _mm256_mul_pd(A3, _mm256_broadcast_sd(in2 + i * 4 + 3)));
+#		endif
+		Result[i] = r;
+	}
+
+	_mm256_storeu_pd(out + 0, Result[0]);
+	_mm256_storeu_pd(out + 4, Result[1]);
+	_mm256_storeu_pd(out + 8, Result[2]);
+	_mm256_storeu_pd(out + 12, Result[3]);
+}
+
+GLM_FUNC_QUALIFIER void avx_transpose_pd(double const in[16], double out[16])
+{
+	__m256d C0 = _mm256_loadu_pd(in + 0);
+	__m256d C1 = _mm256_loadu_pd(in + 4);
+	__m256d C2 = _mm256_loadu_pd(in + 8);
+	__m256d C3 = _mm256_loadu_pd(in + 12);
+
+	__m256d Tmp0 = _mm256_unpacklo_pd(C0, C1); // m00 m10 m02 m12
+	__m256d Tmp1 = _mm256_unpackhi_pd(C0, C1); // m01 m11 m03 m13
+	__m256d Tmp2 = _mm256_unpacklo_pd(C2, C3); // m20 m30 m22 m32
+	__m256d Tmp3 = _mm256_unpackhi_pd(C2, C3); // m21 m31 m23 m33
+
+	_mm256_storeu_pd(out + 0, _mm256_permute2f128_pd(Tmp0, Tmp2, 0x20));
+	_mm256_storeu_pd(out + 4, _mm256_permute2f128_pd(Tmp1, Tmp3, 0x20));
+	_mm256_storeu_pd(out + 8, _mm256_permute2f128_pd(Tmp0, Tmp2, 0x31));
+	_mm256_storeu_pd(out + 12, _mm256_permute2f128_pd(Tmp1, Tmp3, 0x31));
+}
+
+// Columns of the adjugate matrix, the signed cofactors are computed in the same order as the generic compute_inverse
+GLM_FUNC_QUALIFIER void avx_adjugate_pd(double const m[16], __m256d out[4])
+{
+	// Splat[Column][Row]
+	__m256d Splat[4][4];
+	for(int i = 0; i < 4; ++i)
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			__m256d Column = _mm256_loadu_pd(m + i * 4);
+			Splat[i][0] = avx_splat_pd<0>(Column);
+			Splat[i][1] = avx_splat_pd<1>(Column);
+			Splat[i][2] = avx_splat_pd<2>(Column);
+			Splat[i][3] = avx_splat_pd<3>(Column);
+#		else
+			Splat[i][0] = _mm256_broadcast_sd(m + i * 4 + 0);
+			Splat[i][1] = _mm256_broadcast_sd(m + i * 4 + 1);
+			Splat[i][2] = _mm256_broadcast_sd(m + i * 4 + 2);
+			Splat[i][3] = _mm256_broadcast_sd(m + i * 4 + 3);
+#		endif
+	}
+
+	// FacN = (m[2][a], m[2][a], m[1][a], m[1][a]) * (m[3][b], m[3][b], m[3][b], m[2][b])
+	//      - (m[3][a], m[3][a], m[3][a], m[2][a]) * (m[2][b], m[2][b], m[1][b], m[1][b])
+	int const FacRowA[6] = {2, 1, 1, 0, 0, 0};
+	int const FacRowB[6] = {3, 3, 2, 3, 2, 1};
+
+	__m256d Fac[6];
+	for(int i = 0; i < 6; ++i)
+	{
+		int const a = FacRowA[i];
+		int const b = FacRowB[i];
+		__m256d Swp00 = _mm256_blend_pd(Splat[2][a], Splat[1][a], 0xC);
+		__m256d Swp01 = _mm256_blend_pd(Splat[3][b], Splat[2][b], 0x8);
+		__m256d Swp02 = _mm256_blend_pd(Splat[3][a], Splat[2][a], 0x8);
+		__m256d Swp03 = _mm256_blend_pd(Splat[2][b], Splat[1][b], 0xC);
+		Fac[i] = _mm256_sub_pd(_mm256_mul_pd(Swp00, Swp01), _mm256_mul_pd(Swp02, Swp03));
+	}
+
+	// VecN = (m[1][N], m[0][N], m[0][N], m[0][N])
+	__m256d Vec0 = _mm256_blend_pd(Splat[0][0], Splat[1][0], 0x1);
+	__m256d Vec1 = _mm256_blend_pd(Splat[0][1], Splat[1][1], 0x1);
+	__m256d Vec2 = _mm256_blend_pd(Splat[0][2], Splat[1][2], 0x1);
+	__m256d Vec3 = _mm256_blend_pd(Splat[0][3], Splat[1][3], 0x1);
+
+	__m256d SignA = _mm256_set_pd(-1.0, 1.0,-1.0, 1.0);
+	__m256d SignB = _mm256_set_pd( 1.0,-1.0, 1.0,-1.0);
+
+	out[0] = _mm256_mul_pd(SignA, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec1, Fac[0]), _mm256_mul_pd(Vec2, Fac[1])), _mm256_mul_pd(Vec3, Fac[2])));
+	out[1] = _mm256_mul_pd(SignB, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec0, Fac[0]), _mm256_mul_pd(Vec2, Fac[3])), _mm256_mul_pd(Vec3, Fac[4])));
+	out[2] = _mm256_mul_pd(SignA, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec0, Fac[1]), _mm256_mul_pd(Vec1, Fac[3])), _mm256_mul_pd(Vec3, Fac[5])));
+	out[3] = _mm256_mul_pd(SignB, _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec0, Fac[2]), _mm256_mul_pd(Vec1, Fac[4])), _mm256_mul_pd(Vec2, Fac[5])));
+}
+
+GLM_FUNC_QUALIFIER void avx_inverse_pd(double const in[16], double out[16])
+{
+	__m256d Inv[4];
+	avx_adjugate_pd(in, Inv);
+
+	// Row0 = (Inv0[0], Inv1[0], Inv2[0], Inv3[0])
+	__m256d Row0 = _mm256_permute2f128_pd(_mm256_unpacklo_pd(Inv[0], Inv[1]), _mm256_unpacklo_pd(Inv[2], Inv[3]), 0x20);
+
+	// Determinant = (Dot0.x + Dot0.y) + (Dot0.z + Dot0.w)
+	__m256d Dot0 = _mm256_mul_pd(_mm256_loadu_pd(in), Row0);
+	__m256d Dot1 = _mm256_hadd_pd(Dot0, Dot0);
+	__m256d Dot2 = _mm256_add_pd(Dot1, _mm256_permute2f128_pd(Dot1, Dot1, 0x01));
+	__m256d OneOverDeterminant = _mm256_div_pd(_mm256_set1_pd(1.0), Dot2);
+
+	_mm256_storeu_pd(out + 0, _mm256_mul_pd(Inv[0], OneOverDeterminant));
+	_mm256_storeu_pd(out + 4, _mm256_mul_pd(Inv[1], OneOverDeterminant));
+	_mm256_storeu_pd(out + 8, _mm256_mul_pd(Inv[2], OneOverDeterminant));
+	_mm256_storeu_pd(out + 12, _mm256_mul_pd(Inv[3], OneOverDeterminant));
+}
+
+GLM_FUNC_QUALIFIER double avx_det_pd(double const m[16])
+{
+	__m128d SubFactor[3];
+	sse_det_sub_factors_pd(m, SubFactor);
+
+	// (SubFactor00, SubFactor00, SubFactor01, SubFactor02)
+	__m256d Fac0 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_unpacklo_pd(SubFactor[0], SubFactor[0])), _mm_shuffle_pd(SubFactor[0], SubFactor[1], 1), 1);
+	// (SubFactor01, SubFactor03, SubFactor03, SubFactor04)
+	__m256d Fac1 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_unpackhi_pd(SubFactor[0], SubFactor[1])), _mm_shuffle_pd(SubFactor[1], SubFactor[2], 1), 1);
+	// (SubFactor02, SubFactor04, SubFactor05, SubFactor05)
+	__m256d Fac2 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_unpacklo_pd(SubFactor[1], SubFactor[2])), _mm_unpackhi_pd(SubFactor[2], SubFactor[2]), 1);
+
+	__m256d Splat10 = _mm256_broadcast_sd(m + 4);
+	__m256d Splat11 = _mm256_broadcast_sd(m + 5);
+	__m256d Splat12 = _mm256_broadcast_sd(m + 6);
+	__m256d Splat13 = _mm256_broadcast_sd(m + 7);
+
+	// (m[1][1], m[1][0], m[1][0], m[1][0]), (m[1][2], m[1][2], m[1][1], m[1][1]), (m[1][3], m[1][3], m[1][3], m[1][2])
+	__m256d Vec0 = _mm256_blend_pd(Splat10, Splat11, 0x1);
+	__m256d Vec1 = _mm256_blend_pd(Splat12, Splat11, 0xC);
+	__m256d Vec2 = _mm256_blend_pd(Splat13, Splat12, 0x8);
+
+	__m256d DetCof = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec0, Fac0), _mm256_mul_pd(Vec1, Fac1)), _mm256_mul_pd(Vec2, Fac2));
+	__m256d Dot = _mm256_mul_pd(_mm256_loadu_pd(m), _mm256_mul_pd(DetCof, _mm256_set_pd(-1.0, 1.0,-1.0, 1.0)));
+
+	// Determinant = ((Dot.x + Dot.y) + Dot.z) + Dot.w, like the generic determinant
+	__m128d Lo = _mm256_castpd256_pd128(Dot);
+	__m128d Hi = _mm256_extractf128_pd(Dot, 1);
+	__m128d Det = _mm_add_sd(Lo, _mm_unpackhi_pd(Lo, Lo));
+	Det = _mm_add_sd(Det, Hi);
+	Det = _mm_add_sd(Det, _mm_unpackhi_pd(Hi, Hi));
+	return _mm_cvtsd_f64(Det);
+}
+
+#endif//GLM_ARCH
+
 }//namespace detail
 }//namespace glm
@@ -129,6 +129,7 @@
 #define GLM_COMPILER_VC10			0x01000090
 #define GLM_COMPILER_VC11			0x010000A0
 #define GLM_COMPILER_VC12			0x010000B0
+#define GLM_COMPILER_VC14			0x010000C0
 
 // GCC defines
 #define GLM_COMPILER_GCC			0x02000000
@@ -231,8 +232,10 @@
 #		define GLM_COMPILER GLM_COMPILER_VC10
 #	elif _MSC_VER == 1700
 #		define GLM_COMPILER GLM_COMPILER_VC11
-#	elif _MSC_VER >= 1800
+#	elif _MSC_VER == 1800
 #		define GLM_COMPILER GLM_COMPILER_VC12
+#	elif _MSC_VER >= 1900
+#		define GLM_COMPILER GLM_COMPILER_VC14
 #	else//_MSC_VER
 #		define GLM_COMPILER GLM_COMPILER_VC
 #	endif//_MSC_VER
@@ -548,6 +551,12 @@
 	((GLM_LANG & GLM_LANG_CXX0X_FLAG) && ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC10))) || \
 	((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC43)))
 
+// N2659
+#define GLM_HAS_THREAD_LOCAL ( \
+	((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (GLM_COMPILER & GLM_COMPILER_VC) && (GLM_COMPILER >= GLM_COMPILER_VC14)) || \
+	((GLM_LANG & GLM_LANG_CXX0X_FLAG) && (GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC48)) || \
+	__has_feature(cxx_thread_local))
+
 // OpenMP
 #ifdef _OPENMP 
 #	if(GLM_COMPILER & GLM_COMPILER_GCC)
@@ -662,6 +671,21 @@
 #	endif
 #endif//GLM_ARCH
 
+// F16C half-precision conversions, available on every AVX2 processor
+#if((GLM_ARCH & GLM_ARCH_AVX) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2))))
+#	define GLM_HAS_F16C 1
+#else
+#	define GLM_HAS_F16C 0
+#endif
+
+// BMI2 bit deposit and extract, available on every AVX2 processor but microcoded on AMD processors
+// before Zen 3 where GLM_FORCE_NO_BMI2 selects the table and shift based code instead
+#if((GLM_ARCH & GLM_ARCH_AVX2) && (GLM_MODEL == GLM_MODEL_64) && !defined(GLM_FORCE_NO_BMI2) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC)))
+#	define GLM_HAS_BMI2 1
+#else
+#	define GLM_HAS_BMI2 0
+#endif
+
 #if(defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_ARCH_DISPLAYED))
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
@@ -678,6 +702,27 @@
 #	pragma message("GLM: #define GLM_FORCE_PURE to avoid using platform specific instruction sets")
 #endif//GLM_MESSAGE
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// SIMD dispatch
+
+// User defines: GLM_FORCE_SIMD_DISPATCH
+
+// vec4 and mat4 operators and functions use the SSE intrinsics of glm/detail/intrinsic_*.inl
+#if(defined(GLM_FORCE_SIMD_DISPATCH) && (GLM_ARCH & GLM_ARCH_SSE2) && GLM_HAS_UNRESTRICTED_UNIONS)
+#	define GLM_HAS_SIMD_DISPATCH 1
+#else
+#	define GLM_HAS_SIMD_DISPATCH 0
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_SIMD_DISPATCH_DISPLAYED))
+#	define GLM_MESSAGE_SIMD_DISPATCH_DISPLAYED
+#	if(GLM_HAS_SIMD_DISPATCH)
+#		pragma message("GLM: vec4 and mat4 operations dispatched to SIMD intrinsics")
+#	else
+#		pragma message("GLM: #define GLM_FORCE_SIMD_DISPATCH to dispatch vec4 and mat4 operations to SIMD intrinsics")
+#	endif
+#endif//GLM_MESSAGE
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Static assert
 
@@ -34,6 +34,12 @@
 #include <limits>
 #include <cstddef>
 
+// Under SSE2, the default on x86-64, dmat4 multiply, inverse, determinant and transpose
+// use the SSE2 or AVX kernels of intrinsic_matrix.hpp. GLM_FORCE_PURE selects the generic code.
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "intrinsic_matrix.hpp"
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -534,6 +534,150 @@ namespace detail
 		}
 	};
 
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_inverse<detail::tmat4x4, double, P>
+	{
+		static detail::tmat4x4<double, P> call(detail::tmat4x4<double, P> const & m)
+		{
+			detail::tmat4x4<double, P> Result(detail::tmat4x4<double, P>::_null);
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				avx_inverse_pd(&m[0][0], &Result[0][0]);
+#			else
+				sse_inverse_pd(&m[0][0], &Result[0][0]);
+#			endif
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH
+
+	template <typename T, precision P>
+	struct compute_mul_mat4x4
+	{
+		static typename tmat4x4<T, P>::col_type call(tmat4x4<T, P> const & m, typename tmat4x4<T, P>::row_type const & v)
+		{
+			typename tmat4x4<T, P>::col_type const Mov0(v[0]);
+			typename tmat4x4<T, P>::col_type const Mov1(v[1]);
+			typename tmat4x4<T, P>::col_type const Mul0 = m[0] * Mov0;
+			typename tmat4x4<T, P>::col_type const Mul1 = m[1] * Mov1;
+			typename tmat4x4<T, P>::col_type const Add0 = Mul0 + Mul1;
+			typename tmat4x4<T, P>::col_type const Mov2(v[2]);
+			typename tmat4x4<T, P>::col_type const Mov3(v[3]);
+			typename tmat4x4<T, P>::col_type const Mul2 = m[2] * Mov2;
+			typename tmat4x4<T, P>::col_type const Mul3 = m[3] * Mov3;
+			typename tmat4x4<T, P>::col_type const Add1 = Mul2 + Mul3;
+			typename tmat4x4<T, P>::col_type const Add2 = Add0 + Add1;
+			return Add2;
+		}
+
+		static tmat4x4<T, P> call(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
+		{
+			typename tmat4x4<T, P>::col_type const SrcA0 = m1[0];
+			typename tmat4x4<T, P>::col_type const SrcA1 = m1[1];
+			typename tmat4x4<T, P>::col_type const SrcA2 = m1[2];
+			typename tmat4x4<T, P>::col_type const SrcA3 = m1[3];
+
+			typename tmat4x4<T, P>::col_type const SrcB0 = m2[0];
+			typename tmat4x4<T, P>::col_type const SrcB1 = m2[1];
+			typename tmat4x4<T, P>::col_type const SrcB2 = m2[2];
+			typename tmat4x4<T, P>::col_type const SrcB3 = m2[3];
+
+			tmat4x4<T, P> Result(tmat4x4<T, P>::_null);
+			Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
+			Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
+			Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
+			Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
+			return Result;
+		}
+	};
+
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_mul_mat4x4<double, P>
+	{
+		static tvec4<double, P> call(tmat4x4<double, P> const & m, tvec4<double, P> const & v)
+		{
+			tvec4<double, P> Result(tvec4<double, P>::_null);
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				avx_mul_vec_pd(&m[0][0], &v[0], &Result[0]);
+#			else
+				sse_mul_vec_pd(&m[0][0], &v[0], &Result[0]);
+#			endif
+			return Result;
+		}
+
+		static tmat4x4<double, P> call(tmat4x4<double, P> const & m1, tmat4x4<double, P> const & m2)
+		{
+			tmat4x4<double, P> Result(tmat4x4<double, P>::_null);
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				avx_mul_pd(&m1[0][0], &m2[0][0], &Result[0][0]);
+#			else
+				sse_mul_pd(&m1[0][0], &m2[0][0], &Result[0][0]);
+#			endif
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH
+
+	template <typename T, precision P>
+	struct compute_mul_vec4_mat4x4
+	{
+		static typename tmat4x4<T, P>::row_type call(typename tmat4x4<T, P>::col_type const & v, tmat4x4<T, P> const & m)
+		{
+			return typename tmat4x4<T, P>::row_type(
+				m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2] + m[0][3] * v[3],
+				m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2] + m[1][3] * v[3],
+				m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2] + m[2][3] * v[3],
+				m[3][0] * v[0] + m[3][1] * v[1] + m[3][2] * v[2] + m[3][3] * v[3]);
+		}
+	};
+
+#	if(GLM_HAS_SIMD_DISPATCH)
+	template <precision P>
+	struct compute_inverse<detail::tmat4x4, float, P>
+	{
+		static detail::tmat4x4<float, P> call(detail::tmat4x4<float, P> const & m)
+		{
+			detail::tmat4x4<float, P> Result(detail::tmat4x4<float, P>::_null);
+			sse_inverse_ps(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mul_mat4x4<float, P>
+	{
+		static tvec4<float, P> call(tmat4x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			tvec4<float, P> Result(tvec4<float, P>::_null);
+			Result.data = sse_mul_ps(&m[0].data, v.data);
+			return Result;
+		}
+
+		static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(tmat4x4<float, P>::_null);
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+				avx_mul_ps(&m1[0].data, &m2[0].data, &Result[0].data);
+#			else
+				sse_mul_ps(&m1[0].data, &m2[0].data, &Result[0].data);
+#			endif
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mul_vec4_mat4x4<float, P>
+	{
+		static tvec4<float, P> call(tvec4<float, P> const & v, tmat4x4<float, P> const & m)
+		{
+			tvec4<float, P> Result(tvec4<float, P>::_null);
+			Result.data = sse_mul_ps(v.data, &m[0].data);
+			return Result;
+		}
+	};
+#	endif//GLM_HAS_SIMD_DISPATCH
+
 	// Binary operators
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> operator+
@@ -654,45 +798,7 @@ namespace detail
 		typename tmat4x4<T, P>::row_type const & v
 	)
 	{
-/*
-		__m128 v0 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 v1 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 v2 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 v3 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(m[0].data, v0);
-		__m128 m1 = _mm_mul_ps(m[1].data, v1);
-		__m128 a0 = _mm_add_ps(m0, m1);
-
-		__m128 m2 = _mm_mul_ps(m[2].data, v2);
-		__m128 m3 = _mm_mul_ps(m[3].data, v3);
-		__m128 a1 = _mm_add_ps(m2, m3);
-
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		return typename tmat4x4<T, P>::col_type(a2);
-*/
-
-		typename tmat4x4<T, P>::col_type const Mov0(v[0]);
-		typename tmat4x4<T, P>::col_type const Mov1(v[1]);
-		typename tmat4x4<T, P>::col_type const Mul0 = m[0] * Mov0;
-		typename tmat4x4<T, P>::col_type const Mul1 = m[1] * Mov1;
-		typename tmat4x4<T, P>::col_type const Add0 = Mul0 + Mul1;
-		typename tmat4x4<T, P>::col_type const Mov2(v[2]);
-		typename tmat4x4<T, P>::col_type const Mov3(v[3]);
-		typename tmat4x4<T, P>::col_type const Mul2 = m[2] * Mov2;
-		typename tmat4x4<T, P>::col_type const Mul3 = m[3] * Mov3;
-		typename tmat4x4<T, P>::col_type const Add1 = Mul2 + Mul3;
-		typename tmat4x4<T, P>::col_type const Add2 = Add0 + Add1;
-		return Add2;
-
-/*
-		return typename tmat4x4<T, P>::col_type(
-			m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2] + m[3][0] * v[3],
-			m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2] + m[3][1] * v[3],
-			m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2] + m[3][2] * v[3],
-			m[0][3] * v[0] + m[1][3] * v[1] + m[2][3] * v[2] + m[3][3] * v[3]);
-*/
+		return compute_mul_mat4x4<T, P>::call(m, v);
 	}
 
 	template <typename T, precision P>
@@ -702,11 +808,7 @@ namespace detail
 		tmat4x4<T, P> const & m
 	)
 	{
-		return typename tmat4x4<T, P>::row_type(
-			m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2] + m[0][3] * v[3],
-			m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2] + m[1][3] * v[3],
-			m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2] + m[2][3] * v[3],
-			m[3][0] * v[0] + m[3][1] * v[1] + m[3][2] * v[2] + m[3][3] * v[3]);
+		return compute_mul_vec4_mat4x4<T, P>::call(v, m);
 	}
 
 	template <typename T, precision P>
@@ -756,22 +858,7 @@ namespace detail
 		tmat4x4<T, P> const & m2
 	)
 	{
-		typename tmat4x4<T, P>::col_type const SrcA0 = m1[0];
-		typename tmat4x4<T, P>::col_type const SrcA1 = m1[1];
-		typename tmat4x4<T, P>::col_type const SrcA2 = m1[2];
-		typename tmat4x4<T, P>::col_type const SrcA3 = m1[3];
-
-		typename tmat4x4<T, P>::col_type const SrcB0 = m2[0];
-		typename tmat4x4<T, P>::col_type const SrcB1 = m2[1];
-		typename tmat4x4<T, P>::col_type const SrcB2 = m2[2];
-		typename tmat4x4<T, P>::col_type const SrcB3 = m2[3];
-
-		tmat4x4<T, P> Result(tmat4x4<T, P>::_null);
-		Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
-		Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
-		Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
-		Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
-		return Result;
+		return compute_mul_mat4x4<T, P>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -770,6 +770,32 @@ namespace detail
 	}
 
 	//operator*
+	template <typename T, precision P>
+	struct compute_vec4_mul
+	{
+		GLM_FUNC_QUALIFIER static tvec4<T, P> call(tvec4<T, P> const & v1, tvec4<T, P> const & v2)
+		{
+			return tvec4<T, P>(
+				v1.x * v2.x,
+				v1.y * v2.y,
+				v1.z * v2.z,
+				v1.w * v2.w);
+		}
+	};
+
+#	if(GLM_HAS_SIMD_DISPATCH)
+	template <precision P>
+	struct compute_vec4_mul<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v1, tvec4<float, P> const & v2)
+		{
+			tvec4<float, P> Result(tvec4<float, P>::_null);
+			Result.data = _mm_mul_ps(v1.data, v2.data);
+			return Result;
+		}
+	};
+#	endif//GLM_HAS_SIMD_DISPATCH
+
 	template <typename T, precision P> 
 	GLM_FUNC_QUALIFIER tvec4<T, P> operator* 
 	(
@@ -777,11 +803,7 @@ namespace detail
 		T const & s
 	)
 	{
-		return tvec4<T, P>(
-			v.x * s,
-			v.y * s,
-			v.z * s,
-			v.w * s);
+		return compute_vec4_mul<T, P>::call(v, tvec4<T, P>(s));
 	}
 
 	template <typename T, precision P> 
@@ -791,11 +813,7 @@ namespace detail
 		tvec4<T, P> const & v
 	)
 	{
-		return tvec4<T, P>(
-			s * v.x,
-			s * v.y,
-			s * v.z,
-			s * v.w);
+		return compute_vec4_mul<T, P>::call(tvec4<T, P>(s), v);
 	}
 
 	template <typename T, precision P> 
@@ -805,11 +823,7 @@ namespace detail
 		tvec4<T, P> const & v2
 	)
 	{
-		return tvec4<T, P>(
-			v1.x * v2.x,
-			v1.y * v2.y,
-			v1.z * v2.z,
-			v1.w * v2.w);
+		return compute_vec4_mul<T, P>::call(v1, v2);
 	}
 
 	//operator/
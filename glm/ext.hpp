@@ -77,20 +77,24 @@
 #include "./gtc/type_ptr.hpp"
 #include "./gtc/ulp.hpp"
 
+#include "./gtx/affine_matrix.hpp"
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
+#include "./gtx/bvh.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_space.hpp"
 #include "./gtx/color_space_YCoCg.hpp"
 #include "./gtx/compatibility.hpp"
 #include "./gtx/component_wise.hpp"
 #include "./gtx/dual_quaternion.hpp"
+#include "./gtx/dual_quaternion_skinning.hpp"
 #include "./gtx/euler_angles.hpp"
 #include "./gtx/extend.hpp"
 #include "./gtx/extented_min_max.hpp"
 #include "./gtx/fast_exponential.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
+#include "./gtx/frustum_culling.hpp"
 #include "./gtx/gradient_paint.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
 #include "./gtx/inertia.hpp"
@@ -98,12 +102,16 @@
 #include "./gtx/intersect.hpp"
 #include "./gtx/log_base.hpp"
 #include "./gtx/matrix_cross_product.hpp"
+#include "./gtx/matrix_decompose.hpp"
+#include "./gtx/matrix_hierarchy.hpp"
 #include "./gtx/matrix_interpolation.hpp"
 #include "./gtx/matrix_major_storage.hpp"
 #include "./gtx/matrix_operation.hpp"
 #include "./gtx/matrix_query.hpp"
 #include "./gtx/mixed_product.hpp"
+#include "./gtx/morton.hpp"
 #include "./gtx/multiple.hpp"
+#include "./gtx/noise_field.hpp"
 #include "./gtx/norm.hpp"
 #include "./gtx/normal.hpp"
 #include "./gtx/normalize_dot.hpp"
@@ -114,8 +122,11 @@
 #include "./gtx/polar_coordinates.hpp"
 #include "./gtx/projection.hpp"
 #include "./gtx/quaternion.hpp"
+#include "./gtx/quaternion_array.hpp"
+#include "./gtx/random_array.hpp"
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/spatial_sort.hpp"
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
 #if(!(GLM_COMPILER & GLM_COMPILER_CUDA))
@@ -123,6 +134,7 @@
 #endif
 #include "./gtx/transform.hpp"
 #include "./gtx/transform2.hpp"
+#include "./gtx/transform_array.hpp"
 #include "./gtx/vec1.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
@@ -38,6 +38,13 @@
 
 // Dependencies
 #include "../detail/setup.hpp"
+#include "../detail/precision.hpp"
+#include "../matrix.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/_lane.hpp"
+#endif
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_matrix_inverse extension included")
@@ -56,6 +63,46 @@ namespace glm
 	template <typename genType> 
 	GLM_FUNC_DECL genType affineInverse(genType const & m);
 
+	/// Fast matrix inverse for rigid transformations: a rotation followed by a translation.
+	/// The rotation part is transposed, it must be orthonormal.
+	/// 
+	/// @param m Input matrix to invert.
+	/// @tparam genType Squared floating-point matrix: half, float or double.
+	/// @see gtc_matrix_inverse
+	template <typename genType> 
+	GLM_FUNC_DECL genType rigidInverse(genType const & m);
+
+	/// Invert Count rigid transformations: Out[i] = rigidInverse(In[i]).
+	/// The matrices are processed by groups of 4 with SSE2 or 8 with AVX.
+	/// In and Out may be the same array.
+	/// @see gtc_matrix_inverse
+	template <typename T, precision P>
+	GLM_FUNC_DECL void rigidInverse(
+		detail::tmat4x4<T, P> const * In,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count);
+
+	/// Invert Count affine matrices: Out[i] = affineInverse(In[i]).
+	/// The matrices are processed by groups of 4 with SSE2 or 8 with AVX.
+	/// In and Out may be the same array.
+	/// @see gtc_matrix_inverse
+	template <typename T, precision P>
+	GLM_FUNC_DECL void affineInverse(
+		detail::tmat4x4<T, P> const * In,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count);
+
+	/// Invert Count matrices: Out[i] = inverse(In[i]).
+	/// The matrices are processed by groups of 4 with SSE2 or 8 with AVX. The groups
+	/// of affine matrices, with a last row of exactly (0, 0, 0, 1), use the affine inverse.
+	/// In and Out may be the same array.
+	/// @see gtc_matrix_inverse
+	template <typename T, precision P>
+	GLM_FUNC_DECL void inverse(
+		detail::tmat4x4<T, P> const * In,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count);
+
 	/// Compute the inverse transpose of a matrix.
 	/// 
 	/// @param m Input matrix to invert transpose.
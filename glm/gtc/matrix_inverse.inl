@@ -30,36 +30,366 @@
 #include "../mat3x3.hpp"
 #include "../mat4x4.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	// The kernels below take the 16 components of a 4x4 matrix in memory order:
+	// m[Column * 4 + Row]. L is a scalar type or a lane type of _lane.hpp.
+
+	// Transpose the rotation, rotate back the opposite of the translation
+	template <typename L>
+	GLM_FUNC_QUALIFIER void mat4_rigid_inverse_soa(L const m[16], L out[16])
+	{
+		L const Zero(0.0f);
+
+		L const Translation0 = -(m[0] * m[12] + m[1] * m[13] + m[2] * m[14]);
+		L const Translation1 = -(m[4] * m[12] + m[5] * m[13] + m[6] * m[14]);
+		L const Translation2 = -(m[8] * m[12] + m[9] * m[13] + m[10] * m[14]);
+
+		out[0] = m[0];
+		out[1] = m[4];
+		out[2] = m[8];
+		out[3] = Zero;
+		out[4] = m[1];
+		out[5] = m[5];
+		out[6] = m[9];
+		out[7] = Zero;
+		out[8] = m[2];
+		out[9] = m[6];
+		out[10] = m[10];
+		out[11] = Zero;
+		out[12] = Translation0;
+		out[13] = Translation1;
+		out[14] = Translation2;
+		out[15] = L(1.0f);
+	}
+
+	// The rows of the inverse of the upper 3x3 matrix are the cross products of its columns
+	template <typename L>
+	GLM_FUNC_QUALIFIER void mat4_affine_inverse_soa(L const m[16], L out[16])
+	{
+		L const Row0x = m[5] * m[10] - m[6] * m[9];
+		L const Row0y = m[6] * m[8] - m[4] * m[10];
+		L const Row0z = m[4] * m[9] - m[5] * m[8];
+		L const Row1x = m[9] * m[2] - m[10] * m[1];
+		L const Row1y = m[10] * m[0] - m[8] * m[2];
+		L const Row1z = m[8] * m[1] - m[9] * m[0];
+		L const Row2x = m[1] * m[6] - m[2] * m[5];
+		L const Row2y = m[2] * m[4] - m[0] * m[6];
+		L const Row2z = m[0] * m[5] - m[1] * m[4];
+
+		L const OneOverDeterminant = L(1.0f) / (m[0] * Row0x + m[1] * Row0y + m[2] * Row0z);
+
+		L const Inv0x = Row0x * OneOverDeterminant;
+		L const Inv0y = Row0y * OneOverDeterminant;
+		L const Inv0z = Row0z * OneOverDeterminant;
+		L const Inv1x = Row1x * OneOverDeterminant;
+		L const Inv1y = Row1y * OneOverDeterminant;
+		L const Inv1z = Row1z * OneOverDeterminant;
+		L const Inv2x = Row2x * OneOverDeterminant;
+		L const Inv2y = Row2y * OneOverDeterminant;
+		L const Inv2z = Row2z * OneOverDeterminant;
+
+		L const Translation0 = -(Inv0x * m[12] + Inv0y * m[13] + Inv0z * m[14]);
+		L const Translation1 = -(Inv1x * m[12] + Inv1y * m[13] + Inv1z * m[14]);
+		L const Translation2 = -(Inv2x * m[12] + Inv2y * m[13] + Inv2z * m[14]);
+
+		L const Zero(0.0f);
+		out[0] = Inv0x;
+		out[1] = Inv1x;
+		out[2] = Inv2x;
+		out[3] = Zero;
+		out[4] = Inv0y;
+		out[5] = Inv1y;
+		out[6] = Inv2y;
+		out[7] = Zero;
+		out[8] = Inv0z;
+		out[9] = Inv1z;
+		out[10] = Inv2z;
+		out[11] = Zero;
+		out[12] = Translation0;
+		out[13] = Translation1;
+		out[14] = Translation2;
+		out[15] = L(1.0f);
+	}
+
+	// Same cofactors as compute_inverse<tmat4x4>
+	template <typename L>
+	GLM_FUNC_QUALIFIER void mat4_inverse_soa(L const m[16], L out[16])
+	{
+		L const Coef00 = m[10] * m[15] - m[14] * m[11];
+		L const Coef02 = m[6] * m[15] - m[14] * m[7];
+		L const Coef03 = m[6] * m[11] - m[10] * m[7];
+
+		L const Coef04 = m[9] * m[15] - m[13] * m[11];
+		L const Coef06 = m[5] * m[15] - m[13] * m[7];
+		L const Coef07 = m[5] * m[11] - m[9] * m[7];
+
+		L const Coef08 = m[9] * m[14] - m[13] * m[10];
+		L const Coef10 = m[5] * m[14] - m[13] * m[6];
+		L const Coef11 = m[5] * m[10] - m[9] * m[6];
+
+		L const Coef12 = m[8] * m[15] - m[12] * m[11];
+		L const Coef14 = m[4] * m[15] - m[12] * m[7];
+		L const Coef15 = m[4] * m[11] - m[8] * m[7];
+
+		L const Coef16 = m[8] * m[14] - m[12] * m[10];
+		L const Coef18 = m[4] * m[14] - m[12] * m[6];
+		L const Coef19 = m[4] * m[10] - m[8] * m[6];
+
+		L const Coef20 = m[8] * m[13] - m[12] * m[9];
+		L const Coef22 = m[4] * m[13] - m[12] * m[5];
+		L const Coef23 = m[4] * m[9] - m[8] * m[5];
+
+		L const Inv00 = m[5] * Coef00 - m[6] * Coef04 + m[7] * Coef08;
+		L const Inv01 = m[2] * Coef04 - m[1] * Coef00 - m[3] * Coef08;
+		L const Inv02 = m[1] * Coef02 - m[2] * Coef06 + m[3] * Coef10;
+		L const Inv03 = m[2] * Coef07 - m[1] * Coef03 - m[3] * Coef11;
+
+		L const Inv10 = m[6] * Coef12 - m[4] * Coef00 - m[7] * Coef16;
+		L const Inv11 = m[0] * Coef00 - m[2] * Coef12 + m[3] * Coef16;
+		L const Inv12 = m[2] * Coef14 - m[0] * Coef02 - m[3] * Coef18;
+		L const Inv13 = m[0] * Coef03 - m[2] * Coef15 + m[3] * Coef19;
+
+		L const Inv20 = m[4] * Coef04 - m[5] * Coef12 + m[7] * Coef20;
+		L const Inv21 = m[1] * Coef12 - m[0] * Coef04 - m[3] * Coef20;
+		L const Inv22 = m[0] * Coef06 - m[1] * Coef14 + m[3] * Coef22;
+		L const Inv23 = m[1] * Coef15 - m[0] * Coef07 - m[3] * Coef23;
+
+		L const Inv30 = m[5] * Coef16 - m[4] * Coef08 - m[6] * Coef20;
+		L const Inv31 = m[0] * Coef08 - m[1] * Coef16 + m[2] * Coef20;
+		L const Inv32 = m[1] * Coef18 - m[0] * Coef10 - m[2] * Coef22;
+		L const Inv33 = m[0] * Coef11 - m[1] * Coef19 + m[2] * Coef23;
+
+		L const OneOverDeterminant = L(1.0f) / ((m[0] * Inv00 + m[1] * Inv10) + (m[2] * Inv20 + m[3] * Inv30));
+
+		out[0] = Inv00 * OneOverDeterminant;
+		out[1] = Inv01 * OneOverDeterminant;
+		out[2] = Inv02 * OneOverDeterminant;
+		out[3] = Inv03 * OneOverDeterminant;
+		out[4] = Inv10 * OneOverDeterminant;
+		out[5] = Inv11 * OneOverDeterminant;
+		out[6] = Inv12 * OneOverDeterminant;
+		out[7] = Inv13 * OneOverDeterminant;
+		out[8] = Inv20 * OneOverDeterminant;
+		out[9] = Inv21 * OneOverDeterminant;
+		out[10] = Inv22 * OneOverDeterminant;
+		out[11] = Inv23 * OneOverDeterminant;
+		out[12] = Inv30 * OneOverDeterminant;
+		out[13] = Inv31 * OneOverDeterminant;
+		out[14] = Inv32 * OneOverDeterminant;
+		out[15] = Inv33 * OneOverDeterminant;
+	}
+}//namespace detail
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tmat3x3<T, P> affineInverse
 	(
 		detail::tmat3x3<T, P> const & m
 	)
+	{
+		T const OneOverDeterminant = static_cast<T>(1) / (m[0][0] * m[1][1] - m[1][0] * m[0][1]);
+
+		detail::tmat3x3<T, P> Result(
+			+ m[1][1] * OneOverDeterminant,
+			- m[0][1] * OneOverDeterminant,
+			static_cast<T>(0),
+			- m[1][0] * OneOverDeterminant,
+			+ m[0][0] * OneOverDeterminant,
+			static_cast<T>(0),
+			static_cast<T>(0),
+			static_cast<T>(0),
+			static_cast<T>(1));
+		Result[2] = detail::tvec3<T, P>(-(detail::tmat2x2<T, P>(Result) * detail::tvec2<T, P>(m[2])), static_cast<T>(1));
+		return Result;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T, P> affineInverse
+	(
+		detail::tmat4x4<T, P> const & m
+	)
+	{
+		detail::tmat4x4<T, P> Result(detail::tmat4x4<T, P>::_null);
+		detail::mat4_affine_inverse_soa(&m[0][0], &Result[0][0]);
+		return Result;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat3x3<T, P> rigidInverse
+	(
+		detail::tmat3x3<T, P> const & m
+	)
 	{
 		detail::tmat3x3<T, P> Result(m);
 		Result[2] = detail::tvec3<T, P>(0, 0, 1);
 		Result = transpose(Result);
-		detail::tvec3<T, P> Translation = Result * detail::tvec3<T, P>(-detail::tvec2<T, P>(m[2]), m[2][2]);
-		Result[2] = Translation;
+		Result[2] = detail::tvec3<T, P>(-(detail::tmat2x2<T, P>(Result) * detail::tvec2<T, P>(m[2])), static_cast<T>(1));
 		return Result;
 	}
 
 	template <typename T, precision P>
-	GLM_FUNC_QUALIFIER detail::tmat4x4<T, P> affineInverse
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T, P> rigidInverse
 	(
 		detail::tmat4x4<T, P> const & m
 	)
 	{
-		detail::tmat4x4<T, P> Result(m);
-		Result[3] = detail::tvec4<T, P>(0, 0, 0, 1);
-		Result = transpose(Result);
-		detail::tvec4<T, P> Translation = Result * detail::tvec4<T, P>(-detail::tvec3<T, P>(m[3]), m[3][3]);
-		Result[3] = Translation;
+		detail::tmat4x4<T, P> Result(detail::tmat4x4<T, P>::_null);
+		detail::mat4_rigid_inverse_soa(&m[0][0], &Result[0][0]);
 		return Result;
 	}
 
+namespace detail
+{
+	// Last row of exactly (0, 0, 0, 1)
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool is_affine(detail::tmat4x4<T, P> const & m)
+	{
+		return m[0][3] == T(0) && m[1][3] == T(0) && m[2][3] == T(0) && m[3][3] == T(1);
+	}
+
+	template <typename T, precision P>
+	struct compute_inverse_array
+	{
+		GLM_FUNC_QUALIFIER static void rigid(detail::tmat4x4<T, P> const * in, detail::tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::rigidInverse(in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void affine(detail::tmat4x4<T, P> const * in, detail::tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::affineInverse(in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void general(detail::tmat4x4<T, P> const * in, detail::tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = is_affine(in[i]) ? glm::affineInverse(in[i]) : glm::inverse(in[i]);
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_inverse_array<float, P>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		enum kind
+		{
+			RIGID,
+			AFFINE,
+			GENERAL
+		};
+
+		GLM_FUNC_QUALIFIER static void block(detail::tmat4x4<float, P> const * in, detail::tmat4x4<float, P> * out, kind Kind)
+		{
+			L M[16], Result[16];
+			lane_type::load_soa<4>(&in[0][0].x, 16, M + 0);
+			lane_type::load_soa<4>(&in[0][1].x, 16, M + 4);
+			lane_type::load_soa<4>(&in[0][2].x, 16, M + 8);
+			lane_type::load_soa<4>(&in[0][3].x, 16, M + 12);
+
+			if(Kind == RIGID)
+				mat4_rigid_inverse_soa(M, Result);
+			else if(Kind == AFFINE)
+				mat4_affine_inverse_soa(M, Result);
+			else
+				mat4_inverse_soa(M, Result);
+
+			lane_type::store_soa<4>(&out[0][0].x, 16, Result + 0);
+			lane_type::store_soa<4>(&out[0][1].x, 16, Result + 4);
+			lane_type::store_soa<4>(&out[0][2].x, 16, Result + 8);
+			lane_type::store_soa<4>(&out[0][3].x, 16, Result + 12);
+		}
+
+		// A group uses the affine kernel only when all its matrices are affine
+		GLM_FUNC_QUALIFIER static kind classify(detail::tmat4x4<float, P> const * in, std::size_t count, kind Kind)
+		{
+			if(Kind != GENERAL)
+				return Kind;
+			for(std::size_t j = 0; j < count; ++j)
+				if(!is_affine(in[j]))
+					return GENERAL;
+			return AFFINE;
+		}
+
+		GLM_FUNC_QUALIFIER static void call(detail::tmat4x4<float, P> const * in, detail::tmat4x4<float, P> * out, std::size_t count, kind Kind)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				block(in + i, out + i, classify(in + i, Size, Kind));
+
+			if(i < count)
+			{
+				// Identity padding keeps the unused lanes invertible
+				detail::tmat4x4<float, P> In[Size], Result[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+					In[j] = in[i + j];
+				block(In, Result, classify(In, Size, Kind));
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void rigid(detail::tmat4x4<float, P> const * in, detail::tmat4x4<float, P> * out, std::size_t count)
+		{
+			call(in, out, count, RIGID);
+		}
+
+		GLM_FUNC_QUALIFIER static void affine(detail::tmat4x4<float, P> const * in, detail::tmat4x4<float, P> * out, std::size_t count)
+		{
+			call(in, out, count, AFFINE);
+		}
+
+		GLM_FUNC_QUALIFIER static void general(detail::tmat4x4<float, P> const * in, detail::tmat4x4<float, P> * out, std::size_t count)
+		{
+			call(in, out, count, GENERAL);
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void rigidInverse
+	(
+		detail::tmat4x4<T, P> const * In,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'rigidInverse' only accept floating-point inputs");
+		detail::compute_inverse_array<T, P>::rigid(In, Out, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void affineInverse
+	(
+		detail::tmat4x4<T, P> const * In,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineInverse' only accept floating-point inputs");
+		detail::compute_inverse_array<T, P>::affine(In, Out, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void inverse
+	(
+		detail::tmat4x4<T, P> const * In,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'inverse' only accept floating-point inputs");
+		detail::compute_inverse_array<T, P>::general(In, Out, Count);
+	}
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tmat2x2<T, P> inverseTranspose
 	(
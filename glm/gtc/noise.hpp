@@ -43,6 +43,7 @@
 // Dependencies
 #include "../detail/setup.hpp"
 #include "../detail/precision.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -72,6 +73,46 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vecType<T, P> const & p);
 
+	/// Classic perlin noise of Count positions, written to Out.
+	/// 2D and 3D positions are evaluated by groups of 4 with SSE2 or 8 with AVX.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void perlin(
+		T * Out,
+		vecType<T, P> const * Positions,
+		std::size_t Count);
+
+	/// Classic perlin noise of the grid of Dims positions starting at Origin and spaced by Step.
+	/// The noise of the position Origin + Step * (x, y, z) is written in Out[x + Dims.x * (y + Dims.y * z)].
+	/// 2D and 3D grids are evaluated by groups of 4 with SSE2 or 8 with AVX.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void perlin(
+		T * Out,
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Dims);
+
+	/// Simplex noise of Count positions, written to Out.
+	/// 2D and 3D positions are evaluated by groups of 4 with SSE2 or 8 with AVX.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void simplex(
+		T * Out,
+		vecType<T, P> const * Positions,
+		std::size_t Count);
+
+	/// Simplex noise of the grid of Dims positions starting at Origin and spaced by Step.
+	/// The noise of the position Origin + Step * (x, y, z) is written in Out[x + Dims.x * (y + Dims.y * z)].
+	/// 2D and 3D grids are evaluated by groups of 4 with SSE2 or 8 with AVX.
+	/// @see gtc_noise
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void simplex(
+		T * Out,
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Dims);
+
 	/// @}
 }//namespace glm
 
@@ -835,4 +835,402 @@ namespace gtc
 			(dot(m0 * m0, detail::tvec3<T, P>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) + 
 			dot(m1 * m1, detail::tvec2<T, P>(dot(p3, x3), dot(p4, x4))));
 	}
+
+namespace detail
+{
+	// The batch functions evaluate the 2D and 3D noises with the kernels below,
+	// where each lane of L is a different point. They compute the same operations
+	// in the same order as glm::perlin and glm::simplex.
+	struct noise_perlin
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & x, L const & y)
+		{
+			L const Fx0 = fract(x);
+			L const Fy0 = fract(y);
+			L const Fx1 = Fx0 - L(1);
+			L const Fy1 = Fy0 - L(1);
+			L const Ix0 = mod289(floor(x));
+			L const Iy0 = mod289(floor(y));
+			L const Ix1 = mod289(floor(x) + L(1));
+			L const Iy1 = mod289(floor(y) + L(1));
+
+			L const Px0 = permute(Ix0);
+			L const Px1 = permute(Ix1);
+
+			L const n00 = gradient(permute(Px0 + Iy0), Fx0, Fy0);
+			L const n10 = gradient(permute(Px1 + Iy0), Fx1, Fy0);
+			L const n01 = gradient(permute(Px0 + Iy1), Fx0, Fy1);
+			L const n11 = gradient(permute(Px1 + Iy1), Fx1, Fy1);
+
+			L const FadeX = fade(Fx0);
+			L const FadeY = fade(Fy0);
+			L const n_x0 = n00 + FadeX * (n10 - n00);
+			L const n_x1 = n01 + FadeX * (n11 - n01);
+			return L(2.3) * (n_x0 + FadeY * (n_x1 - n_x0));
+		}
+
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & x, L const & y, L const & z)
+		{
+			L const Fx0 = fract(x);
+			L const Fy0 = fract(y);
+			L const Fz0 = fract(z);
+			L const Fx1 = Fx0 - L(1);
+			L const Fy1 = Fy0 - L(1);
+			L const Fz1 = Fz0 - L(1);
+			L const Ix0 = mod289(floor(x));
+			L const Iy0 = mod289(floor(y));
+			L const Iz0 = mod289(floor(z));
+			L const Ix1 = mod289(floor(x) + L(1));
+			L const Iy1 = mod289(floor(y) + L(1));
+			L const Iz1 = mod289(floor(z) + L(1));
+
+			L const Px0 = permute(Ix0);
+			L const Px1 = permute(Ix1);
+			L const Pxy00 = permute(Px0 + Iy0);
+			L const Pxy10 = permute(Px1 + Iy0);
+			L const Pxy01 = permute(Px0 + Iy1);
+			L const Pxy11 = permute(Px1 + Iy1);
+
+			L const n000 = gradient(permute(Pxy00 + Iz0), Fx0, Fy0, Fz0);
+			L const n100 = gradient(permute(Pxy10 + Iz0), Fx1, Fy0, Fz0);
+			L const n010 = gradient(permute(Pxy01 + Iz0), Fx0, Fy1, Fz0);
+			L const n110 = gradient(permute(Pxy11 + Iz0), Fx1, Fy1, Fz0);
+			L const n001 = gradient(permute(Pxy00 + Iz1), Fx0, Fy0, Fz1);
+			L const n101 = gradient(permute(Pxy10 + Iz1), Fx1, Fy0, Fz1);
+			L const n011 = gradient(permute(Pxy01 + Iz1), Fx0, Fy1, Fz1);
+			L const n111 = gradient(permute(Pxy11 + Iz1), Fx1, Fy1, Fz1);
+
+			L const FadeX = fade(Fx0);
+			L const FadeY = fade(Fy0);
+			L const FadeZ = fade(Fz0);
+			L const n_z00 = n000 + FadeZ * (n001 - n000);
+			L const n_z10 = n100 + FadeZ * (n101 - n100);
+			L const n_z01 = n010 + FadeZ * (n011 - n010);
+			L const n_z11 = n110 + FadeZ * (n111 - n110);
+			L const n_yz0 = n_z00 + FadeY * (n_z01 - n_z00);
+			L const n_yz1 = n_z10 + FadeY * (n_z11 - n_z10);
+			return L(2.2) * (n_yz0 + FadeX * (n_yz1 - n_yz0));
+		}
+
+		template <typename T, precision P>
+		GLM_FUNC_QUALIFIER static T call(tvec4<T, P> const & Position)
+		{
+			return glm::perlin(Position);
+		}
+
+	private:
+		// 41 gradients over a diamond
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L gradient(L const & Hash, L const & x, L const & y)
+		{
+			L gx = L(2) * fract(Hash / L(41)) - L(1);
+			L const gy = abs(gx) - L(0.5);
+			gx = gx - floor(gx + L(0.5));
+
+			return taylorInvSqrt(gx * gx + gy * gy) * (gx * x + gy * y);
+		}
+
+		// 7x7 gradients over an octahedron
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L gradient(L const & Hash, L const & x, L const & y, L const & z)
+		{
+			L gx = Hash * L(1.0 / 7.0);
+			L gy = fract(floor(gx) * L(1.0 / 7.0)) - L(0.5);
+			gx = fract(gx);
+			L const gz = L(0.5) - abs(gx) - abs(gy);
+			L const sz = step(gz, L(0));
+			gx = gx - sz * (step(L(0), gx) - L(0.5));
+			gy = gy - sz * (step(L(0), gy) - L(0.5));
+
+			return taylorInvSqrt(gx * gx + gy * gy + gz * gz) * (gx * x + gy * y + gz * z);
+		}
+	};
+
+	struct noise_simplex
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & x, L const & y)
+		{
+			L const C0( 0.211324865405187); // (3.0 -  sqrt(3.0)) / 6.0
+			L const C1( 0.366025403784439); //  0.5 * (sqrt(3.0)  - 1.0)
+			L const C2(-0.577350269189626); // -1.0 + 2.0 * C.x
+
+			// First corner
+			L const s = x * C1 + y * C1;
+			L Ix = floor(x + s);
+			L Iy = floor(y + s);
+			L const t = Ix * C0 + Iy * C0;
+			L const x0 = x - Ix + t;
+			L const y0 = y - Iy + t;
+
+			// Other corners, x0 > y0 without branch
+			L const I1x = L(1) - step(x0, y0);
+			L const I1y = L(1) - I1x;
+			L const x1 = x0 + C0 - I1x;
+			L const y1 = y0 + C0 - I1y;
+			L const x2 = x0 + C2;
+			L const y2 = y0 + C2;
+
+			// Permutations
+			Ix = mod289(Ix);
+			Iy = mod289(Iy);
+			L const p0 = permute(permute(Iy) + Ix);
+			L const p1 = permute(permute(Iy + I1y) + Ix + I1x);
+			L const p2 = permute(permute(Iy + L(1)) + Ix + L(1));
+
+			L m0 = max(L(0.5) - (x0 * x0 + y0 * y0), L(0));
+			L m1 = max(L(0.5) - (x1 * x1 + y1 * y1), L(0));
+			L m2 = max(L(0.5) - (x2 * x2 + y2 * y2), L(0));
+			m0 = m0 * m0;
+			m1 = m1 * m1;
+			m2 = m2 * m2;
+
+			return L(130) * (
+				m0 * m0 * gradient(p0, x0, y0) +
+				m1 * m1 * gradient(p1, x1, y1) +
+				m2 * m2 * gradient(p2, x2, y2));
+		}
+
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & x, L const & y, L const & z)
+		{
+			L const Cx(1.0 / 6.0);
+			L const Cy(1.0 / 3.0);
+
+			// First corner
+			L const s = x * Cy + y * Cy + z * Cy;
+			L Ix = floor(x + s);
+			L Iy = floor(y + s);
+			L Iz = floor(z + s);
+			L const t = Ix * Cx + Iy * Cx + Iz * Cx;
+			L const x0 = x - Ix + t;
+			L const y0 = y - Iy + t;
+			L const z0 = z - Iz + t;
+
+			// Other corners
+			L const gx = step(y0, x0);
+			L const gy = step(z0, y0);
+			L const gz = step(x0, z0);
+			L const lx = L(1) - gx;
+			L const ly = L(1) - gy;
+			L const lz = L(1) - gz;
+			L const I1x = min(gx, lz);
+			L const I1y = min(gy, lx);
+			L const I1z = min(gz, ly);
+			L const I2x = max(gx, lz);
+			L const I2y = max(gy, lx);
+			L const I2z = max(gz, ly);
+
+			L const x1 = x0 - I1x + Cx;
+			L const y1 = y0 - I1y + Cx;
+			L const z1 = z0 - I1z + Cx;
+			L const x2 = x0 - I2x + Cy;
+			L const y2 = y0 - I2y + Cy;
+			L const z2 = z0 - I2z + Cy;
+			L const x3 = x0 - L(0.5);
+			L const y3 = y0 - L(0.5);
+			L const z3 = z0 - L(0.5);
+
+			// Permutations
+			Ix = mod289(Ix);
+			Iy = mod289(Iy);
+			Iz = mod289(Iz);
+			L const p0 = permute(permute(permute(Iz) + Iy) + Ix);
+			L const p1 = permute(permute(permute(Iz + I1z) + Iy + I1y) + Ix + I1x);
+			L const p2 = permute(permute(permute(Iz + I2z) + Iy + I2y) + Ix + I2x);
+			L const p3 = permute(permute(permute(Iz + L(1)) + Iy + L(1)) + Ix + L(1));
+
+			L m0 = max(L(0.6) - (x0 * x0 + y0 * y0 + z0 * z0), L(0));
+			L m1 = max(L(0.6) - (x1 * x1 + y1 * y1 + z1 * z1), L(0));
+			L m2 = max(L(0.6) - (x2 * x2 + y2 * y2 + z2 * z2), L(0));
+			L m3 = max(L(0.6) - (x3 * x3 + y3 * y3 + z3 * z3), L(0));
+			m0 = m0 * m0;
+			m1 = m1 * m1;
+			m2 = m2 * m2;
+			m3 = m3 * m3;
+
+			return L(42) * (
+				(m0 * m0 * gradient(p0, x0, y0, z0) + m1 * m1 * gradient(p1, x1, y1, z1)) +
+				(m2 * m2 * gradient(p2, x2, y2, z2) + m3 * m3 * gradient(p3, x3, y3, z3)));
+		}
+
+		template <typename T, precision P>
+		GLM_FUNC_QUALIFIER static T call(tvec4<T, P> const & Position)
+		{
+			return glm::simplex(Position);
+		}
+
+	private:
+		// 41 points uniformly over a line, mapped onto a diamond, normalized with the Taylor series
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L gradient(L const & Hash, L const & x, L const & y)
+		{
+			L const gx = L(2) * fract(Hash * L(0.024390243902439)) - L(1); // 1.0 / 41.0
+			L const h = abs(gx) - L(0.5);
+			L const a0 = gx - floor(gx + L(0.5));
+
+			return (L(1.79284291400159) - L(0.85373472095314) * (a0 * a0 + h * h)) * (a0 * x + h * y);
+		}
+
+		// 7x7 points over a square, mapped onto an octahedron
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L gradient(L const & Hash, L const & x, L const & y, L const & z)
+		{
+			L const n_(0.142857142857); // 1.0/7.0
+			L const nsx = n_ * L(2);
+			L const nsy = n_ * L(0.5) - L(1);
+
+			L const j = Hash - L(49) * floor(Hash * n_ * n_); // mod(p,7*7)
+			L const x_ = floor(j * n_);
+			L const y_ = floor(j - L(7) * x_); // mod(j,N)
+
+			L gx = x_ * nsx + nsy;
+			L gy = y_ * nsx + nsy;
+			L const gz = L(1) - abs(gx) - abs(gy);
+
+			L const sh = -step(gz, L(0));
+			gx = gx + (floor(gx) * L(2) + L(1)) * sh;
+			gy = gy + (floor(gy) * L(2) + L(1)) * sh;
+
+			return taylorInvSqrt(gx * gx + gy * gy + gz * gz) * (gx * x + gy * y + gz * z);
+		}
+	};
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	struct compute_noise_array{};
+
+	template <typename T, precision P>
+	struct compute_noise_array<T, P, tvec2>
+	{
+		template <typename kernel>
+		GLM_FUNC_QUALIFIER static void points(kernel, T * Out, tvec2<T, P> const * Positions, std::size_t Count)
+		{
+			typedef noise_lane<T> lane;
+
+			std::size_t const End = Count - Count % lane::size;
+			std::size_t i = 0;
+			for(; i < End; i += lane::size)
+				lane::store(Out + i, kernel::call(
+					lane::load(&Positions[i].x, 2),
+					lane::load(&Positions[i].y, 2)));
+			for(; i < Count; ++i)
+				Out[i] = kernel::call(Positions[i].x, Positions[i].y);
+		}
+
+		template <typename kernel>
+		GLM_FUNC_QUALIFIER static void grid(kernel, T * Out, tvec2<T, P> const & Origin, tvec2<T, P> const & Step, tvec2<int, P> const & Dims)
+		{
+			typedef noise_lane<T> lane;
+			typedef typename lane::type L;
+
+			std::size_t const SizeX = static_cast<std::size_t>(Dims.x);
+			std::size_t const EndX = SizeX - SizeX % lane::size;
+			for(int y = 0; y < Dims.y; ++y, Out += SizeX)
+			{
+				T const PositionY = Origin.y + Step.y * static_cast<T>(y);
+
+				std::size_t x = 0;
+				for(; x < EndX; x += lane::size)
+					lane::store(Out + x, kernel::call(
+						L(Origin.x) + L(Step.x) * (L(static_cast<T>(x)) + lane::index()),
+						L(PositionY)));
+				for(; x < SizeX; ++x)
+					Out[x] = kernel::call(Origin.x + Step.x * static_cast<T>(x), PositionY);
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_noise_array<T, P, tvec3>
+	{
+		template <typename kernel>
+		GLM_FUNC_QUALIFIER static void points(kernel, T * Out, tvec3<T, P> const * Positions, std::size_t Count)
+		{
+			typedef noise_lane<T> lane;
+
+			std::size_t const End = Count - Count % lane::size;
+			std::size_t i = 0;
+			for(; i < End; i += lane::size)
+				lane::store(Out + i, kernel::call(
+					lane::load(&Positions[i].x, 3),
+					lane::load(&Positions[i].y, 3),
+					lane::load(&Positions[i].z, 3)));
+			for(; i < Count; ++i)
+				Out[i] = kernel::call(Positions[i].x, Positions[i].y, Positions[i].z);
+		}
+
+		template <typename kernel>
+		GLM_FUNC_QUALIFIER static void grid(kernel, T * Out, tvec3<T, P> const & Origin, tvec3<T, P> const & Step, tvec3<int, P> const & Dims)
+		{
+			typedef noise_lane<T> lane;
+			typedef typename lane::type L;
+
+			std::size_t const SizeX = static_cast<std::size_t>(Dims.x);
+			std::size_t const EndX = SizeX - SizeX % lane::size;
+			for(int z = 0; z < Dims.z; ++z)
+			for(int y = 0; y < Dims.y; ++y, Out += SizeX)
+			{
+				T const PositionY = Origin.y + Step.y * static_cast<T>(y);
+				T const PositionZ = Origin.z + Step.z * static_cast<T>(z);
+
+				std::size_t x = 0;
+				for(; x < EndX; x += lane::size)
+					lane::store(Out + x, kernel::call(
+						L(Origin.x) + L(Step.x) * (L(static_cast<T>(x)) + lane::index()),
+						L(PositionY),
+						L(PositionZ)));
+				for(; x < SizeX; ++x)
+					Out[x] = kernel::call(Origin.x + Step.x * static_cast<T>(x), PositionY, PositionZ);
+			}
+		}
+	};
+
+	// No kernel for 4D noises, the points are evaluated one by one
+	template <typename T, precision P>
+	struct compute_noise_array<T, P, tvec4>
+	{
+		template <typename kernel>
+		GLM_FUNC_QUALIFIER static void points(kernel, T * Out, tvec4<T, P> const * Positions, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = kernel::call(Positions[i]);
+		}
+
+		template <typename kernel>
+		GLM_FUNC_QUALIFIER static void grid(kernel, T * Out, tvec4<T, P> const & Origin, tvec4<T, P> const & Step, tvec4<int, P> const & Dims)
+		{
+			for(int w = 0; w < Dims.w; ++w)
+			for(int z = 0; z < Dims.z; ++z)
+			for(int y = 0; y < Dims.y; ++y)
+			for(int x = 0; x < Dims.x; ++x)
+				*Out++ = kernel::call(Origin + Step * tvec4<T, P>(x, y, z, w));
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void perlin(T * Out, vecType<T, P> const * Positions, std::size_t Count)
+	{
+		detail::compute_noise_array<T, P, vecType>::points(detail::noise_perlin(), Out, Positions, Count);
+	}
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void perlin(T * Out, vecType<T, P> const & Origin, vecType<T, P> const & Step, vecType<int, P> const & Dims)
+	{
+		detail::compute_noise_array<T, P, vecType>::grid(detail::noise_perlin(), Out, Origin, Step, Dims);
+	}
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void simplex(T * Out, vecType<T, P> const * Positions, std::size_t Count)
+	{
+		detail::compute_noise_array<T, P, vecType>::points(detail::noise_simplex(), Out, Positions, Count);
+	}
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void simplex(T * Out, vecType<T, P> const & Origin, vecType<T, P> const & Step, vecType<int, P> const & Dims)
+	{
+		detail::compute_noise_array<T, P, vecType>::grid(detail::noise_simplex(), Out, Origin, Step, Dims);
+	}
 }//namespace glm
@@ -39,7 +39,9 @@
 #pragma once
 
 // Dependency:
+#include "../packing.hpp"
 #include "type_precision.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -279,7 +281,7 @@ namespace glm
 	/// @see vec2 unpackSnorm2x16(uint32 p)
 	/// @see <a href="http://www.opengl.org/sdk/docs/manglsl/xhtml/unpackSnorm2x16.xml">GLSL unpackSnorm4x8 man page</a>
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.4 Floating-Point Pack and Unpack Functions</a>
-	GLM_FUNC_DECL vec4 unpackSnorm4x16(uint64 const & p);
+	GLM_FUNC_DECL vec4 unpackSnorm4x16(uint64 p);
 	
 	/// Returns an unsigned integer obtained by converting the components of a floating-point scalar
 	/// to the 16-bit floating-point representation found in the OpenGL Specification,
@@ -329,6 +331,22 @@ namespace glm
 	/// @see <a href="http://www.opengl.org/registry/doc/GLSLangSpec.4.20.8.pdf">GLSL 4.20.8 specification, section 8.4 Floating-Point Pack and Unpack Functions</a>
 	GLM_FUNC_DECL vec4 unpackHalf4x16(uint64 p);
 
+	/// Converts Count floating-point values of In to the 16-bit floating-point representation found in the OpenGL Specification
+	/// and writes them to Out. The results are identical to packHalf1x16 ones.
+	/// 8 values are converted at a time with F16C or SSE2.
+	/// 
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float const & v)
+	GLM_FUNC_DECL void packHalf(float const * In, uint16 * Out, std::size_t Count);
+
+	/// Converts Count 16-bit floating-point values of In to 32-bit floating-point values and writes them to Out.
+	/// The results are identical to unpackHalf1x16 ones.
+	/// 8 values are converted at a time with F16C or SSE2.
+	/// 
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 const & v)
+	GLM_FUNC_DECL void unpackHalf(uint16 const * In, float * Out, std::size_t Count);
+
 	/// Returns an unsigned integer obtained by converting the components of a four-component signed integer vector 
 	/// to the 10-10-10-2-bit signed integer representation found in the OpenGL Specification, 
 	/// and then packing these four values into a 32-bit unsigned integer.
@@ -468,6 +486,249 @@ namespace glm
 	/// @see uint32 packF2x11_1x10(vec3 const & v)
 	GLM_FUNC_DECL vec3 unpackF2x11_1x10(uint32 p);
 
+	/// Packs Count values of In with packUnorm1x8 and writes the results to Out.
+	/// InStride and OutStride are the distances in bytes between two consecutive elements of In and Out,
+	/// 0 for tightly packed arrays, so that the attributes of an interleaved vertex buffer can be read or written in place.
+	/// The stream functions return the same results as the single element functions.
+	/// 
+	/// @see gtc_packing
+	/// @see uint8 packUnorm1x8(float const & v)
+	GLM_FUNC_DECL void packUnorm1x8(float const * In, std::size_t InStride, uint8 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm1x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x8(uint8 const & p)
+	GLM_FUNC_DECL void unpackUnorm1x8(uint8 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count values of In with packSnorm1x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint8 packSnorm1x8(float const & v)
+	GLM_FUNC_DECL void packSnorm1x8(float const * In, std::size_t InStride, uint8 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm1x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x8(uint8 const & p)
+	GLM_FUNC_DECL void unpackSnorm1x8(uint8 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packUnorm2x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint16 packUnorm2x8(vec2 const & v)
+	GLM_FUNC_DECL void packUnorm2x8(vec2 const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm2x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec2 unpackUnorm2x8(uint16 const & p)
+	GLM_FUNC_DECL void unpackUnorm2x8(uint16 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packSnorm2x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint16 packSnorm2x8(vec2 const & v)
+	GLM_FUNC_DECL void packSnorm2x8(vec2 const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm2x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec2 unpackSnorm2x8(uint16 const & p)
+	GLM_FUNC_DECL void unpackSnorm2x8(uint16 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packUnorm4x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packUnorm4x8(vec4 const & v)
+	GLM_FUNC_DECL void packUnorm4x8(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm4x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm4x8(uint32 const & p)
+	GLM_FUNC_DECL void unpackUnorm4x8(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packSnorm4x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packSnorm4x8(vec4 const & v)
+	GLM_FUNC_DECL void packSnorm4x8(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm4x8 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm4x8(uint32 const & p)
+	GLM_FUNC_DECL void unpackSnorm4x8(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count values of In with packUnorm1x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint16 packUnorm1x16(float const & v)
+	GLM_FUNC_DECL void packUnorm1x16(float const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm1x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x16(uint16 const & p)
+	GLM_FUNC_DECL void unpackUnorm1x16(uint16 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count values of In with packSnorm1x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint16 packSnorm1x16(float const & v)
+	GLM_FUNC_DECL void packSnorm1x16(float const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm1x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x16(uint16 const & p)
+	GLM_FUNC_DECL void unpackSnorm1x16(uint16 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packUnorm2x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packUnorm2x16(vec2 const & v)
+	GLM_FUNC_DECL void packUnorm2x16(vec2 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm2x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec2 unpackUnorm2x16(uint32 const & p)
+	GLM_FUNC_DECL void unpackUnorm2x16(uint32 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packSnorm2x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packSnorm2x16(vec2 const & v)
+	GLM_FUNC_DECL void packSnorm2x16(vec2 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm2x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec2 unpackSnorm2x16(uint32 const & p)
+	GLM_FUNC_DECL void unpackSnorm2x16(uint32 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packUnorm4x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint64 packUnorm4x16(vec4 const & v)
+	GLM_FUNC_DECL void packUnorm4x16(vec4 const * In, std::size_t InStride, uint64 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm4x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm4x16(uint64 const & p)
+	GLM_FUNC_DECL void unpackUnorm4x16(uint64 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packSnorm4x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint64 packSnorm4x16(vec4 const & v)
+	GLM_FUNC_DECL void packSnorm4x16(vec4 const * In, std::size_t InStride, uint64 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm4x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm4x16(uint64 const & p)
+	GLM_FUNC_DECL void unpackSnorm4x16(uint64 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count values of In with packHalf1x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float const & v)
+	GLM_FUNC_DECL void packHalf1x16(float const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackHalf1x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 const & p)
+	GLM_FUNC_DECL void unpackHalf1x16(uint16 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packHalf2x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packHalf2x16(vec2 const & v)
+	GLM_FUNC_DECL void packHalf2x16(vec2 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackHalf2x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec2 unpackHalf2x16(uint32 const & p)
+	GLM_FUNC_DECL void unpackHalf2x16(uint32 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packHalf4x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint64 packHalf4x16(vec4 const & v)
+	GLM_FUNC_DECL void packHalf4x16(vec4 const * In, std::size_t InStride, uint64 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackHalf4x16 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackHalf4x16(uint64 const & p)
+	GLM_FUNC_DECL void unpackHalf4x16(uint64 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packI3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packI3x10_1x2(ivec4 const & v)
+	GLM_FUNC_DECL void packI3x10_1x2(ivec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackI3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see ivec4 unpackI3x10_1x2(uint32 const & p)
+	GLM_FUNC_DECL void unpackI3x10_1x2(uint32 const * In, std::size_t InStride, ivec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packU3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packU3x10_1x2(uvec4 const & v)
+	GLM_FUNC_DECL void packU3x10_1x2(uvec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackU3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uvec4 unpackU3x10_1x2(uint32 const & p)
+	GLM_FUNC_DECL void unpackU3x10_1x2(uint32 const * In, std::size_t InStride, uvec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packSnorm3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packSnorm3x10_1x2(vec4 const & v)
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackSnorm3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm3x10_1x2(uint32 const & p)
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packUnorm3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packUnorm3x10_1x2(vec4 const & v)
+	GLM_FUNC_DECL void packUnorm3x10_1x2(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackUnorm3x10_1x2 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm3x10_1x2(uint32 const & p)
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Packs Count vectors of In with packF2x11_1x10 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see uint32 packF2x11_1x10(vec3 const & v)
+	GLM_FUNC_DECL void packF2x11_1x10(vec3 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count);
+
+	/// Unpacks Count values of In with unpackF2x11_1x10 and writes the results to Out, strides are in bytes, 0 for tightly packed arrays.
+	/// 
+	/// @see gtc_packing
+	/// @see vec3 unpackF2x11_1x10(uint32 const & p)
+	GLM_FUNC_DECL void unpackF2x11_1x10(uint32 const * In, std::size_t InStride, vec3 * Out, std::size_t OutStride, std::size_t Count);
+
 	/// @}
 }// namespace glm
 
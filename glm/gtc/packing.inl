@@ -32,6 +32,7 @@
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
 #include <cstring>
+#include <limits>
 
 namespace glm{
 namespace detail
@@ -161,9 +162,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 11) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 6))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed11ToFloat(x);
 
@@ -200,9 +201,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 10) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 5))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed10ToFloat(x);
 
@@ -244,6 +245,807 @@ namespace detail
 		uint32 pack;
 	};
 
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Same result as toFloat16, returned as sign extended 32-bit integers
+	GLM_FUNC_QUALIFIER __m128i sse_pack_half_ps(__m128 const & v)
+	{
+		__m128i const Bits = _mm_castps_si128(v);
+		__m128i const Abs = _mm_and_si128(Bits, _mm_set1_epi32(0x7fffffff));
+
+		// Normalized half: rebias the exponent, round "0.5" up, overflow to infinity
+		__m128i Normal = _mm_sub_epi32(_mm_srli_epi32(Abs, 13), _mm_set1_epi32((127 - 15) << 10));
+		Normal = _mm_add_epi32(Normal, _mm_and_si128(_mm_srli_epi32(Abs, 12), _mm_set1_epi32(1)));
+		__m128i const Overflow = _mm_cmpgt_epi32(Normal, _mm_set1_epi32(0x7bff));
+		Normal = _mm_or_si128(_mm_andnot_si128(Overflow, Normal), _mm_and_si128(Overflow, _mm_set1_epi32(0x7c00)));
+
+		// Denormalized half: |v| * 2^24 is exact, round "0.5" up
+		__m128 const Scaled = _mm_mul_ps(_mm_castsi128_ps(Abs), _mm_set1_ps(16777216.0f));
+		__m128i const Trunc = _mm_cvttps_epi32(Scaled);
+		__m128 const RoundUp = _mm_cmpge_ps(_mm_sub_ps(Scaled, _mm_cvtepi32_ps(Trunc)), _mm_set1_ps(0.5f));
+		__m128i const Denormal = _mm_sub_epi32(Trunc, _mm_castps_si128(RoundUp));
+
+		// NaN: preserve the 10 leftmost bits of the significand, at least one is set
+		__m128i const Significand = _mm_srli_epi32(_mm_and_si128(Abs, _mm_set1_epi32(0x007fffff)), 13);
+		__m128i const NaN = _mm_or_si128(
+			_mm_or_si128(Significand, _mm_set1_epi32(0x7c00)),
+			_mm_and_si128(_mm_cmpeq_epi32(Significand, _mm_setzero_si128()), _mm_set1_epi32(1)));
+
+		__m128i const IsNormal = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x387fffff));
+		__m128i const IsNaN = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x7f800000));
+		__m128i Result = _mm_or_si128(_mm_andnot_si128(IsNormal, Denormal), _mm_and_si128(IsNormal, Normal));
+		Result = _mm_or_si128(_mm_andnot_si128(IsNaN, Result), _mm_and_si128(IsNaN, NaN));
+		Result = _mm_or_si128(Result, _mm_and_si128(_mm_srli_epi32(Bits, 16), _mm_set1_epi32(0x8000)));
+
+		return _mm_srai_epi32(_mm_slli_epi32(Result, 16), 16);
+	}
+
+	// Same result as toFloat32, Half holds zero extended 16-bit values
+	GLM_FUNC_QUALIFIER __m128 sse_unpack_half_ps(__m128i const & Half)
+	{
+		__m128i const Abs = _mm_and_si128(Half, _mm_set1_epi32(0x7fff));
+
+		// Normalized half, infinity and NaN: rebias the exponent, twice for infinity and NaN
+		__m128i Normal = _mm_add_epi32(_mm_slli_epi32(Abs, 13), _mm_set1_epi32((127 - 15) << 23));
+		Normal = _mm_add_epi32(Normal, _mm_and_si128(_mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x7bff)), _mm_set1_epi32((127 - 15) << 23)));
+
+		// Zero and denormalized half: significand * 2^-24 is exact
+		__m128i const Denormal = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(Abs), _mm_set1_ps(5.9604644775390625e-8f)));
+
+		__m128i const IsNormal = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x03ff));
+		__m128i const Result = _mm_or_si128(_mm_andnot_si128(IsNormal, Denormal), _mm_and_si128(IsNormal, Normal));
+		return _mm_castsi128_ps(_mm_or_si128(Result, _mm_slli_epi32(_mm_and_si128(Half, _mm_set1_epi32(0x8000)), 16)));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_pack_half(float const * In, uint16 * Out)
+	{
+		__m128i const Low = sse_pack_half_ps(_mm_loadu_ps(In + 0));
+		__m128i const High = sse_pack_half_ps(_mm_loadu_ps(In + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_packs_epi32(Low, High));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_unpack_half(uint16 const * In, float * Out)
+	{
+		__m128i const Half = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+		_mm_storeu_ps(Out + 0, sse_unpack_half_ps(_mm_unpacklo_epi16(Half, _mm_setzero_si128())));
+		_mm_storeu_ps(Out + 4, sse_unpack_half_ps(_mm_unpackhi_epi16(Half, _mm_setzero_si128())));
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	// Convert 8 values at a time
+	struct compute_half_array
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const * In, uint16 * Out)
+		{
+#		if GLM_HAS_F16C
+			// F16C rounds ties to even while toFloat16 rounds them up: setting the lowest
+			// bit of finite values moves ties up without changing the other results.
+			// F16C also quiets the signaling NaNs so these values use the SSE2 code.
+			__m256 const Value = _mm256_loadu_ps(In);
+			if(_mm256_movemask_ps(_mm256_cmp_ps(Value, Value, _CMP_UNORD_Q)) == 0)
+			{
+				__m256 const Infinite = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), Value), _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ);
+				__m256 const Tie = _mm256_andnot_ps(Infinite, _mm256_castsi256_ps(_mm256_set1_epi32(1)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm256_cvtps_ph(_mm256_or_ps(Value, Tie), _MM_FROUND_TO_NEAREST_INT));
+				return;
+			}
+#		endif
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			sse_pack_half(In, Out);
+#		else
+			for(length_t i = 0; i < 8; ++i)
+				Out[i] = static_cast<uint16>(toFloat16(In[i]));
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const * In, float * Out)
+		{
+#		if GLM_HAS_F16C
+			// F16C quiets the signaling NaNs, toFloat32 preserves them
+			__m128i const Half = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+			__m128i const NaN = _mm_cmpgt_epi16(_mm_and_si128(Half, _mm_set1_epi16(0x7fff)), _mm_set1_epi16(0x7c00));
+			if(_mm_movemask_epi8(NaN) == 0)
+			{
+				_mm256_storeu_ps(Out, _mm256_cvtph_ps(Half));
+				return;
+			}
+#		endif
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			sse_unpack_half(In, Out);
+#		else
+			for(length_t i = 0; i < 8; ++i)
+				Out[i] = toFloat32(static_cast<hdata>(In[i]));
+#		endif
+		}
+	};
+
+	template <typename intType>
+	struct norm_traits{};
+
+	template <>
+	struct norm_traits<uint8>
+	{
+		static float min(){return 0.0f;}
+		static float scale(){return 255.0f;}
+		static float inverse(){return static_cast<float>(0.0039215686274509803921568627451);} // 1 / 255
+	};
+
+	template <>
+	struct norm_traits<int8>
+	{
+		static float min(){return -1.0f;}
+		static float scale(){return 127.0f;}
+		static float inverse(){return 0.00787401574803149606299212598425f;} // 1.0f / 127.0f
+	};
+
+	template <>
+	struct norm_traits<uint16>
+	{
+		static float min(){return 0.0f;}
+		static float scale(){return 65535.0f;}
+		static float inverse(){return 1.5259021896696421759365224689097e-5f;} // 1.0 / 65535.0
+	};
+
+	template <>
+	struct norm_traits<int16>
+	{
+		static float min(){return -1.0f;}
+		static float scale(){return 32767.0f;}
+		static float inverse(){return 3.0518509475997192297128208258309e-5f;} // 1.0f / 32767.0f
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Same result as int(round(clamp(v, Min, 1) * Scale))
+	GLM_FUNC_QUALIFIER __m128i sse_pack_norm_ps(__m128 const & v, __m128 const & Min, __m128 const & Scale)
+	{
+		__m128 const Value = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, Min), _mm_set1_ps(1.0f)), Scale);
+		__m128 const Half = _mm_or_ps(_mm_and_ps(Value, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+		return _mm_cvttps_epi32(_mm_add_ps(Value, Half));
+	}
+
+	// Narrow 16 integers to 8 or 16-bit with saturating packs, the values are already in range
+	GLM_FUNC_QUALIFIER void sse_narrow_epi32(__m128i const In[4], uint8 * Out)
+	{
+		__m128i const Low = _mm_packs_epi32(In[0], In[1]);
+		__m128i const High = _mm_packs_epi32(In[2], In[3]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_packus_epi16(Low, High));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_narrow_epi32(__m128i const In[4], int8 * Out)
+	{
+		__m128i const Low = _mm_packs_epi32(In[0], In[1]);
+		__m128i const High = _mm_packs_epi32(In[2], In[3]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_packs_epi16(Low, High));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_narrow_epi32(__m128i const In[4], uint16 * Out)
+	{
+		// SSE2 has no unsigned saturation from 32 to 16-bit, the values are biased instead
+		__m128i const Bias = _mm_set1_epi32(0x8000);
+		__m128i const Low = _mm_packs_epi32(_mm_sub_epi32(In[0], Bias), _mm_sub_epi32(In[1], Bias));
+		__m128i const High = _mm_packs_epi32(_mm_sub_epi32(In[2], Bias), _mm_sub_epi32(In[3], Bias));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 0), _mm_xor_si128(Low, _mm_set1_epi16(-0x8000)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 8), _mm_xor_si128(High, _mm_set1_epi16(-0x8000)));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_narrow_epi32(__m128i const In[4], int16 * Out)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 0), _mm_packs_epi32(In[0], In[1]));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 8), _mm_packs_epi32(In[2], In[3]));
+	}
+
+	// Widen 16 integers to 32-bit
+	GLM_FUNC_QUALIFIER void sse_widen_epi32(uint8 const * In, __m128i Out[4])
+	{
+		__m128i const Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+		__m128i const Low = _mm_unpacklo_epi8(Value, _mm_setzero_si128());
+		__m128i const High = _mm_unpackhi_epi8(Value, _mm_setzero_si128());
+		Out[0] = _mm_unpacklo_epi16(Low, _mm_setzero_si128());
+		Out[1] = _mm_unpackhi_epi16(Low, _mm_setzero_si128());
+		Out[2] = _mm_unpacklo_epi16(High, _mm_setzero_si128());
+		Out[3] = _mm_unpackhi_epi16(High, _mm_setzero_si128());
+	}
+
+	GLM_FUNC_QUALIFIER void sse_widen_epi32(int8 const * In, __m128i Out[4])
+	{
+		__m128i const Value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+		__m128i const Low = _mm_unpacklo_epi8(Value, Value);
+		__m128i const High = _mm_unpackhi_epi8(Value, Value);
+		Out[0] = _mm_srai_epi32(_mm_unpacklo_epi16(Low, Low), 24);
+		Out[1] = _mm_srai_epi32(_mm_unpackhi_epi16(Low, Low), 24);
+		Out[2] = _mm_srai_epi32(_mm_unpacklo_epi16(High, High), 24);
+		Out[3] = _mm_srai_epi32(_mm_unpackhi_epi16(High, High), 24);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_widen_epi32(uint16 const * In, __m128i Out[4])
+	{
+		__m128i const Low = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + 0));
+		__m128i const High = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + 8));
+		Out[0] = _mm_unpacklo_epi16(Low, _mm_setzero_si128());
+		Out[1] = _mm_unpackhi_epi16(Low, _mm_setzero_si128());
+		Out[2] = _mm_unpacklo_epi16(High, _mm_setzero_si128());
+		Out[3] = _mm_unpackhi_epi16(High, _mm_setzero_si128());
+	}
+
+	GLM_FUNC_QUALIFIER void sse_widen_epi32(int16 const * In, __m128i Out[4])
+	{
+		__m128i const Low = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + 0));
+		__m128i const High = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + 8));
+		Out[0] = _mm_srai_epi32(_mm_unpacklo_epi16(Low, Low), 16);
+		Out[1] = _mm_srai_epi32(_mm_unpackhi_epi16(Low, Low), 16);
+		Out[2] = _mm_srai_epi32(_mm_unpacklo_epi16(High, High), 16);
+		Out[3] = _mm_srai_epi32(_mm_unpackhi_epi16(High, High), 16);
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+#if(GLM_ARCH & GLM_ARCH_AVX2)
+	GLM_FUNC_QUALIFIER __m256i avx_pack_norm_ps(__m256 const & v, __m256 const & Min, __m256 const & Scale)
+	{
+		__m256 const Value = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(v, Min), _mm256_set1_ps(1.0f)), Scale);
+		__m256 const Half = _mm256_or_ps(_mm256_and_ps(Value, _mm256_set1_ps(-0.0f)), _mm256_set1_ps(0.5f));
+		return _mm256_cvttps_epi32(_mm256_add_ps(Value, Half));
+	}
+
+	// Widen 8 integers to 32-bit
+	GLM_FUNC_QUALIFIER __m256i avx_widen_epi32(uint8 const * In)
+	{
+		return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(In)));
+	}
+
+	GLM_FUNC_QUALIFIER __m256i avx_widen_epi32(int8 const * In)
+	{
+		return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(In)));
+	}
+
+	GLM_FUNC_QUALIFIER __m256i avx_widen_epi32(uint16 const * In)
+	{
+		return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In)));
+	}
+
+	GLM_FUNC_QUALIFIER __m256i avx_widen_epi32(int16 const * In)
+	{
+		return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In)));
+	}
+#endif//GLM_ARCH & GLM_ARCH_AVX2
+
+	// Convert 16 normalized values at a time, same results as packUnorm1x8, packSnorm1x8,
+	// packUnorm1x16 and packSnorm1x16 and their unpack functions
+	template <typename intType>
+	struct compute_norm_block
+	{
+		typedef intType int_type;
+
+		GLM_FUNC_QUALIFIER static void pack(float const * In, intType * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			__m256 const Min = _mm256_set1_ps(norm_traits<intType>::min());
+			__m256 const Scale = _mm256_set1_ps(norm_traits<intType>::scale());
+			__m256i const Low = avx_pack_norm_ps(_mm256_loadu_ps(In + 0), Min, Scale);
+			__m256i const High = avx_pack_norm_ps(_mm256_loadu_ps(In + 8), Min, Scale);
+			__m128i const Int[4] = {
+				_mm256_castsi256_si128(Low), _mm256_extracti128_si256(Low, 1),
+				_mm256_castsi256_si128(High), _mm256_extracti128_si256(High, 1)};
+			sse_narrow_epi32(Int, Out);
+#		elif(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128 const Min = _mm_set1_ps(norm_traits<intType>::min());
+			__m128 const Scale = _mm_set1_ps(norm_traits<intType>::scale());
+			__m128i const Int[4] = {
+				sse_pack_norm_ps(_mm_loadu_ps(In + 0), Min, Scale),
+				sse_pack_norm_ps(_mm_loadu_ps(In + 4), Min, Scale),
+				sse_pack_norm_ps(_mm_loadu_ps(In + 8), Min, Scale),
+				sse_pack_norm_ps(_mm_loadu_ps(In + 12), Min, Scale)};
+			sse_narrow_epi32(Int, Out);
+#		else
+			for(length_t i = 0; i < 16; ++i)
+				Out[i] = static_cast<intType>(round(clamp(In[i], norm_traits<intType>::min(), 1.0f) * norm_traits<intType>::scale()));
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(intType const * In, float * Out)
+		{
+			bool const Signed = std::numeric_limits<intType>::is_signed;
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			__m256 const Inverse = _mm256_set1_ps(norm_traits<intType>::inverse());
+			for(length_t i = 0; i < 16; i += 8)
+			{
+				__m256 Value = _mm256_mul_ps(_mm256_cvtepi32_ps(avx_widen_epi32(In + i)), Inverse);
+				if(Signed)
+					Value = _mm256_min_ps(_mm256_max_ps(Value, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+				_mm256_storeu_ps(Out + i, Value);
+			}
+#		elif(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128 const Inverse = _mm_set1_ps(norm_traits<intType>::inverse());
+			__m128i Int[4];
+			sse_widen_epi32(In, Int);
+			for(length_t i = 0; i < 4; ++i)
+			{
+				__m128 Value = _mm_mul_ps(_mm_cvtepi32_ps(Int[i]), Inverse);
+				if(Signed)
+					Value = _mm_min_ps(_mm_max_ps(Value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+				_mm_storeu_ps(Out + i * 4, Value);
+			}
+#		else
+			for(length_t i = 0; i < 16; ++i)
+			{
+				float const Value = static_cast<float>(In[i]) * norm_traits<intType>::inverse();
+				Out[i] = Signed ? clamp(Value, -1.0f, 1.0f) : Value;
+			}
+#		endif
+		}
+	};
+
+	// Convert 16 values at a time, same results as packHalf1x16 and unpackHalf1x16
+	struct compute_half_block
+	{
+		typedef uint16 int_type;
+
+		GLM_FUNC_QUALIFIER static void pack(float const * In, uint16 * Out)
+		{
+			compute_half_array::pack(In + 0, Out + 0);
+			compute_half_array::pack(In + 8, Out + 8);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const * In, float * Out)
+		{
+			compute_half_array::unpack(In + 0, Out + 0);
+			compute_half_array::unpack(In + 8, Out + 8);
+		}
+	};
+
+	// Formats storing each component in its own 8 or 16-bit integer: the components of
+	// 16 / C elements are gathered and converted together by blockType.
+	template <typename blockType, typename vecType, typename packType>
+	GLM_FUNC_QUALIFIER void pack_component_stream(vecType const * In, std::size_t InStride, packType * Out, std::size_t OutStride, std::size_t Count)
+	{
+		typedef typename blockType::int_type int_type;
+		std::size_t const Components = sizeof(vecType) / sizeof(float);
+		std::size_t const Elements = 16 / Components;
+
+		InStride = InStride ? InStride : sizeof(vecType);
+		OutStride = OutStride ? OutStride : sizeof(packType);
+		bool const Packed = InStride == sizeof(vecType) && OutStride == sizeof(packType);
+
+		char const * Src = reinterpret_cast<char const *>(In);
+		char * Dst = reinterpret_cast<char *>(Out);
+		for(std::size_t i = 0; i < Count; i += Elements)
+		{
+			std::size_t const Size = Count - i < Elements ? Count - i : Elements;
+			if(Packed && Size == Elements)
+			{
+				blockType::pack(reinterpret_cast<float const *>(Src + i * InStride), reinterpret_cast<int_type *>(Dst + i * OutStride));
+				continue;
+			}
+
+			float Values[16] = {0};
+			int_type Results[16];
+			for(std::size_t j = 0; j < Size; ++j)
+				memcpy(Values + j * Components, Src + (i + j) * InStride, sizeof(vecType));
+			blockType::pack(Values, Results);
+			for(std::size_t j = 0; j < Size; ++j)
+				memcpy(Dst + (i + j) * OutStride, Results + j * Components, sizeof(packType));
+		}
+	}
+
+	template <typename blockType, typename packType, typename vecType>
+	GLM_FUNC_QUALIFIER void unpack_component_stream(packType const * In, std::size_t InStride, vecType * Out, std::size_t OutStride, std::size_t Count)
+	{
+		typedef typename blockType::int_type int_type;
+		std::size_t const Components = sizeof(vecType) / sizeof(float);
+		std::size_t const Elements = 16 / Components;
+
+		InStride = InStride ? InStride : sizeof(packType);
+		OutStride = OutStride ? OutStride : sizeof(vecType);
+		bool const Packed = InStride == sizeof(packType) && OutStride == sizeof(vecType);
+
+		char const * Src = reinterpret_cast<char const *>(In);
+		char * Dst = reinterpret_cast<char *>(Out);
+		for(std::size_t i = 0; i < Count; i += Elements)
+		{
+			std::size_t const Size = Count - i < Elements ? Count - i : Elements;
+			if(Packed && Size == Elements)
+			{
+				blockType::unpack(reinterpret_cast<int_type const *>(Src + i * InStride), reinterpret_cast<float *>(Dst + i * OutStride));
+				continue;
+			}
+
+			int_type Values[16] = {0};
+			float Results[16];
+			for(std::size_t j = 0; j < Size; ++j)
+				memcpy(Values + j * Components, Src + (i + j) * InStride, sizeof(packType));
+			blockType::unpack(Values, Results);
+			for(std::size_t j = 0; j < Size; ++j)
+				memcpy(Dst + (i + j) * OutStride, Results + j * Components, sizeof(vecType));
+		}
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER void sse_load_soa(vec4 const In[4], __m128 Out[4])
+	{
+		Out[0] = _mm_loadu_ps(&In[0].x);
+		Out[1] = _mm_loadu_ps(&In[1].x);
+		Out[2] = _mm_loadu_ps(&In[2].x);
+		Out[3] = _mm_loadu_ps(&In[3].x);
+		_MM_TRANSPOSE4_PS(Out[0], Out[1], Out[2], Out[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_load_soa(vec3 const In[4], __m128 Out[3])
+	{
+		__m128 const a = _mm_loadu_ps(&In[0].x); // x0 y0 z0 x1
+		__m128 const b = _mm_loadu_ps(&In[0].x + 4); // y1 z1 x2 y2
+		__m128 const c = _mm_loadu_ps(&In[0].x + 8); // z2 x3 y3 z3
+		Out[0] = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		Out[1] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		Out[2] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_load_soa(ivec4 const In[4], __m128i Out[4])
+	{
+		__m128 Values[4];
+		sse_load_soa(reinterpret_cast<vec4 const *>(In), Values);
+		for(length_t i = 0; i < 4; ++i)
+			Out[i] = _mm_castps_si128(Values[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_load_soa(uvec4 const In[4], __m128i Out[4])
+	{
+		sse_load_soa(reinterpret_cast<ivec4 const *>(In), Out);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_store_soa(__m128 In[4], vec4 Out[4])
+	{
+		_MM_TRANSPOSE4_PS(In[0], In[1], In[2], In[3]);
+		_mm_storeu_ps(&Out[0].x, In[0]);
+		_mm_storeu_ps(&Out[1].x, In[1]);
+		_mm_storeu_ps(&Out[2].x, In[2]);
+		_mm_storeu_ps(&Out[3].x, In[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_store_soa(__m128 const In[3], vec3 Out[4])
+	{
+		__m128 const Low = _mm_unpacklo_ps(In[0], In[1]); // x0 y0 x1 y1
+		__m128 const High = _mm_unpackhi_ps(In[0], In[1]); // x2 y2 x3 y3
+		__m128 const a = _mm_shuffle_ps(Low, _mm_shuffle_ps(In[2], Low, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+		__m128 const b = _mm_shuffle_ps(_mm_shuffle_ps(In[1], In[2], _MM_SHUFFLE(1, 1, 1, 1)), High, _MM_SHUFFLE(1, 0, 2, 0));
+		__m128 const c = _mm_shuffle_ps(High, In[2], _MM_SHUFFLE(3, 2, 3, 2)); // x3 y3 z2 z3
+		_mm_storeu_ps(&Out[0].x, a);
+		_mm_storeu_ps(&Out[0].x + 4, b);
+		_mm_storeu_ps(&Out[0].x + 8, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 1, 0, 2)));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_store_soa(__m128i const In[4], ivec4 Out[4])
+	{
+		__m128 Values[4] = {_mm_castsi128_ps(In[0]), _mm_castsi128_ps(In[1]), _mm_castsi128_ps(In[2]), _mm_castsi128_ps(In[3])};
+		sse_store_soa(Values, reinterpret_cast<vec4 *>(Out));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_store_soa(__m128i const In[4], uvec4 Out[4])
+	{
+		sse_store_soa(In, reinterpret_cast<ivec4 *>(Out));
+	}
+
+	GLM_FUNC_QUALIFIER __m128i sse_select_si128(__m128i const & Mask, __m128i const & a, __m128i const & b)
+	{
+		return _mm_or_si128(_mm_and_si128(Mask, a), _mm_andnot_si128(Mask, b));
+	}
+
+	GLM_FUNC_QUALIFIER __m128i sse_pack_10_10_10_2(__m128i const & x, __m128i const & y, __m128i const & z, __m128i const & w)
+	{
+		__m128i const Mask = _mm_set1_epi32(0x3ff);
+		__m128i Result = _mm_and_si128(x, Mask);
+		Result = _mm_or_si128(Result, _mm_slli_epi32(_mm_and_si128(y, Mask), 10));
+		Result = _mm_or_si128(Result, _mm_slli_epi32(_mm_and_si128(z, Mask), 20));
+		return _mm_or_si128(Result, _mm_slli_epi32(w, 30));
+	}
+
+	GLM_FUNC_QUALIFIER void sse_unpack_10_10_10_2(__m128i const & p, bool Signed, __m128i Out[4])
+	{
+		if(Signed)
+		{
+			Out[0] = _mm_srai_epi32(_mm_slli_epi32(p, 22), 22);
+			Out[1] = _mm_srai_epi32(_mm_slli_epi32(p, 12), 22);
+			Out[2] = _mm_srai_epi32(_mm_slli_epi32(p, 2), 22);
+			Out[3] = _mm_srai_epi32(p, 30);
+		}
+		else
+		{
+			__m128i const Mask = _mm_set1_epi32(0x3ff);
+			Out[0] = _mm_and_si128(p, Mask);
+			Out[1] = _mm_and_si128(_mm_srli_epi32(p, 10), Mask);
+			Out[2] = _mm_and_si128(_mm_srli_epi32(p, 20), Mask);
+			Out[3] = _mm_srli_epi32(p, 30);
+		}
+	}
+
+	// Same result as floatTo11bit and floatTo10bit, Bits is the number of bits of the packed value
+	template <int Bits>
+	GLM_FUNC_QUALIFIER __m128i sse_pack_packed_float_ps(__m128 const & v)
+	{
+		int const Shift = 28 - Bits;
+		int const Infinity = 0x1f << (Bits - 5);
+		__m128i const f = _mm_castps_si128(v);
+
+		__m128i Result = _mm_and_si128(_mm_srli_epi32(_mm_sub_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000)), Shift), _mm_set1_epi32(Infinity));
+		Result = _mm_or_si128(Result, _mm_and_si128(_mm_srli_epi32(f, Shift), _mm_set1_epi32((1 << (Bits - 5)) - 1)));
+
+		__m128i const IsInf = _mm_cmpeq_epi32(_mm_and_si128(f, _mm_set1_epi32(0x7fffffff)), _mm_set1_epi32(0x7f800000));
+		Result = sse_select_si128(IsInf, _mm_set1_epi32(Infinity), Result);
+		Result = _mm_or_si128(Result, _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(v, v)), _mm_set1_epi32((1 << Bits) - 1)));
+		return _mm_andnot_si128(_mm_castps_si128(_mm_cmpeq_ps(v, _mm_setzero_ps())), Result);
+	}
+
+	// Same result as packed11bitToFloat and packed10bitToFloat, p holds zero extended values
+	template <int Bits>
+	GLM_FUNC_QUALIFIER __m128 sse_unpack_packed_float_ps(__m128i const & p)
+	{
+		int const Shift = 28 - Bits;
+		int const Infinity = 0x1f << (Bits - 5);
+
+		__m128i Result = _mm_and_si128(_mm_add_epi32(_mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(Infinity)), Shift), _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x7f800000));
+		Result = _mm_or_si128(Result, _mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32((1 << (Bits - 5)) - 1)), Shift));
+
+		Result = sse_select_si128(_mm_cmpeq_epi32(p, _mm_set1_epi32(Infinity)), _mm_set1_epi32(0x7f800000), Result);
+		Result = sse_select_si128(_mm_cmpeq_epi32(p, _mm_set1_epi32((1 << Bits) - 1)), _mm_set1_epi32(0x7fc00000), Result);
+		return _mm_castsi128_ps(_mm_andnot_si128(_mm_cmpeq_epi32(p, _mm_setzero_si128()), Result));
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	// Convert 4 elements at a time, same results as packUnorm3x10_1x2 and unpackUnorm3x10_1x2
+	struct compute_unorm3x10_1x2_block
+	{
+		typedef vec4 vec_type;
+
+		GLM_FUNC_QUALIFIER static void pack(vec4 const * In, uint32 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128 v[4];
+			sse_load_soa(In, v);
+			__m128 const Min = _mm_setzero_ps();
+			__m128 const Scale = _mm_set1_ps(1023.f);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), sse_pack_10_10_10_2(
+				sse_pack_norm_ps(v[0], Min, Scale),
+				sse_pack_norm_ps(v[1], Min, Scale),
+				sse_pack_norm_ps(v[2], Min, Scale),
+				sse_pack_norm_ps(v[3], Min, _mm_set1_ps(3.f))));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = packUnorm3x10_1x2(In[i]);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * In, vec4 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i p[4];
+			sse_unpack_10_10_10_2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In)), false, p);
+			__m128 v[4] = {
+				_mm_div_ps(_mm_cvtepi32_ps(p[0]), _mm_set1_ps(1023.f)),
+				_mm_div_ps(_mm_cvtepi32_ps(p[1]), _mm_set1_ps(1023.f)),
+				_mm_div_ps(_mm_cvtepi32_ps(p[2]), _mm_set1_ps(1023.f)),
+				_mm_div_ps(_mm_cvtepi32_ps(p[3]), _mm_set1_ps(3.f))};
+			sse_store_soa(v, Out);
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = unpackUnorm3x10_1x2(In[i]);
+#		endif
+		}
+	};
+
+	// Convert 4 elements at a time, same results as packSnorm3x10_1x2 and unpackSnorm3x10_1x2
+	struct compute_snorm3x10_1x2_block
+	{
+		typedef vec4 vec_type;
+
+		GLM_FUNC_QUALIFIER static void pack(vec4 const * In, uint32 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128 v[4];
+			sse_load_soa(In, v);
+			__m128 const Min = _mm_set1_ps(-1.0f);
+			__m128 const Scale = _mm_set1_ps(511.f);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), sse_pack_10_10_10_2(
+				sse_pack_norm_ps(v[0], Min, Scale),
+				sse_pack_norm_ps(v[1], Min, Scale),
+				sse_pack_norm_ps(v[2], Min, Scale),
+				sse_pack_norm_ps(v[3], Min, _mm_set1_ps(1.f))));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = packSnorm3x10_1x2(In[i]);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * In, vec4 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i p[4];
+			sse_unpack_10_10_10_2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In)), true, p);
+			__m128 v[4];
+			for(length_t i = 0; i < 4; ++i)
+			{
+				__m128 const Value = _mm_div_ps(_mm_cvtepi32_ps(p[i]), _mm_set1_ps(i < 3 ? 511.f : 1.f));
+				v[i] = _mm_min_ps(_mm_max_ps(Value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+			}
+			sse_store_soa(v, Out);
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = unpackSnorm3x10_1x2(In[i]);
+#		endif
+		}
+	};
+
+	// Convert 4 elements at a time, same results as packI3x10_1x2 and unpackI3x10_1x2
+	struct compute_i3x10_1x2_block
+	{
+		typedef ivec4 vec_type;
+
+		GLM_FUNC_QUALIFIER static void pack(ivec4 const * In, uint32 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i v[4];
+			sse_load_soa(In, v);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), sse_pack_10_10_10_2(v[0], v[1], v[2], v[3]));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = packI3x10_1x2(In[i]);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * In, ivec4 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i v[4];
+			sse_unpack_10_10_10_2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In)), true, v);
+			sse_store_soa(v, Out);
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = unpackI3x10_1x2(In[i]);
+#		endif
+		}
+	};
+
+	// Convert 4 elements at a time, same results as packU3x10_1x2 and unpackU3x10_1x2
+	struct compute_u3x10_1x2_block
+	{
+		typedef uvec4 vec_type;
+
+		GLM_FUNC_QUALIFIER static void pack(uvec4 const * In, uint32 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i v[4];
+			sse_load_soa(In, v);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), sse_pack_10_10_10_2(v[0], v[1], v[2], v[3]));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = packU3x10_1x2(In[i]);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * In, uvec4 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i v[4];
+			sse_unpack_10_10_10_2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In)), false, v);
+			sse_store_soa(v, Out);
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = unpackU3x10_1x2(In[i]);
+#		endif
+		}
+	};
+
+	// Convert 4 elements at a time, same results as packF2x11_1x10 and unpackF2x11_1x10
+	struct compute_f2x11_1x10_block
+	{
+		typedef vec3 vec_type;
+
+		GLM_FUNC_QUALIFIER static void pack(vec3 const * In, uint32 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128 v[3];
+			sse_load_soa(In, v);
+			__m128i const x = sse_pack_packed_float_ps<11>(v[0]);
+			__m128i const y = sse_pack_packed_float_ps<11>(v[1]);
+			__m128i const z = sse_pack_packed_float_ps<10>(v[2]);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_or_si128(_mm_or_si128(x, _mm_slli_epi32(y, 11)), _mm_slli_epi32(z, 22)));
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = packF2x11_1x10(In[i]);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint32 const * In, vec3 * Out)
+		{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			__m128i const p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In));
+			__m128 const v[3] = {
+				sse_unpack_packed_float_ps<11>(_mm_and_si128(p, _mm_set1_epi32(0x7ff))),
+				sse_unpack_packed_float_ps<11>(_mm_and_si128(_mm_srli_epi32(p, 11), _mm_set1_epi32(0x7ff))),
+				sse_unpack_packed_float_ps<10>(_mm_srli_epi32(p, 22))};
+			sse_store_soa(v, Out);
+#		else
+			for(length_t i = 0; i < 4; ++i)
+				Out[i] = unpackF2x11_1x10(In[i]);
+#		endif
+		}
+	};
+
+	// Strided elements are copied through a plain component buffer, vectors aren't trivially copyable
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void load_stream_element(char const * Src, vecType & Out)
+	{
+		typename vecType::value_type Components[4];
+		memcpy(Components, Src, sizeof(vecType));
+		for(length_t c = 0; c < Out.length(); ++c)
+			Out[c] = Components[c];
+	}
+
+	template <typename vecType>
+	GLM_FUNC_QUALIFIER void store_stream_element(vecType const & In, char * Dst)
+	{
+		typename vecType::value_type Components[4];
+		for(length_t c = 0; c < In.length(); ++c)
+			Components[c] = In[c];
+		memcpy(Dst, Components, sizeof(vecType));
+	}
+
+	// Formats packing a whole element in a 32-bit integer: blockType converts 4 elements at a time.
+	template <typename blockType>
+	GLM_FUNC_QUALIFIER void pack_element_stream(typename blockType::vec_type const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		typedef typename blockType::vec_type vec_type;
+
+		InStride = InStride ? InStride : sizeof(vec_type);
+		OutStride = OutStride ? OutStride : sizeof(uint32);
+		bool const Packed = InStride == sizeof(vec_type) && OutStride == sizeof(uint32);
+
+		char const * Src = reinterpret_cast<char const *>(In);
+		char * Dst = reinterpret_cast<char *>(Out);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const Size = Count - i < 4 ? Count - i : 4;
+			if(Packed && Size == 4)
+			{
+				blockType::pack(reinterpret_cast<vec_type const *>(Src + i * InStride), reinterpret_cast<uint32 *>(Dst + i * OutStride));
+				continue;
+			}
+
+			vec_type Values[4] = {vec_type(0), vec_type(0), vec_type(0), vec_type(0)};
+			uint32 Results[4];
+			for(std::size_t j = 0; j < Size; ++j)
+				load_stream_element(Src + (i + j) * InStride, Values[j]);
+			blockType::pack(Values, Results);
+			for(std::size_t j = 0; j < Size; ++j)
+				memcpy(Dst + (i + j) * OutStride, &Results[j], sizeof(uint32));
+		}
+	}
+
+	template <typename blockType>
+	GLM_FUNC_QUALIFIER void unpack_element_stream(uint32 const * In, std::size_t InStride, typename blockType::vec_type * Out, std::size_t OutStride, std::size_t Count)
+	{
+		typedef typename blockType::vec_type vec_type;
+
+		InStride = InStride ? InStride : sizeof(uint32);
+		OutStride = OutStride ? OutStride : sizeof(vec_type);
+		bool const Packed = InStride == sizeof(uint32) && OutStride == sizeof(vec_type);
+
+		char const * Src = reinterpret_cast<char const *>(In);
+		char * Dst = reinterpret_cast<char *>(Out);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			std::size_t const Size = Count - i < 4 ? Count - i : 4;
+			if(Packed && Size == 4)
+			{
+				blockType::unpack(reinterpret_cast<uint32 const *>(Src + i * InStride), reinterpret_cast<vec_type *>(Dst + i * OutStride));
+				continue;
+			}
+
+			uint32 Values[4] = {0, 0, 0, 0};
+			vec_type Results[4];
+			for(std::size_t j = 0; j < Size; ++j)
+				memcpy(&Values[j], Src + (i + j) * InStride, sizeof(uint32));
+			blockType::unpack(Values, Results);
+			for(std::size_t j = 0; j < Size; ++j)
+				store_stream_element(Results[j], Dst + (i + j) * OutStride);
+		}
+	}
 }//namespace detail
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
@@ -279,7 +1081,7 @@ namespace detail
 	
 	GLM_FUNC_QUALIFIER float unpackSnorm1x8(uint8 p)
 	{
-		float Unpack(static_cast<float>(*const_cast<uint8*>(&p)));
+		float Unpack(static_cast<float>(*reinterpret_cast<int8*>(&p)));
 		return clamp(
 			Unpack * 0.00787401574803149606299212598425f, // 1.0f / 127.0f
 			-1.0f, 1.0f);
@@ -333,7 +1135,7 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER float unpackSnorm1x16(uint16 p)
 	{
-		float Unpack = static_cast<float>(*const_cast<uint16*>(&p));
+		float Unpack = static_cast<float>(*reinterpret_cast<int16*>(&p));
 		return clamp(
 			Unpack * 3.0518509475997192297128208258309e-5f, //1.0f / 32767.0f, 
 			-1.0f, 1.0f);
@@ -391,6 +1193,28 @@ namespace detail
 			detail::toFloat32(Unpack.w));
 	}
 
+	GLM_FUNC_QUALIFIER void packHalf(float const * In, uint16 * Out, std::size_t Count)
+	{
+		std::size_t const End = Count - Count % 8;
+		for(std::size_t i = 0; i < End; i += 8)
+			detail::compute_half_array::pack(In + i, Out + i);
+
+		std::size_t const Remaining = Count - End;
+		for(std::size_t j = 0; j < Remaining; ++j)
+			Out[End + j] = static_cast<uint16>(detail::toFloat16(In[End + j]));
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const * In, float * Out, std::size_t Count)
+	{
+		std::size_t const End = Count - Count % 8;
+		for(std::size_t i = 0; i < End; i += 8)
+			detail::compute_half_array::unpack(In + i, Out + i);
+
+		std::size_t const Remaining = Count - End;
+		for(std::size_t j = 0; j < Remaining; ++j)
+			Out[End + j] = detail::toFloat32(static_cast<detail::hdata>(In[End + j]));
+	}
+
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const & v)
 	{
 		detail::i10i10i10i2 Result;
@@ -457,17 +1281,17 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 packUnorm3x10_1x2(vec4 const & v)
 	{
-		detail::i10i10i10i2 Result;
-		Result.data.x = int(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
-		Result.data.y = int(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
-		Result.data.z = int(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
-		Result.data.w = int(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
+		detail::u10u10u10u2 Result;
+		Result.data.x = uint(round(clamp(v.x, 0.0f, 1.0f) * 1023.f));
+		Result.data.y = uint(round(clamp(v.y, 0.0f, 1.0f) * 1023.f));
+		Result.data.z = uint(round(clamp(v.z, 0.0f, 1.0f) * 1023.f));
+		Result.data.w = uint(round(clamp(v.w, 0.0f, 1.0f) *    3.f));
 		return Result.pack;
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm3x10_1x2(uint32 v)
 	{
-		detail::i10i10i10i2 Unpack;
+		detail::u10u10u10u2 Unpack;
 		Unpack.pack = v;
 		vec4 Result;
 		Result.x = float(Unpack.data.x) / 1023.f;
@@ -488,9 +1312,209 @@ namespace detail
 	GLM_FUNC_QUALIFIER vec3 unpackF2x11_1x10(uint32 v)
 	{
 		return vec3(
-			detail::packed11bitToFloat(v >> 0), 
-			detail::packed11bitToFloat(v >> 11), 
-			detail::packed10bitToFloat(v >> 22));
+			detail::packed11bitToFloat((v >>  0) & ((1 << 11) - 1)),
+			detail::packed11bitToFloat((v >> 11) & ((1 << 11) - 1)),
+			detail::packed10bitToFloat((v >> 22) & ((1 << 10) - 1)));
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x8(float const * In, std::size_t InStride, uint8 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<uint8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x8(uint8 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<uint8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x8(float const * In, std::size_t InStride, uint8 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<int8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x8(uint8 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<int8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm2x8(vec2 const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<uint8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm2x8(uint16 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<uint8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm2x8(vec2 const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<int8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm2x8(uint16 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<int8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x8(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<uint8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<uint8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x8(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<int8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x8(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<int8> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x16(float const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<uint16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x16(uint16 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<uint16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x16(float const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<int16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x16(uint16 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<int16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm2x16(vec2 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<uint16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm2x16(uint32 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<uint16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm2x16(vec2 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<int16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm2x16(uint32 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<int16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x16(vec4 const * In, std::size_t InStride, uint64 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<uint16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x16(uint64 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<uint16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x16(vec4 const * In, std::size_t InStride, uint64 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_norm_block<int16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x16(uint64 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_norm_block<int16> >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf1x16(float const * In, std::size_t InStride, uint16 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_half_block >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf1x16(uint16 const * In, std::size_t InStride, float * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_half_block >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf2x16(vec2 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_half_block >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf2x16(uint32 const * In, std::size_t InStride, vec2 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_half_block >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf4x16(vec4 const * In, std::size_t InStride, uint64 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_component_stream<detail::compute_half_block >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf4x16(uint64 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_component_stream<detail::compute_half_block >(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packI3x10_1x2(ivec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_element_stream<detail::compute_i3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackI3x10_1x2(uint32 const * In, std::size_t InStride, ivec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_element_stream<detail::compute_i3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packU3x10_1x2(uvec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_element_stream<detail::compute_u3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackU3x10_1x2(uint32 const * In, std::size_t InStride, uvec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_element_stream<detail::compute_u3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_element_stream<detail::compute_snorm3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_element_stream<detail::compute_snorm3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_element_stream<detail::compute_unorm3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const * In, std::size_t InStride, vec4 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_element_stream<detail::compute_unorm3x10_1x2_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10(vec3 const * In, std::size_t InStride, uint32 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::pack_element_stream<detail::compute_f2x11_1x10_block>(In, InStride, Out, OutStride, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10(uint32 const * In, std::size_t InStride, vec3 * Out, std::size_t OutStride, std::size_t Count)
+	{
+		detail::unpack_element_stream<detail::compute_f2x11_1x10_block>(In, InStride, Out, OutStride, Count);
 	}
 
 }//namespace glm
@@ -34,6 +34,9 @@
 /// 
 /// @brief Generate random number from various distribution methods.
 /// 
+/// The functions without an engine parameter draw from defaultRandomEngine() instead of std::rand,
+/// std::srand has no effect on them.
+/// 
 /// <glm/gtc/random.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -42,6 +45,7 @@
 // Dependency:
 #include "../vec2.hpp"
 #include "../vec3.hpp"
+#include "../detail/type_int.hpp"
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -51,7 +55,59 @@ namespace glm
 {
 	/// @addtogroup gtc_random
 	/// @{
-	
+
+	/// xoshiro128+ pseudo random number generator with a period of 2^128 - 1.
+	/// Its upper bits, used for the floating-point conversions, are of the best quality.
+	/// Usable as a C++11 uniform random bit generator.
+	/// @see gtc_random
+	class xoshiro128plus
+	{
+	public:
+		typedef uint32 result_type;
+
+		/// Initialize the state from Seed with splitmix64
+		GLM_FUNC_DECL explicit xoshiro128plus(uint64 Seed = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+		GLM_FUNC_DECL result_type operator()();
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR result_type (min)();
+		GLM_FUNC_DECL static GLM_CONSTEXPR result_type (max)();
+
+	private:
+		uint32 State[4];
+	};
+
+	/// PCG32 (XSH RR variant) pseudo random number generator with a period of 2^64.
+	/// Engines built with the same Seed but different Stream values produce independent sequences.
+	/// Usable as a C++11 uniform random bit generator.
+	/// @see gtc_random
+	class pcg32
+	{
+	public:
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL explicit pcg32(uint64 Seed = 0, uint64 Stream = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed, uint64 Stream = 0);
+		GLM_FUNC_DECL result_type operator()();
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR result_type (min)();
+		GLM_FUNC_DECL static GLM_CONSTEXPR result_type (max)();
+
+	private:
+		uint64 State;
+		uint64 Increment;
+	};
+
+	/// Engine of the calling thread used by the functions that don't take an engine.
+	/// Each thread engine is seeded on first use from a different stream.
+	/// Use defaultRandomEngine().seed(Seed) to reseed the calling thread engine, std::srand doesn't seed it.
+	/// Without compiler support for thread_local, a single engine is shared by all threads
+	/// and the engine overloads must be used for multithreaded code.
+	/// @see gtc_random
+	GLM_FUNC_DECL xoshiro128plus & defaultRandomEngine();
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution 
 	/// 
 	/// @param Min 
@@ -63,15 +119,57 @@ namespace glm
 		genType const & Min,
 		genType const & Max);
 
-	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution 
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution,
+	/// using Engine which must produce uniformly distributed 32 bits integers.
+	/// The upper bits of each value are used, engines with a smaller range such as std::minstd_rand
+	/// or std::rand wrappers never reach Max and give biased results.
+	/// 
+	/// @param Min 
+	/// @param Max 
+	/// @param Engine xoshiro128plus, pcg32 or any engine returning full 32 bits values in [0, 2^32 - 1] such as std::mt19937.
+	/// @tparam genType Value type. Currently supported: float or double scalars and vectors.
+	/// @see gtc_random
+	template <typename genType, typename engineType>
+	GLM_FUNC_DECL genType linearRand(
+		genType const & Min,
+		genType const & Max,
+		engineType & Engine);
+
+	/// @see gtc_random
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_DECL vecType<T, P> linearRand(
+		vecType<T, P> const & Min,
+		vecType<T, P> const & Max,
+		engineType & Engine);
+
+	/// Generate random numbers according a gaussian distribution 
 	/// 
 	/// @param Mean
-	/// @param Deviation
+	/// @param Deviation Standard deviation of the distribution
 	/// @see gtc_random
 	template <typename genType>
 	GLM_FUNC_DECL genType gaussRand(
 		genType const & Mean,
 		genType const & Deviation);
+
+	/// Generate random numbers according a gaussian distribution using Engine
+	/// 
+	/// @param Mean
+	/// @param Deviation Standard deviation of the distribution
+	/// @param Engine
+	/// @see gtc_random
+	template <typename genType, typename engineType>
+	GLM_FUNC_DECL genType gaussRand(
+		genType const & Mean,
+		genType const & Deviation,
+		engineType & Engine);
+
+	/// @see gtc_random
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_DECL vecType<T, P> gaussRand(
+		vecType<T, P> const & Mean,
+		vecType<T, P> const & Deviation,
+		engineType & Engine);
 	
 	/// Generate a random 2D vector which coordinates are regulary distributed on a circle of a given radius
 	/// 
@@ -80,6 +178,16 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL detail::tvec2<T, defaultp> circularRand(
 		T const & Radius);
+
+	/// Generate a random 2D vector on a circle of a given radius using Engine
+	/// 
+	/// @param Radius
+	/// @param Engine
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL detail::tvec2<T, defaultp> circularRand(
+		T const & Radius,
+		engineType & Engine);
 	
 	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius
 	/// 
@@ -88,6 +196,16 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL detail::tvec3<T, defaultp> sphericalRand(
 		T const & Radius);
+
+	/// Generate a random 3D vector on a sphere of a given radius using Engine
+	/// 
+	/// @param Radius
+	/// @param Engine
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL detail::tvec3<T, defaultp> sphericalRand(
+		T const & Radius,
+		engineType & Engine);
 	
 	/// Generate a random 2D vector which coordinates are regulary distributed within the area of a disk of a given radius
 	/// 
@@ -96,6 +214,16 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL detail::tvec2<T, defaultp> diskRand(
 		T const & Radius);
+
+	/// Generate a random 2D vector within the area of a disk of a given radius using Engine
+	/// 
+	/// @param Radius
+	/// @param Engine
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL detail::tvec2<T, defaultp> diskRand(
+		T const & Radius,
+		engineType & Engine);
 	
 	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius
 	/// 
@@ -104,6 +232,16 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_DECL detail::tvec3<T, defaultp> ballRand(
 		T const & Radius);
+
+	/// Generate a random 3D vector within the volume of a ball of a given radius using Engine
+	/// 
+	/// @param Radius
+	/// @param Engine
+	/// @see gtc_random
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL detail::tvec3<T, defaultp> ballRand(
+		T const & Radius,
+		engineType & Engine);
 	
 	/// @}
 }//namespace glm
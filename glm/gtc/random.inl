@@ -28,43 +28,175 @@
 
 #include "../geometric.hpp"
 #include "../exponential.hpp"
-#include <cstdlib>
-#include <ctime>
 #include <cassert>
+#if(GLM_HAS_THREAD_LOCAL)
+#	include <atomic>
+#endif
 
 namespace glm{
 namespace detail
 {
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64 & State)
+	{
+		uint64 z = (State += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	template <typename T>
 	struct compute_linearRand
+	{};
+
+	template <>
+	struct compute_linearRand<float>
 	{
-		template <typename T>
-		GLM_FUNC_QUALIFIER T operator() (T const & Min, T const & Max) const;
-/*
+		// 24 random bits mapped on [Min, Max]
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static float call(float const & Min, float const & Max, engineType & Engine)
 		{
-			GLM_STATIC_ASSERT(0, "'linearRand' invalid template parameter type. GLM_GTC_random only supports floating-point template types.");
-			return Min;
+			uint32 const Bits = static_cast<uint32>(Engine()) >> 8;
+			return float(Bits) * (1.0f / 16777215.0f) * (Max - Min) + Min;
 		}
-*/
 	};
 
 	template <>
-	GLM_FUNC_QUALIFIER float compute_linearRand::operator()<float> (float const & Min, float const & Max) const
+	struct compute_linearRand<double>
 	{
-		return float(std::rand()) / float(RAND_MAX) * (Max - Min) + Min;
-	}
+		// 53 random bits mapped on [Min, Max]
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static double call(double const & Min, double const & Max, engineType & Engine)
+		{
+			uint64 const High = static_cast<uint32>(Engine()) >> 5;
+			uint64 const Low = static_cast<uint32>(Engine()) >> 6;
+			return double((High << 26) | Low) * (1.0 / 9007199254740991.0) * (Max - Min) + Min;
+		}
+	};
 
 	template <>
-	GLM_FUNC_QUALIFIER double compute_linearRand::operator()<double> (double const & Min, double const & Max) const
+	struct compute_linearRand<long double>
+	{
+		template <typename engineType>
+		GLM_FUNC_QUALIFIER static long double call(long double const & Min, long double const & Max, engineType & Engine)
+		{
+			return static_cast<long double>(compute_linearRand<double>::call(0.0, 1.0, Engine)) * (Max - Min) + Min;
+		}
+	};
+}//namespace detail
+
+	// xoshiro128plus
+	GLM_FUNC_QUALIFIER xoshiro128plus::xoshiro128plus(uint64 Seed)
 	{
-		return double(std::rand()) / double(RAND_MAX) * (Max - Min) + Min;
+		this->seed(Seed);
 	}
 
-	template <>
-	GLM_FUNC_QUALIFIER long double compute_linearRand::operator()<long double> (long double const & Min, long double const & Max) const
+	GLM_FUNC_QUALIFIER void xoshiro128plus::seed(uint64 Seed)
 	{
-		return (long double)(std::rand()) / (long double)(RAND_MAX) * (Max - Min) + Min;
+		uint64 const A = detail::splitmix64(Seed);
+		uint64 const B = detail::splitmix64(Seed);
+		this->State[0] = static_cast<uint32>(A);
+		this->State[1] = static_cast<uint32>(A >> 32);
+		this->State[2] = static_cast<uint32>(B);
+		this->State[3] = static_cast<uint32>(B >> 32);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128plus::result_type xoshiro128plus::operator()()
+	{
+		uint32 const Result = this->State[0] + this->State[3];
+		uint32 const t = this->State[1] << 9;
+
+		this->State[2] ^= this->State[0];
+		this->State[3] ^= this->State[1];
+		this->State[1] ^= this->State[2];
+		this->State[0] ^= this->State[3];
+		this->State[2] ^= t;
+		this->State[3] = (this->State[3] << 11) | (this->State[3] >> 21);
+
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR xoshiro128plus::result_type (xoshiro128plus::min)()
+	{
+		return 0;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR xoshiro128plus::result_type (xoshiro128plus::max)()
+	{
+		return 0xFFFFFFFF;
+	}
+
+	// pcg32
+	GLM_FUNC_QUALIFIER pcg32::pcg32(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void pcg32::seed(uint64 Seed, uint64 Stream)
+	{
+		this->State = 0;
+		this->Increment = (Stream << 1) | 1;
+		(*this)();
+		this->State += Seed;
+		(*this)();
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::result_type pcg32::operator()()
+	{
+		uint64 const Old = this->State;
+		this->State = Old * 6364136223846793005ull + this->Increment;
+
+		uint32 const XorShifted = static_cast<uint32>(((Old >> 18) ^ Old) >> 27);
+		uint32 const Rot = static_cast<uint32>(Old >> 59);
+		return (XorShifted >> Rot) | (XorShifted << ((0 - Rot) & 31));
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR pcg32::result_type (pcg32::min)()
+	{
+		return 0;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR pcg32::result_type (pcg32::max)()
+	{
+		return 0xFFFFFFFF;
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128plus & defaultRandomEngine()
+	{
+#		if(GLM_HAS_THREAD_LOCAL)
+			// The first thread to draw a number gets the stream 0, hence the same sequence on every run
+			static std::atomic<uint64> ThreadCount(0);
+			thread_local xoshiro128plus Engine(ThreadCount++);
+#		else
+			static xoshiro128plus Engine(0);
+#		endif
+		return Engine;
+	}
+
+	// linearRand
+	template <typename genType, typename engineType>
+	GLM_FUNC_QUALIFIER genType linearRand
+	(
+		genType const & Min,
+		genType const & Max,
+		engineType & Engine
+	)
+	{
+		return detail::compute_linearRand<genType>::call(Min, Max, Engine);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_QUALIFIER vecType<T, P> linearRand
+	(
+		vecType<T, P> const & Min,
+		vecType<T, P> const & Max,
+		engineType & Engine
+	)
+	{
+		vecType<T, P> Result;
+		for(length_t i = 0; i < Result.length(); ++i)
+			Result[i] = detail::compute_linearRand<T>::call(Min[i], Max[i], Engine);
+		return Result;
 	}
-}//namespace detail
 
 	template <typename genType> 
 	GLM_FUNC_QUALIFIER genType linearRand
@@ -73,37 +205,64 @@ namespace detail
 		genType const & Max
 	)
 	{
-		return detail::compute_linearRand()(Min, Max);
+		return linearRand(Min, Max, defaultRandomEngine());
 	}
 
 	VECTORIZE_VEC_VEC(linearRand)
 
-	template <typename genType> 
+	// gaussRand
+	template <typename genType, typename engineType>
 	GLM_FUNC_QUALIFIER genType gaussRand
 	(
-		genType const & Mean,	
-		genType const & Deviation
+		genType const & Mean,
+		genType const & Deviation,
+		engineType & Engine
 	)
 	{
 		genType w, x1, x2;
 	
 		do
 		{
-			x1 = linearRand(genType(-1), genType(1));
-			x2 = linearRand(genType(-1), genType(1));
+			x1 = linearRand(genType(-1), genType(1), Engine);
+			x2 = linearRand(genType(-1), genType(1), Engine);
 		
 			w = x1 * x1 + x2 * x2;
 		} while(w > genType(1));
 	
-		return x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
+		return x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_QUALIFIER vecType<T, P> gaussRand
+	(
+		vecType<T, P> const & Mean,
+		vecType<T, P> const & Deviation,
+		engineType & Engine
+	)
+	{
+		vecType<T, P> Result;
+		for(length_t i = 0; i < Result.length(); ++i)
+			Result[i] = gaussRand(Mean[i], Deviation[i], Engine);
+		return Result;
+	}
+
+	template <typename genType> 
+	GLM_FUNC_QUALIFIER genType gaussRand
+	(
+		genType const & Mean,	
+		genType const & Deviation
+	)
+	{
+		return gaussRand(Mean, Deviation, defaultRandomEngine());
 	}
 
 	VECTORIZE_VEC_VEC(gaussRand)
 
-	template <typename T>
+	template <typename T, typename engineType>
 	GLM_FUNC_QUALIFIER detail::tvec2<T, defaultp> diskRand
 	(
-		T const & Radius
+		T const & Radius,
+		engineType & Engine
 	)
 	{		
 		detail::tvec2<T, defaultp> Result(T(0));
@@ -113,7 +272,8 @@ namespace detail
 		{
 			Result = linearRand(
 				detail::tvec2<T, defaultp>(-Radius),
-				detail::tvec2<T, defaultp>(Radius));
+				detail::tvec2<T, defaultp>(Radius),
+				Engine);
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
@@ -121,10 +281,11 @@ namespace detail
 		return Result;
 	}
 	
-	template <typename T>
+	template <typename T, typename engineType>
 	GLM_FUNC_QUALIFIER detail::tvec3<T, defaultp> ballRand
 	(
-		T const & Radius
+		T const & Radius,
+		engineType & Engine
 	)
 	{		
 		detail::tvec3<T, defaultp> Result(T(0));
@@ -134,7 +295,8 @@ namespace detail
 		{
 			Result = linearRand(
 				detail::tvec3<T, defaultp>(-Radius),
-				detail::tvec3<T, defaultp>(Radius));
+				detail::tvec3<T, defaultp>(Radius),
+				Engine);
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
@@ -142,24 +304,26 @@ namespace detail
 		return Result;
 	}
 	
-	template <typename T>
+	template <typename T, typename engineType>
 	GLM_FUNC_QUALIFIER detail::tvec2<T, defaultp> circularRand
 	(
-		T const & Radius
+		T const & Radius,
+		engineType & Engine
 	)
 	{
-		T a = linearRand(T(0), T(6.283185307179586476925286766559f));
+		T a = linearRand(T(0), T(6.283185307179586476925286766559f), Engine);
 		return detail::tvec2<T, defaultp>(cos(a), sin(a)) * Radius;		
 	}
 	
-	template <typename T>
+	template <typename T, typename engineType>
 	GLM_FUNC_QUALIFIER detail::tvec3<T, defaultp> sphericalRand
 	(
-		T const & Radius
+		T const & Radius,
+		engineType & Engine
 	)
 	{
-		T z = linearRand(T(-1), T(1));
-		T a = linearRand(T(0), T(6.283185307179586476925286766559f));
+		T z = linearRand(T(-1), T(1), Engine);
+		T a = linearRand(T(0), T(6.283185307179586476925286766559f), Engine);
 	
 		T r = sqrt(T(1) - z * z);
 	
@@ -168,4 +332,40 @@ namespace detail
 	
 		return detail::tvec3<T, defaultp>(x, y, z) * Radius;	
 	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER detail::tvec2<T, defaultp> diskRand
+	(
+		T const & Radius
+	)
+	{
+		return diskRand(Radius, defaultRandomEngine());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER detail::tvec3<T, defaultp> ballRand
+	(
+		T const & Radius
+	)
+	{
+		return ballRand(Radius, defaultRandomEngine());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER detail::tvec2<T, defaultp> circularRand
+	(
+		T const & Radius
+	)
+	{
+		return circularRand(Radius, defaultRandomEngine());
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER detail::tvec3<T, defaultp> sphericalRand
+	(
+		T const & Radius
+	)
+	{
+		return sphericalRand(Radius, defaultRandomEngine());
+	}
 }//namespace glm
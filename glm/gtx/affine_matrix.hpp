@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_affine_matrix
+/// @file glm/gtx/affine_matrix.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_affine_matrix GLM_GTX_affine_matrix
+/// @ingroup gtx
+///
+/// @brief Affine transformations stored in 3x4 matrices.
+///
+/// The columns of the mat3x4 are the 3 first rows of the equivalent mat4, like
+/// the result of mat3x4_cast for dual quaternions: 48 bytes instead of 64 and
+/// 36 multiplies to compose two transformations instead of 64. Each column is a
+/// row of the transformation so float transformations use SSE2 registers
+/// directly.
+///
+/// <glm/gtx/affine_matrix.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/intrinsic_geometric.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_affine_matrix extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_affine_matrix
+	/// @{
+
+	/// Store the 3 first rows of an affine mat4, such as the result of translate, rotate or scale.
+	/// The last row of m is ignored and assumed to be (0, 0, 0, 1).
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tmat3x4<T, P> mat3x4_cast(
+		detail::tmat4x4<T, P> const & m);
+
+	/// Expand an affine transformation to a mat4.
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tmat4x4<T, P> mat4_cast(
+		detail::tmat3x4<T, P> const & m);
+
+	/// Compose two affine transformations: b is applied first, then a.
+	/// Same result as mat4_cast(a) * mat4_cast(b).
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tmat3x4<T, P> affineCompose(
+		detail::tmat3x4<T, P> const & a,
+		detail::tmat3x4<T, P> const & b);
+
+	/// Inverse of an affine transformation.
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tmat3x4<T, P> affineInverse(
+		detail::tmat3x4<T, P> const & m);
+
+	/// Transform a point, with the translation.
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tvec3<T, P> affineTransformPoint(
+		detail::tmat3x4<T, P> const & m,
+		detail::tvec3<T, P> const & p);
+
+	/// Transform a direction, without the translation.
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tvec3<T, P> affineTransformVector(
+		detail::tmat3x4<T, P> const & m,
+		detail::tvec3<T, P> const & v);
+
+	/// Transform a normal by the inverse transpose of the linear part of m.
+	/// The result isn't normalized.
+	/// @see gtx_affine_matrix
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tvec3<T, P> affineTransformNormal(
+		detail::tmat3x4<T, P> const & m,
+		detail::tvec3<T, P> const & n);
+
+	/// @}
+}//namespace glm
+
+#include "affine_matrix.inl"
@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/affine_matrix.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_affine_matrix
+	{
+		// Row i of a * b: the rows of b weighted by row i of a, the last row of b is (0, 0, 0, 1)
+		GLM_FUNC_QUALIFIER static tmat3x4<T, P> compose(tmat3x4<T, P> const & a, tmat3x4<T, P> const & b)
+		{
+			tmat3x4<T, P> Result(tmat3x4<T, P>::_null);
+			for(length_t i = 0; i < 3; ++i)
+			{
+				Result[i] = b[0] * a[i].x + b[1] * a[i].y + b[2] * a[i].z;
+				Result[i].w += a[i].w;
+			}
+			return Result;
+		}
+
+		// The columns of the inverse of the linear part are the cross products of its rows
+		GLM_FUNC_QUALIFIER static tmat3x4<T, P> inverse(tmat3x4<T, P> const & m)
+		{
+			tvec3<T, P> const Row0(m[0]);
+			tvec3<T, P> const Row1(m[1]);
+			tvec3<T, P> const Row2(m[2]);
+
+			T const OneOverDeterminant = static_cast<T>(1) / dot(Row0, cross(Row1, Row2));
+			tvec3<T, P> const Column0(cross(Row1, Row2) * OneOverDeterminant);
+			tvec3<T, P> const Column1(cross(Row2, Row0) * OneOverDeterminant);
+			tvec3<T, P> const Column2(cross(Row0, Row1) * OneOverDeterminant);
+			tvec3<T, P> const Translation(-(Column0 * m[0].w + Column1 * m[1].w + Column2 * m[2].w));
+
+			return tmat3x4<T, P>(
+				Column0.x, Column1.x, Column2.x, Translation.x,
+				Column0.y, Column1.y, Column2.y, Translation.y,
+				Column0.z, Column1.z, Column2.z, Translation.z);
+		}
+
+		GLM_FUNC_QUALIFIER static tvec3<T, P> transform(tmat3x4<T, P> const & m, tvec4<T, P> const & v)
+		{
+			return tvec3<T, P>(dot(m[0], v), dot(m[1], v), dot(m[2], v));
+		}
+
+		// The rows of the inverse transpose are the columns of the inverse
+		GLM_FUNC_QUALIFIER static tvec3<T, P> transform_normal(tmat3x4<T, P> const & m, tvec3<T, P> const & n)
+		{
+			tvec3<T, P> const Row0(m[0]);
+			tvec3<T, P> const Row1(m[1]);
+			tvec3<T, P> const Row2(m[2]);
+			tvec3<T, P> const Cross0(cross(Row1, Row2));
+
+			return tvec3<T, P>(dot(Cross0, n), dot(cross(Row2, Row0), n), dot(cross(Row0, Row1), n)) / dot(Row0, Cross0);
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Sum the components of each of a, b and c: (a.x + a.y + a.z + a.w, b.x + ..., c.x + ..., 0)
+	GLM_FUNC_QUALIFIER __m128 sse_hadd3_ps(__m128 a, __m128 b, __m128 c)
+	{
+		__m128 d = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+		return _mm_add_ps(_mm_add_ps(a, b), _mm_add_ps(c, d));
+	}
+
+	template <precision P>
+	struct compute_affine_matrix<float, P>
+	{
+		GLM_FUNC_QUALIFIER static tmat3x4<float, P> compose(tmat3x4<float, P> const & a, tmat3x4<float, P> const & b)
+		{
+			__m128 const B0 = _mm_loadu_ps(&b[0].x);
+			__m128 const B1 = _mm_loadu_ps(&b[1].x);
+			__m128 const B2 = _mm_loadu_ps(&b[2].x);
+			__m128 const W = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+			tmat3x4<float, P> Result(tmat3x4<float, P>::_null);
+			for(length_t i = 0; i < 3; ++i)
+			{
+				__m128 const m0 = _mm_mul_ps(B0, _mm_set1_ps(a[i].x));
+				__m128 const m1 = _mm_mul_ps(B1, _mm_set1_ps(a[i].y));
+				__m128 const m2 = _mm_mul_ps(B2, _mm_set1_ps(a[i].z));
+				__m128 const m3 = _mm_mul_ps(W, _mm_set1_ps(a[i].w));
+				_mm_storeu_ps(&Result[i].x, _mm_add_ps(_mm_add_ps(m0, m1), _mm_add_ps(m2, m3)));
+			}
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static tmat3x4<float, P> inverse(tmat3x4<float, P> const & m)
+		{
+			__m128 const Row0 = _mm_loadu_ps(&m[0].x);
+			__m128 const Row1 = _mm_loadu_ps(&m[1].x);
+			__m128 const Row2 = _mm_loadu_ps(&m[2].x);
+
+			// The w of the cross products is 0, the translation doesn't reach the determinant
+			__m128 Column0 = sse_xpd_ps(Row1, Row2);
+			__m128 Column1 = sse_xpd_ps(Row2, Row0);
+			__m128 Column2 = sse_xpd_ps(Row0, Row1);
+			__m128 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), sse_dot_ps(Row0, Column0));
+			Column0 = _mm_mul_ps(Column0, OneOverDeterminant);
+			Column1 = _mm_mul_ps(Column1, OneOverDeterminant);
+			Column2 = _mm_mul_ps(Column2, OneOverDeterminant);
+
+			__m128 const t0 = _mm_mul_ps(Column0, _mm_shuffle_ps(Row0, Row0, _MM_SHUFFLE(3, 3, 3, 3)));
+			__m128 const t1 = _mm_mul_ps(Column1, _mm_shuffle_ps(Row1, Row1, _MM_SHUFFLE(3, 3, 3, 3)));
+			__m128 const t2 = _mm_mul_ps(Column2, _mm_shuffle_ps(Row2, Row2, _MM_SHUFFLE(3, 3, 3, 3)));
+			__m128 Translation = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_add_ps(t0, t1), t2));
+
+			// The rows of the inverse are the x, y and z of the columns and the translation
+			_MM_TRANSPOSE4_PS(Column0, Column1, Column2, Translation);
+
+			tmat3x4<float, P> Result(tmat3x4<float, P>::_null);
+			_mm_storeu_ps(&Result[0].x, Column0);
+			_mm_storeu_ps(&Result[1].x, Column1);
+			_mm_storeu_ps(&Result[2].x, Column2);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static tvec3<float, P> transform(tmat3x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			__m128 const V = _mm_setr_ps(v.x, v.y, v.z, v.w);
+			__m128 const Result = sse_hadd3_ps(
+				_mm_mul_ps(_mm_loadu_ps(&m[0].x), V),
+				_mm_mul_ps(_mm_loadu_ps(&m[1].x), V),
+				_mm_mul_ps(_mm_loadu_ps(&m[2].x), V));
+
+			float Out[4];
+			_mm_storeu_ps(Out, Result);
+			return tvec3<float, P>(Out[0], Out[1], Out[2]);
+		}
+
+		GLM_FUNC_QUALIFIER static tvec3<float, P> transform_normal(tmat3x4<float, P> const & m, tvec3<float, P> const & n)
+		{
+			__m128 const Row0 = _mm_loadu_ps(&m[0].x);
+			__m128 const Row1 = _mm_loadu_ps(&m[1].x);
+			__m128 const Row2 = _mm_loadu_ps(&m[2].x);
+			__m128 const Column0 = sse_xpd_ps(Row1, Row2);
+
+			__m128 const N = _mm_setr_ps(n.x, n.y, n.z, 0.0f);
+			__m128 const Result = _mm_div_ps(
+				sse_hadd3_ps(
+					_mm_mul_ps(Column0, N),
+					_mm_mul_ps(sse_xpd_ps(Row2, Row0), N),
+					_mm_mul_ps(sse_xpd_ps(Row0, Row1), N)),
+				sse_dot_ps(Row0, Column0));
+
+			float Out[4];
+			_mm_storeu_ps(Out, Result);
+			return tvec3<float, P>(Out[0], Out[1], Out[2]);
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat3x4<T, P> mat3x4_cast
+	(
+		detail::tmat4x4<T, P> const & m
+	)
+	{
+		return detail::tmat3x4<T, P>(
+			m[0][0], m[1][0], m[2][0], m[3][0],
+			m[0][1], m[1][1], m[2][1], m[3][1],
+			m[0][2], m[1][2], m[2][2], m[3][2]);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T, P> mat4_cast
+	(
+		detail::tmat3x4<T, P> const & m
+	)
+	{
+		return detail::tmat4x4<T, P>(
+			m[0][0], m[1][0], m[2][0], static_cast<T>(0),
+			m[0][1], m[1][1], m[2][1], static_cast<T>(0),
+			m[0][2], m[1][2], m[2][2], static_cast<T>(0),
+			m[0][3], m[1][3], m[2][3], static_cast<T>(1));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat3x4<T, P> affineCompose
+	(
+		detail::tmat3x4<T, P> const & a,
+		detail::tmat3x4<T, P> const & b
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineCompose' only accept floating-point inputs");
+		return detail::compute_affine_matrix<T, P>::compose(a, b);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat3x4<T, P> affineInverse
+	(
+		detail::tmat3x4<T, P> const & m
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineInverse' only accept floating-point inputs");
+		return detail::compute_affine_matrix<T, P>::inverse(m);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec3<T, P> affineTransformPoint
+	(
+		detail::tmat3x4<T, P> const & m,
+		detail::tvec3<T, P> const & p
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineTransformPoint' only accept floating-point inputs");
+		return detail::compute_affine_matrix<T, P>::transform(m, detail::tvec4<T, P>(p, static_cast<T>(1)));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec3<T, P> affineTransformVector
+	(
+		detail::tmat3x4<T, P> const & m,
+		detail::tvec3<T, P> const & v
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineTransformVector' only accept floating-point inputs");
+		return detail::compute_affine_matrix<T, P>::transform(m, detail::tvec4<T, P>(v, static_cast<T>(0)));
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tvec3<T, P> affineTransformNormal
+	(
+		detail::tmat3x4<T, P> const & m,
+		detail::tvec3<T, P> const & n
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'affineTransformNormal' only accept floating-point inputs");
+		return detail::compute_affine_matrix<T, P>::transform_normal(m, n);
+	}
+}//namespace glm
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// @brief Bounding volume hierarchy to intersect rays with large arrays of triangles or spheres.
+///
+/// The hierarchy is built top down with the surface area heuristic evaluated on
+/// 16 bins per axis. The nodes of each level are split in parallel with OpenMP
+/// when it is enabled. Nodes are stored depth first so that the first child of
+/// a node follows it in memory, a float node takes 32 bytes. The traversal
+/// visits the nearest child first and keeps the other ones in a fixed size
+/// stack, the depth of the hierarchy is limited to its size. The primitives
+/// are tested with the functions of GLM_GTX_intersect.
+///
+/// <glm/gtx/bvh.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/intersect.hpp"
+#include <vector>
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	/// Bounding volume hierarchy of an array of primitives.
+	/// It only stores the indices of the primitives, the queries take the arrays it was built from.
+	/// @see gtx_bvh
+	template <typename T, precision P>
+	class tbvh
+	{
+	public:
+		struct node
+		{
+			tvec3<T, P> Min;
+			/// Index of the second child for inner nodes, of the first primitive in Indices for leaves
+			uint32 Offset;
+			tvec3<T, P> Max;
+			/// Number of primitives shifted by 2, 0 for inner nodes, and split axis in the 2 lowest bits
+			uint32 Data;
+		};
+
+		/// Build the hierarchy of Count triangles.
+		GLM_FUNC_DECL void build(
+			tvec3<T, P> const * Vert0,
+			tvec3<T, P> const * Vert1,
+			tvec3<T, P> const * Vert2,
+			std::size_t Count);
+
+		/// Build the hierarchy of Count spheres.
+		GLM_FUNC_DECL void build(
+			tvec3<T, P> const * Centers,
+			T const * Radii,
+			std::size_t Count);
+
+		/// Build the hierarchy of Count axis aligned boxes.
+		GLM_FUNC_DECL void build(
+			tvec3<T, P> const * Mins,
+			tvec3<T, P> const * Maxs,
+			std::size_t Count);
+
+		/// Number of bytes used by the nodes and the indices
+		GLM_FUNC_DECL std::size_t memory() const;
+
+		/// Depth first nodes, the first one is the root
+		std::vector<node> Nodes;
+		/// Indices of the primitives, each leaf references a contiguous range
+		std::vector<uint32> Indices;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	typedef detail::tbvh<float, defaultp>		bvh;
+	typedef detail::tbvh<double, defaultp>		dbvh;
+
+	/// Compute the nearest intersection of a ray and the triangles a hierarchy was built from,
+	/// with the same result as intersectRayTriangles on the whole arrays.
+	/// @see gtx_bvh
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRayTriangles(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & orig, detail::tvec3<T, P> const & dir,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		detail::tvec3<T, P> & baryPosition, std::size_t & index);
+
+	/// Return whether a ray hits any of the triangles a hierarchy was built from at a distance lower than maxDistance.
+	/// The traversal stops on the first hit found.
+	/// @see gtx_bvh
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRayTrianglesAny(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & orig, detail::tvec3<T, P> const & dir,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		T maxDistance);
+
+	/// Compute the nearest intersections of count rays and the triangles a hierarchy was built from.
+	/// baryPositions[i] and indices[i] are only written when ray i hits a triangle.
+	/// The rays are distributed across threads with OpenMP when it is enabled.
+	/// @return The number of rays which hit a triangle.
+	/// @see gtx_bvh
+	template <typename T, precision P>
+	GLM_FUNC_DECL std::size_t intersectRaysTriangles(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const * orig, detail::tvec3<T, P> const * dir,
+		std::size_t count,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		detail::tvec3<T, P> * baryPositions, std::size_t * indices);
+
+	/// Compute the nearest intersection of a ray and the spheres a hierarchy was built from, like intersectRaySphere.
+	/// The ray direction must be unit length.
+	/// @see gtx_bvh
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRaySpheres(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & rayStarting, detail::tvec3<T, P> const & rayNormalizedDirection,
+		detail::tvec3<T, P> const * sphereCenters, T const * sphereRadii,
+		T & intersectionDistance, std::size_t & index);
+
+	/// Return whether a ray hits any of the spheres a hierarchy was built from at a distance lower than maxDistance.
+	/// The ray direction must be unit length.
+	/// @see gtx_bvh
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRaySpheresAny(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & rayStarting, detail::tvec3<T, P> const & rayNormalizedDirection,
+		detail::tvec3<T, P> const * sphereCenters, T const * sphereRadii,
+		T maxDistance);
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
@@ -0,0 +1,548 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/bvh.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Size of the traversal stack, the hierarchy is never deeper
+	std::size_t const bvh_max_depth = 64;
+	std::size_t const bvh_bin_count = 16;
+	// Larger nodes are always split
+	std::size_t const bvh_max_leaf_size = 8;
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER T bvh_half_area(tvec3<T, P> const & Min, tvec3<T, P> const & Max)
+	{
+		tvec3<T, P> const Size(Max - Min);
+		return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+	}
+
+	template <typename T, precision P>
+	struct bvh_builder
+	{
+		struct task
+		{
+			tvec3<T, P> Min;
+			tvec3<T, P> Max;
+			std::size_t Begin;
+			std::size_t End;
+			std::size_t Depth;
+			std::size_t Left;	// Index of the first child task, 0 for leaves
+			length_t Axis;
+		};
+
+		struct bin
+		{
+			tvec3<T, P> Min;
+			tvec3<T, P> Max;
+			std::size_t Count;
+		};
+
+		std::vector<tvec3<T, P> > const & Mins;
+		std::vector<tvec3<T, P> > const & Maxs;
+		std::vector<tvec3<T, P> > const & Centers;
+		std::vector<uint32> & Indices;
+
+		bvh_builder(std::vector<tvec3<T, P> > const & mins, std::vector<tvec3<T, P> > const & maxs, std::vector<tvec3<T, P> > const & centers, std::vector<uint32> & indices) :
+			Mins(mins), Maxs(maxs), Centers(centers), Indices(indices)
+		{}
+
+		GLM_FUNC_QUALIFIER void bounds(std::size_t Begin, std::size_t End, tvec3<T, P> & Min, tvec3<T, P> & Max) const
+		{
+			Min = tvec3<T, P>(std::numeric_limits<T>::max());
+			Max = tvec3<T, P>(-std::numeric_limits<T>::max());
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				Min = min(Min, Mins[Indices[i]]);
+				Max = max(Max, Maxs[Indices[i]]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t bin_index(T Center, T Origin, T Scale)
+		{
+			return std::min(static_cast<std::size_t>((Center - Origin) * Scale), bvh_bin_count - 1);
+		}
+
+		// Return the index of the first primitive of the second child, or End to make a leaf
+		GLM_FUNC_QUALIFIER std::size_t split(task & Task) const
+		{
+			std::size_t const Count = Task.End - Task.Begin;
+			if(Count <= 1 || Task.Depth + 1 >= bvh_max_depth)
+				return Task.End;
+
+			tvec3<T, P> CenterMin(std::numeric_limits<T>::max());
+			tvec3<T, P> CenterMax(-std::numeric_limits<T>::max());
+			for(std::size_t i = Task.Begin; i < Task.End; ++i)
+			{
+				CenterMin = min(CenterMin, Centers[Indices[i]]);
+				CenterMax = max(CenterMax, Centers[Indices[i]]);
+			}
+
+			// Cost of the splits relative to the cost of the node, one primitive test per primitive of each child
+			T BestCost = std::numeric_limits<T>::max();
+			length_t BestAxis = 0;
+			std::size_t BestBin = 0;
+			for(length_t Axis = 0; Axis < 3; ++Axis)
+			{
+				T const Extent = CenterMax[Axis] - CenterMin[Axis];
+				if(Extent <= T(0))
+					continue;
+
+				bin Bins[bvh_bin_count];
+				for(std::size_t b = 0; b < bvh_bin_count; ++b)
+				{
+					Bins[b].Min = tvec3<T, P>(std::numeric_limits<T>::max());
+					Bins[b].Max = tvec3<T, P>(-std::numeric_limits<T>::max());
+					Bins[b].Count = 0;
+				}
+
+				T const Scale = static_cast<T>(bvh_bin_count) / Extent;
+				for(std::size_t i = Task.Begin; i < Task.End; ++i)
+				{
+					uint32 const Index = Indices[i];
+					bin & Bin = Bins[bin_index(Centers[Index][Axis], CenterMin[Axis], Scale)];
+					Bin.Min = min(Bin.Min, Mins[Index]);
+					Bin.Max = max(Bin.Max, Maxs[Index]);
+					++Bin.Count;
+				}
+
+				// Sweep from the right to accumulate the costs of the second children
+				T RightCosts[bvh_bin_count];
+				tvec3<T, P> RightMin(Bins[bvh_bin_count - 1].Min), RightMax(Bins[bvh_bin_count - 1].Max);
+				std::size_t RightCount = Bins[bvh_bin_count - 1].Count;
+				for(std::size_t b = bvh_bin_count - 1; b > 0; --b)
+				{
+					RightCosts[b] = RightCount > 0 ? bvh_half_area(RightMin, RightMax) * static_cast<T>(RightCount) : T(0);
+					RightMin = min(RightMin, Bins[b - 1].Min);
+					RightMax = max(RightMax, Bins[b - 1].Max);
+					RightCount += Bins[b - 1].Count;
+				}
+
+				tvec3<T, P> LeftMin(std::numeric_limits<T>::max()), LeftMax(-std::numeric_limits<T>::max());
+				std::size_t LeftCount = 0;
+				for(std::size_t b = 0; b + 1 < bvh_bin_count; ++b)
+				{
+					LeftMin = min(LeftMin, Bins[b].Min);
+					LeftMax = max(LeftMax, Bins[b].Max);
+					LeftCount += Bins[b].Count;
+					if(LeftCount == 0 || LeftCount == Count)
+						continue;
+
+					T const Cost = bvh_half_area(LeftMin, LeftMax) * static_cast<T>(LeftCount) + RightCosts[b + 1];
+					if(Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestAxis = Axis;
+						BestBin = b;
+					}
+				}
+			}
+
+			T const NodeArea = bvh_half_area(Task.Min, Task.Max);
+			std::size_t Mid = Task.End;
+			if(BestCost < std::numeric_limits<T>::max())
+			{
+				// A split costs a traversal step on top of its primitive tests
+				if(Count <= bvh_max_leaf_size && BestCost + NodeArea >= NodeArea * static_cast<T>(Count))
+					return Task.End;
+
+				T const Scale = static_cast<T>(bvh_bin_count) / (CenterMax[BestAxis] - CenterMin[BestAxis]);
+				uint32 * const Begin = &Indices[0] + Task.Begin;
+				uint32 * const End = &Indices[0] + Task.End;
+				Mid = static_cast<std::size_t>(std::partition(Begin, End, bin_less(Centers, BestAxis, CenterMin[BestAxis], Scale, BestBin)) - &Indices[0]);
+				Task.Axis = BestAxis;
+			}
+			else if(Count > bvh_max_leaf_size)
+			{
+				// All the centers are at the same position
+				Mid = Task.Begin + Count / 2;
+				Task.Axis = 0;
+			}
+
+			return Mid;
+		}
+
+		struct bin_less
+		{
+			bin_less(std::vector<tvec3<T, P> > const & centers, length_t axis, T origin, T scale, std::size_t last) :
+				Centers(centers), Axis(axis), Origin(origin), Scale(scale), Last(last)
+			{}
+
+			bool operator()(uint32 Index) const
+			{
+				return bin_index(Centers[Index][Axis], Origin, Scale) <= Last;
+			}
+
+			std::vector<tvec3<T, P> > const & Centers;
+			length_t Axis;
+			T Origin;
+			T Scale;
+			std::size_t Last;
+		};
+
+		// Store the tasks depth first, the first child follows its parent
+		GLM_FUNC_QUALIFIER static void flatten(std::vector<task> const & Tasks, std::size_t Index, std::vector<typename tbvh<T, P>::node> & Nodes)
+		{
+			task const & Task = Tasks[Index];
+			std::size_t const NodeIndex = Nodes.size();
+
+			typename tbvh<T, P>::node Node;
+			Node.Min = Task.Min;
+			Node.Max = Task.Max;
+			Node.Offset = static_cast<uint32>(Task.Begin);
+			Node.Data = Task.Left ? static_cast<uint32>(Task.Axis) : static_cast<uint32>((Task.End - Task.Begin) << 2);
+			Nodes.push_back(Node);
+
+			if(Task.Left)
+			{
+				flatten(Tasks, Task.Left, Nodes);
+				Nodes[NodeIndex].Offset = static_cast<uint32>(Nodes.size());
+				flatten(Tasks, Task.Left + 1, Nodes);
+			}
+		}
+
+		// The nodes of a level are split in parallel, their primitives are distinct ranges of Indices
+		GLM_FUNC_QUALIFIER void build(std::vector<typename tbvh<T, P>::node> & Nodes)
+		{
+			std::vector<task> Tasks(1);
+			Tasks[0].Begin = 0;
+			Tasks[0].End = Indices.size();
+			Tasks[0].Depth = 0;
+			Tasks[0].Left = 0;
+			Tasks[0].Axis = 0;
+			bounds(0, Indices.size(), Tasks[0].Min, Tasks[0].Max);
+
+			std::vector<std::size_t> Mids;
+			for(std::size_t LevelBegin = 0; LevelBegin < Tasks.size();)
+			{
+				std::size_t const LevelEnd = Tasks.size();
+				int const LevelCount = static_cast<int>(LevelEnd - LevelBegin);
+				Mids.resize(LevelEnd - LevelBegin);
+
+#				if GLM_HAS_OPENMP
+#					pragma omp parallel for schedule(dynamic)
+#				endif
+				for(int i = 0; i < LevelCount; ++i)
+					Mids[static_cast<std::size_t>(i)] = split(Tasks[LevelBegin + static_cast<std::size_t>(i)]);
+
+				for(std::size_t i = LevelBegin; i < LevelEnd; ++i)
+				{
+					std::size_t const Mid = Mids[i - LevelBegin];
+					if(Mid == Tasks[i].End)
+						continue;
+
+					task Left;
+					Left.Begin = Tasks[i].Begin;
+					Left.End = Mid;
+					Left.Depth = Tasks[i].Depth + 1;
+					Left.Left = 0;
+					Left.Axis = 0;
+
+					task Right(Left);
+					Right.Begin = Mid;
+					Right.End = Tasks[i].End;
+
+					Tasks[i].Left = Tasks.size();
+					Tasks.push_back(Left);
+					Tasks.push_back(Right);
+				}
+
+				// The bounds of the children are needed to split them
+				int const ChildCount = static_cast<int>(Tasks.size() - LevelEnd);
+#				if GLM_HAS_OPENMP
+#					pragma omp parallel for schedule(dynamic)
+#				endif
+				for(int i = 0; i < ChildCount; ++i)
+				{
+					task & Child = Tasks[LevelEnd + static_cast<std::size_t>(i)];
+					bounds(Child.Begin, Child.End, Child.Min, Child.Max);
+				}
+
+				LevelBegin = LevelEnd;
+			}
+
+			Nodes.clear();
+			Nodes.reserve(Tasks.size());
+			flatten(Tasks, 0, Nodes);
+		}
+	};
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void bvh_build(std::vector<tvec3<T, P> > const & Mins, std::vector<tvec3<T, P> > const & Maxs, std::vector<typename tbvh<T, P>::node> & Nodes, std::vector<uint32> & Indices)
+	{
+		Nodes.clear();
+		Indices.resize(Mins.size());
+		if(Mins.empty())
+			return;
+
+		std::vector<tvec3<T, P> > Centers(Mins.size());
+		for(std::size_t i = 0; i < Mins.size(); ++i)
+		{
+			Centers[i] = (Mins[i] + Maxs[i]) * T(0.5);
+			Indices[i] = static_cast<uint32>(i);
+		}
+
+		bvh_builder<T, P> Builder(Mins, Maxs, Centers, Indices);
+		Builder.build(Nodes);
+	}
+
+	// Slab test of the ray against the bounds of a node, between 0 and MaxDistance
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool bvh_ray_box(typename tbvh<T, P>::node const & Node, tvec3<T, P> const & Orig, tvec3<T, P> const & InvDir, T MaxDistance)
+	{
+		tvec3<T, P> const Near((Node.Min - Orig) * InvDir);
+		tvec3<T, P> const Far((Node.Max - Orig) * InvDir);
+		tvec3<T, P> const Enter(min(Near, Far));
+		tvec3<T, P> const Exit(max(Near, Far));
+		T const EnterDistance = max(max(Enter.x, Enter.y), max(Enter.z, T(0)));
+		T const ExitDistance = min(min(Exit.x, Exit.y), min(Exit.z, MaxDistance));
+		return EnterDistance <= ExitDistance;
+	}
+
+	// Visit the nearest child first, leafType tests a primitive and shortens Distance on a hit
+	template <typename T, precision P, typename leafType>
+	GLM_FUNC_QUALIFIER bool bvh_traverse(tbvh<T, P> const & Bvh, tvec3<T, P> const & Orig, tvec3<T, P> const & Dir, T & Distance, leafType & Leaf, bool Any)
+	{
+		if(Bvh.Nodes.empty())
+			return false;
+
+		tvec3<T, P> const InvDir(T(1) / Dir);
+
+		uint32 Stack[bvh_max_depth];
+		std::size_t StackSize = 0;
+		uint32 Current = 0;
+		bool Hit = false;
+		for(;;)
+		{
+			typename tbvh<T, P>::node const & Node = Bvh.Nodes[Current];
+			if(bvh_ray_box(Node, Orig, InvDir, Distance))
+			{
+				uint32 const Count = Node.Data >> 2;
+				if(Count == 0)
+				{
+					bool const Backward = Dir[Node.Data & 3] < T(0);
+					Stack[StackSize++] = Backward ? Current + 1 : Node.Offset;
+					Current = Backward ? Node.Offset : Current + 1;
+					continue;
+				}
+
+				for(uint32 i = Node.Offset; i < Node.Offset + Count; ++i)
+					if(Leaf(Bvh.Indices[i], Distance))
+					{
+						if(Any)
+							return true;
+						Hit = true;
+					}
+			}
+
+			if(StackSize == 0)
+				return Hit;
+			Current = Stack[--StackSize];
+		}
+	}
+
+	template <typename T, precision P>
+	struct bvh_triangles
+	{
+		bvh_triangles(tvec3<T, P> const & orig, tvec3<T, P> const & dir, tvec3<T, P> const * vert0, tvec3<T, P> const * vert1, tvec3<T, P> const * vert2) :
+			Orig(orig), Dir(dir), Vert0(vert0), Vert1(vert1), Vert2(vert2), Index(0)
+		{}
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 i, T & Distance)
+		{
+			tvec3<T, P> Position;
+			if(!intersectRayTriangle(Orig, Dir, Vert0[i], Vert1[i], Vert2[i], Position) || !(Position.z < Distance))
+				return false;
+			Distance = Position.z;
+			Bary = Position;
+			Index = i;
+			return true;
+		}
+
+		tvec3<T, P> const & Orig;
+		tvec3<T, P> const & Dir;
+		tvec3<T, P> const * Vert0;
+		tvec3<T, P> const * Vert1;
+		tvec3<T, P> const * Vert2;
+		tvec3<T, P> Bary;
+		std::size_t Index;
+	};
+
+	template <typename T, precision P>
+	struct bvh_spheres
+	{
+		bvh_spheres(tvec3<T, P> const & orig, tvec3<T, P> const & dir, tvec3<T, P> const * centers, T const * radii) :
+			Orig(orig), Dir(dir), Centers(centers), Radii(radii), Index(0)
+		{}
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 i, T & Distance)
+		{
+			T Hit;
+			if(!intersectRaySphere(Orig, Dir, Centers[i], Radii[i] * Radii[i], Hit) || !(Hit < Distance))
+				return false;
+			Distance = Hit;
+			Index = i;
+			return true;
+		}
+
+		tvec3<T, P> const & Orig;
+		tvec3<T, P> const & Dir;
+		tvec3<T, P> const * Centers;
+		T const * Radii;
+		std::size_t Index;
+	};
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void detail::tbvh<T, P>::build
+	(
+		tvec3<T, P> const * Vert0,
+		tvec3<T, P> const * Vert1,
+		tvec3<T, P> const * Vert2,
+		std::size_t Count
+	)
+	{
+		std::vector<tvec3<T, P> > Mins(Count), Maxs(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Mins[i] = min(min(Vert0[i], Vert1[i]), Vert2[i]);
+			Maxs[i] = max(max(Vert0[i], Vert1[i]), Vert2[i]);
+		}
+		bvh_build(Mins, Maxs, this->Nodes, this->Indices);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void detail::tbvh<T, P>::build
+	(
+		tvec3<T, P> const * Centers,
+		T const * Radii,
+		std::size_t Count
+	)
+	{
+		std::vector<tvec3<T, P> > Mins(Count), Maxs(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Mins[i] = Centers[i] - Radii[i];
+			Maxs[i] = Centers[i] + Radii[i];
+		}
+		bvh_build(Mins, Maxs, this->Nodes, this->Indices);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void detail::tbvh<T, P>::build
+	(
+		tvec3<T, P> const * Mins,
+		tvec3<T, P> const * Maxs,
+		std::size_t Count
+	)
+	{
+		bvh_build(std::vector<tvec3<T, P> >(Mins, Mins + Count), std::vector<tvec3<T, P> >(Maxs, Maxs + Count), this->Nodes, this->Indices);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t detail::tbvh<T, P>::memory() const
+	{
+		return this->Nodes.size() * sizeof(node) + this->Indices.size() * sizeof(uint32);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & orig, detail::tvec3<T, P> const & dir,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		detail::tvec3<T, P> & baryPosition, std::size_t & index
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRayTriangles' only accept floating-point inputs");
+
+		detail::bvh_triangles<T, P> Leaf(orig, dir, vert0, vert1, vert2);
+		T Distance = std::numeric_limits<T>::max();
+		if(!detail::bvh_traverse(Bvh, orig, dir, Distance, Leaf, false))
+			return false;
+		baryPosition = Leaf.Bary;
+		index = Leaf.Index;
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRayTrianglesAny
+	(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & orig, detail::tvec3<T, P> const & dir,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		T maxDistance
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRayTrianglesAny' only accept floating-point inputs");
+
+		detail::bvh_triangles<T, P> Leaf(orig, dir, vert0, vert1, vert2);
+		return detail::bvh_traverse(Bvh, orig, dir, maxDistance, Leaf, true);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t intersectRaysTriangles
+	(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const * orig, detail::tvec3<T, P> const * dir,
+		std::size_t count,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		detail::tvec3<T, P> * baryPositions, std::size_t * indices
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRaysTriangles' only accept floating-point inputs");
+
+		int const RayCount = static_cast<int>(count);
+		int Hits = 0;
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for schedule(dynamic, 64) reduction(+:Hits)
+#		endif
+		for(int i = 0; i < RayCount; ++i)
+			Hits += intersectRayTriangles(Bvh, orig[i], dir[i], vert0, vert1, vert2, baryPositions[i], indices[i]) ? 1 : 0;
+		return static_cast<std::size_t>(Hits);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRaySpheres
+	(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & rayStarting, detail::tvec3<T, P> const & rayNormalizedDirection,
+		detail::tvec3<T, P> const * sphereCenters, T const * sphereRadii,
+		T & intersectionDistance, std::size_t & index
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRaySpheres' only accept floating-point inputs");
+
+		detail::bvh_spheres<T, P> Leaf(rayStarting, rayNormalizedDirection, sphereCenters, sphereRadii);
+		T Distance = std::numeric_limits<T>::max();
+		if(!detail::bvh_traverse(Bvh, rayStarting, rayNormalizedDirection, Distance, Leaf, false))
+			return false;
+		intersectionDistance = Distance;
+		index = Leaf.Index;
+		return true;
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRaySpheresAny
+	(
+		detail::tbvh<T, P> const & Bvh,
+		detail::tvec3<T, P> const & rayStarting, detail::tvec3<T, P> const & rayNormalizedDirection,
+		detail::tvec3<T, P> const * sphereCenters, T const * sphereRadii,
+		T maxDistance
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRaySpheresAny' only accept floating-point inputs");
+
+		detail::bvh_spheres<T, P> Leaf(rayStarting, rayNormalizedDirection, sphereCenters, sphereRadii);
+		return detail::bvh_traverse(Bvh, rayStarting, rayNormalizedDirection, maxDistance, Leaf, true);
+	}
+}//namespace glm
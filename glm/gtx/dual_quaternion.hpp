@@ -29,6 +29,7 @@
 /// @see gtc_half_float (dependence)
 /// @see gtc_constants (dependence)
 /// @see gtc_quaternion (dependence)
+/// @see gtx_quaternion (dependence)
 ///
 /// @defgroup gtc_dual_quaternion GLM_GTX_dual_quaternion
 /// @ingroup gtc
@@ -44,6 +45,7 @@
 #include "../glm.hpp"
 #include "../gtc/constants.hpp"
 #include "../gtc/quaternion.hpp"
+#include "../gtx/quaternion.hpp"
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTX_dual_quaternion extension included")
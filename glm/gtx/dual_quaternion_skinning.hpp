@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_dual_quaternion_skinning
+/// @file glm/gtx/dual_quaternion_skinning.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion (dependence)
+///
+/// @defgroup gtx_dual_quaternion_skinning GLM_GTX_dual_quaternion_skinning
+/// @ingroup gtx
+///
+/// @brief Dual quaternion skinning of vertex arrays.
+///
+/// Each vertex is influenced by up to 4 bones of a palette of unit dual
+/// quaternions. The dual quaternions of the bones are blended with the weights
+/// of the vertex, normalized, then applied to the position and the normal
+/// (dual quaternion linear blending, Kavan et al. 2007).
+///
+/// The vertices are split into ranges of 1024 vertices which are distributed
+/// across threads with OpenMP when it is enabled. Float vertices are skinned by
+/// groups of 4 with SSE2 or 8 with AVX. The result doesn't depend on the number
+/// of threads.
+///
+/// <glm/gtx/dual_quaternion_skinning.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/_lane.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_dual_quaternion_skinning extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_dual_quaternion_skinning
+	/// @{
+
+	/// Skin Count vertices with the bones of Palette.
+	/// Vertex i is influenced by the bones BoneIndices[i] with the weights BoneWeights[i].
+	/// Unused influences have a weight of 0, the weights of a vertex should sum to 1.
+	/// Normals and OutNormals may be null, then only the positions are skinned.
+	/// The outputs may alias the inputs but the arrays must not partially overlap.
+	/// @see gtx_dual_quaternion_skinning
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_DECL void dualQuatSkinning(
+		detail::tdualquat<T, P> const * Palette,
+		detail::tvec3<T, P> const * Positions,
+		detail::tvec3<T, P> const * Normals,
+		detail::tvec4<indexType, P> const * BoneIndices,
+		detail::tvec4<T, P> const * BoneWeights,
+		detail::tvec3<T, P> * OutPositions,
+		detail::tvec3<T, P> * OutNormals,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "dual_quaternion_skinning.inl"
@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/dual_quaternion_skinning.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Vertices skinned by each task, a multiple of every lane size
+	std::size_t const dual_quat_skinning_range = 1024;
+
+	template <typename T, precision P, typename indexType>
+	struct compute_dual_quat_skinning
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			tdualquat<T, P> const * Palette,
+			tvec3<T, P> const * Positions,
+			tvec3<T, P> const * Normals,
+			tvec4<indexType, P> const * BoneIndices,
+			tvec4<T, P> const * BoneWeights,
+			tvec3<T, P> * OutPositions,
+			tvec3<T, P> * OutNormals,
+			std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				tdualquat<T, P> const & First = Palette[BoneIndices[i].x];
+				tdualquat<T, P> Blend = First * BoneWeights[i].x;
+				for(length_t k = 1; k < 4; ++k)
+				{
+					// Blend the antipodal quaternion when it is closer to the first bone
+					tdualquat<T, P> const & Bone = Palette[BoneIndices[i][k]];
+					T const Weight = dot(First.real, Bone.real) < static_cast<T>(0) ? -BoneWeights[i][k] : BoneWeights[i][k];
+					Blend = Blend + Bone * Weight;
+				}
+				Blend = glm::normalize(Blend);
+
+				tvec3<T, P> const Position = Blend * Positions[i];
+				if(Normals)
+					OutNormals[i] = Blend.real * Normals[i];
+				OutPositions[i] = Position;
+			}
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P, typename indexType>
+	struct compute_dual_quat_skinning<float, P, indexType>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		// Load in lane j the dual quaternion of the k-th bone of vertex j
+		GLM_FUNC_QUALIFIER static void gather_bone(
+			tdualquat<float, P> const * Palette,
+			tvec4<indexType, P> const * BoneIndices,
+			length_t k,
+			L Real[4],
+			L Dual[4])
+		{
+			float const * RealBases[Size];
+			float const * DualBases[Size];
+			for(std::size_t j = 0; j < Size; ++j)
+			{
+				tdualquat<float, P> const & Bone = Palette[BoneIndices[j][k]];
+				RealBases[j] = &Bone.real.x;
+				DualBases[j] = &Bone.dual.x;
+			}
+			lane_type::gather_soa4(RealBases, Real);
+			lane_type::gather_soa4(DualBases, Dual);
+		}
+
+		// Accumulate the k-th bone, using its antipodal quaternion when it is closer to the first bone
+		GLM_FUNC_QUALIFIER static void blend_bone(
+			tdualquat<float, P> const * Palette,
+			tvec4<indexType, P> const * BoneIndices,
+			length_t k,
+			L const & Weight,
+			L const First[4],
+			L Real[4],
+			L Dual[4])
+		{
+			L BoneReal[4], BoneDual[4];
+			gather_bone(Palette, BoneIndices, k, BoneReal, BoneDual);
+
+			L const Dot = First[0] * BoneReal[0] + First[1] * BoneReal[1] + First[2] * BoneReal[2] + First[3] * BoneReal[3];
+			L const SignedWeight = select(Dot < L(0.0f), -Weight, Weight);
+			for(length_t c = 0; c < 4; ++c)
+			{
+				Real[c] = Real[c] + BoneReal[c] * SignedWeight;
+				Dual[c] = Dual[c] + BoneDual[c] * SignedWeight;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void block(
+			tdualquat<float, P> const * Palette,
+			tvec3<float, P> const * Positions,
+			tvec3<float, P> const * Normals,
+			tvec4<indexType, P> const * BoneIndices,
+			tvec4<float, P> const * BoneWeights,
+			tvec3<float, P> * OutPositions,
+			tvec3<float, P> * OutNormals)
+		{
+			L Weights[4];
+			lane_type::load_soa<4>(&BoneWeights[0].x, 4, Weights);
+
+			L First[4], FirstDual[4];
+			gather_bone(Palette, BoneIndices, 0, First, FirstDual);
+
+			L Real[4], Dual[4];
+			for(length_t c = 0; c < 4; ++c)
+			{
+				Real[c] = First[c] * Weights[0];
+				Dual[c] = FirstDual[c] * Weights[0];
+			}
+			blend_bone(Palette, BoneIndices, 1, Weights[1], First, Real, Dual);
+			blend_bone(Palette, BoneIndices, 2, Weights[2], First, Real, Dual);
+			blend_bone(Palette, BoneIndices, 3, Weights[3], First, Real, Dual);
+
+			L const InvLength = L(1.0f) / sqrt(Real[0] * Real[0] + Real[1] * Real[1] + Real[2] * Real[2] + Real[3] * Real[3]);
+			for(length_t c = 0; c < 4; ++c)
+			{
+				Real[c] = Real[c] * InvLength;
+				Dual[c] = Dual[c] * InvLength;
+			}
+
+			L const Two(2.0f);
+
+			if(Normals)
+			{
+				L N[3];
+				lane_type::load_soa<3>(&Normals[0].x, 3, N);
+
+				// Rotation by the real part: n + 2 * (cross(r, n) * w + cross(r, cross(r, n)))
+				L const uvx = Real[1] * N[2] - Real[2] * N[1];
+				L const uvy = Real[2] * N[0] - Real[0] * N[2];
+				L const uvz = Real[0] * N[1] - Real[1] * N[0];
+				L Result[3];
+				Result[0] = N[0] + (uvx * Real[3] + Real[1] * uvz - Real[2] * uvy) * Two;
+				Result[1] = N[1] + (uvy * Real[3] + Real[2] * uvx - Real[0] * uvz) * Two;
+				Result[2] = N[2] + (uvz * Real[3] + Real[0] * uvy - Real[1] * uvx) * Two;
+				lane_type::store_soa<3>(&OutNormals[0].x, 3, Result);
+			}
+
+			L V[3];
+			lane_type::load_soa<3>(&Positions[0].x, 3, V);
+
+			// v + 2 * (cross(r, cross(r, v) + v * w + d) + d * w - r * dw)
+			L const tx = Real[1] * V[2] - Real[2] * V[1] + V[0] * Real[3] + Dual[0];
+			L const ty = Real[2] * V[0] - Real[0] * V[2] + V[1] * Real[3] + Dual[1];
+			L const tz = Real[0] * V[1] - Real[1] * V[0] + V[2] * Real[3] + Dual[2];
+			L Result[3];
+			Result[0] = V[0] + (Real[1] * tz - Real[2] * ty + Dual[0] * Real[3] - Real[0] * Dual[3]) * Two;
+			Result[1] = V[1] + (Real[2] * tx - Real[0] * tz + Dual[1] * Real[3] - Real[1] * Dual[3]) * Two;
+			Result[2] = V[2] + (Real[0] * ty - Real[1] * tx + Dual[2] * Real[3] - Real[2] * Dual[3]) * Two;
+			lane_type::store_soa<3>(&OutPositions[0].x, 3, Result);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(
+			tdualquat<float, P> const * Palette,
+			tvec3<float, P> const * Positions,
+			tvec3<float, P> const * Normals,
+			tvec4<indexType, P> const * BoneIndices,
+			tvec4<float, P> const * BoneWeights,
+			tvec3<float, P> * OutPositions,
+			tvec3<float, P> * OutNormals,
+			std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				block(Palette, Positions + i, Normals ? Normals + i : 0, BoneIndices + i, BoneWeights + i, OutPositions + i, OutNormals ? OutNormals + i : 0);
+
+			if(i < Count)
+			{
+				// The unused lanes skin the origin with the first bone
+				tvec3<float, P> TailPositions[Size], TailNormals[Size];
+				tvec3<float, P> TailOutPositions[Size], TailOutNormals[Size];
+				tvec4<indexType, P> TailIndices[Size];
+				tvec4<float, P> TailWeights[Size];
+				for(std::size_t j = 0; j < Size; ++j)
+				{
+					TailPositions[j] = tvec3<float, P>(0.0f);
+					TailNormals[j] = tvec3<float, P>(0.0f, 0.0f, 1.0f);
+					TailIndices[j] = tvec4<indexType, P>(0);
+					TailWeights[j] = tvec4<float, P>(1.0f, 0.0f, 0.0f, 0.0f);
+				}
+				for(std::size_t j = 0; i + j < Count; ++j)
+				{
+					TailPositions[j] = Positions[i + j];
+					if(Normals)
+						TailNormals[j] = Normals[i + j];
+					TailIndices[j] = BoneIndices[i + j];
+					TailWeights[j] = BoneWeights[i + j];
+				}
+
+				block(Palette, TailPositions, Normals ? TailNormals : 0, TailIndices, TailWeights, TailOutPositions, TailOutNormals);
+
+				for(std::size_t j = 0; i + j < Count; ++j)
+				{
+					OutPositions[i + j] = TailOutPositions[j];
+					if(Normals)
+						OutNormals[i + j] = TailOutNormals[j];
+				}
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_QUALIFIER void dualQuatSkinning
+	(
+		detail::tdualquat<T, P> const * Palette,
+		detail::tvec3<T, P> const * Positions,
+		detail::tvec3<T, P> const * Normals,
+		detail::tvec4<indexType, P> const * BoneIndices,
+		detail::tvec4<T, P> const * BoneWeights,
+		detail::tvec3<T, P> * OutPositions,
+		detail::tvec3<T, P> * OutNormals,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dualQuatSkinning' only accept floating-point inputs");
+
+		if(!OutNormals)
+			Normals = 0;
+
+		int const RangeCount = static_cast<int>((Count + detail::dual_quat_skinning_range - 1) / detail::dual_quat_skinning_range);
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for schedule(static)
+#		endif
+		for(int Range = 0; Range < RangeCount; ++Range)
+		{
+			std::size_t const Begin = static_cast<std::size_t>(Range) * detail::dual_quat_skinning_range;
+			std::size_t const End = min(Begin + detail::dual_quat_skinning_range, Count);
+			detail::compute_dual_quat_skinning<T, P, indexType>::call(
+				Palette,
+				Positions + Begin,
+				Normals ? Normals + Begin : 0,
+				BoneIndices + Begin,
+				BoneWeights + Begin,
+				OutPositions + Begin,
+				Normals ? OutNormals + Begin : 0,
+				End - Begin);
+		}
+	}
+}//namespace glm
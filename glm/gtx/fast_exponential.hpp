@@ -22,17 +22,32 @@
 ///
 /// @ref gtx_fast_exponential
 /// @file glm/gtx/fast_exponential.hpp
-/// @date 2006-01-09 / 2011-06-07
+/// @date 2006-01-09 / 2014-10-16
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
-/// @see gtx_half_float (dependence)
 ///
 /// @defgroup gtx_fast_exponential GLM_GTX_fast_exponential
 /// @ingroup gtx
 /// 
 /// @brief Fast but less accurate implementations of exponential based functions.
 /// 
+/// The functions split their argument in exponent bits and a mantissa and
+/// evaluate a minimax polynomial on the reduced range. The precision qualifier
+/// passed as template argument selects the accuracy:
+/// - lowp: relative error lower than 1e-3,
+/// - mediump: relative error lower than 1e-5, the default,
+/// - highp: close to the accuracy of float, within 2 ULPs.
+/// The errors of fastLog and fastLog2 are relative to max(1, |result|).
+/// The vectors and the arrays of floats have the range of the normal floats:
+/// results which underflow are flushed to zero and denormal inputs of the
+/// logarithms are handled as zeros. The array versions compute 4 (SSE2) or
+/// 8 (AVX) floats at once.
+/// The float and double scalars use tables in double precision instead, which
+/// is faster, with shorter expansions for lowp and mediump within the same
+/// bounds. Floats keep the range of the normal floats, doubles get the range of
+/// double and use the standard library out of the normal doubles.
+/// 
 /// <glm/gtx/fast_exponential.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +55,7 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTX_fast_exponential extension included")
@@ -50,7 +66,22 @@ namespace glm
 	/// @addtogroup gtx_fast_exponential
 	/// @{
 
-	/// Faster than the common pow function but less accurate.
+	/// Faster than the common pow function but less accurate, x must be positive.
+	/// The relative error grows with |y * log2(x)|, it is about twice the one of the accuracy Q when it is lower than 1.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename genType> 
+	GLM_FUNC_DECL genType fastPow(
+		genType const & x, 
+		genType const & y);
+
+	/// Faster than the common pow function but less accurate, x must be positive.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType> 
+	GLM_FUNC_DECL vecType<T, P> fastPow(
+		vecType<T, P> const & x, 
+		vecType<T, P> const & y);
+
+	/// fastPow with the mediump accuracy.
 	/// @see gtx_fast_exponential
 	template <typename genType> 
 	GLM_FUNC_DECL genType fastPow(
@@ -63,28 +94,122 @@ namespace glm
 	GLM_FUNC_DECL genTypeT fastPow(
 		genTypeT const & x, 
 		genTypeU const & y);
-		
+
+	/// Write fastPow of the Count values of x and y in Out.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T> 
+	GLM_FUNC_DECL void fastPow(T const * x, T const * y, T * Out, std::size_t Count);
+
+	/// Write fastPow with the mediump accuracy of the Count values of x and y in Out.
+	/// @see gtx_fast_exponential
+	template <typename T> 
+	GLM_FUNC_DECL void fastPow(T const * x, T const * y, T * Out, std::size_t Count);
+
 	/// Faster than the common exp function but less accurate.
+	/// Returns 0 for floats x < -87.3365, the lowest normal float.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename genType> 
+	GLM_FUNC_DECL genType fastExp(genType const & x);
+
+	/// Faster than the common exp function but less accurate.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType> 
+	GLM_FUNC_DECL vecType<T, P> fastExp(vecType<T, P> const & x);
+
+	/// fastExp with the mediump accuracy.
 	/// @see gtx_fast_exponential
 	template <typename T> 
 	GLM_FUNC_DECL T fastExp(const T& x);
-		
+
+	/// Write fastExp of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T> 
+	GLM_FUNC_DECL void fastExp(T const * In, T * Out, std::size_t Count);
+
+	/// Write fastExp with the mediump accuracy of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <typename T> 
+	GLM_FUNC_DECL void fastExp(T const * In, T * Out, std::size_t Count);
+
+	/// Faster than the common log function but less accurate.
+	/// Returns -inf for x = 0 and NaN for negative x.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename genType> 
+	GLM_FUNC_DECL genType fastLog(genType const & x);
+
 	/// Faster than the common log function but less accurate.
 	/// @see gtx_fast_exponential
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType> 
+	GLM_FUNC_DECL vecType<T, P> fastLog(vecType<T, P> const & x);
+
+	/// fastLog with the mediump accuracy.
+	/// @see gtx_fast_exponential
 	template <typename T> 
 	GLM_FUNC_DECL T fastLog(const T& x);
 
+	/// Write fastLog of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T> 
+	GLM_FUNC_DECL void fastLog(T const * In, T * Out, std::size_t Count);
+
+	/// Write fastLog with the mediump accuracy of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <typename T> 
+	GLM_FUNC_DECL void fastLog(T const * In, T * Out, std::size_t Count);
+
 	/// Faster than the common exp2 function but less accurate.
+	/// Returns 0 for x < -126, the lowest normal float.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename genType> 
+	GLM_FUNC_DECL genType fastExp2(genType const & x);
+
+	/// Faster than the common exp2 function but less accurate.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType> 
+	GLM_FUNC_DECL vecType<T, P> fastExp2(vecType<T, P> const & x);
+
+	/// fastExp2 with the mediump accuracy.
 	/// @see gtx_fast_exponential
 	template <typename T> 
 	GLM_FUNC_DECL T fastExp2(const T& x);
-		
+
+	/// Write fastExp2 of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T> 
+	GLM_FUNC_DECL void fastExp2(T const * In, T * Out, std::size_t Count);
+
+	/// Write fastExp2 with the mediump accuracy of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <typename T> 
+	GLM_FUNC_DECL void fastExp2(T const * In, T * Out, std::size_t Count);
+
+	/// Faster than the common log2 function but less accurate.
+	/// Returns -inf for x = 0 and NaN for negative x.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename genType> 
+	GLM_FUNC_DECL genType fastLog2(genType const & x);
+
 	/// Faster than the common log2 function but less accurate.
 	/// @see gtx_fast_exponential
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType> 
+	GLM_FUNC_DECL vecType<T, P> fastLog2(vecType<T, P> const & x);
+
+	/// fastLog2 with the mediump accuracy.
+	/// @see gtx_fast_exponential
 	template <typename T> 
 	GLM_FUNC_DECL T fastLog2(const T& x);
 
-	/// Faster than the common ln function but less accurate.
+	/// Write fastLog2 of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <precision Q, typename T> 
+	GLM_FUNC_DECL void fastLog2(T const * In, T * Out, std::size_t Count);
+
+	/// Write fastLog2 with the mediump accuracy of the Count values of In in Out.
+	/// @see gtx_fast_exponential
+	template <typename T> 
+	GLM_FUNC_DECL void fastLog2(T const * In, T * Out, std::size_t Count);
+
+	/// Faster than the common ln function but less accurate, same as fastLog.
 	/// @see gtx_fast_exponential
 	template <typename T> 
 	GLM_FUNC_DECL T fastLn(const T& x);
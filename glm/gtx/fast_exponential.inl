@@ -2,21 +2,577 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2006-01-09
-// Updated : 2006-01-09
+// Updated : 2014-10-16
 // Licence : This source is under MIT License
 // File    : glm/gtx/fast_exponential.inl
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace glm
+#include "../detail/_lane.hpp"
+#include <cstring>
+#include <limits>
+
+namespace glm{
+namespace detail
 {
+	// (exp(r) - 1 - r) / r^2 for |r| <= ln(2) / 2. The lowp and mediump polynomials are minimax
+	// approximations of exp(r) with relative errors of 1.3e-4 and 5.4e-6, highp is the one of Cephes.
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_exp_tail(L const & r)
+	{
+		if(Q == lowp)
+			return L(5.0394102672e-1f) + r * L(1.6662810850e-1f);
+		if(Q == mediump)
+			return L(5.0005116021e-1f) + r * (L(1.6753513912e-1f) + r * L(4.1277747587e-2f));
+		return L(5.0000001201e-1f) + r * (L(1.6666665459e-1f) + r * (L(4.1665795894e-2f) + r * (L(8.3334519073e-3f) + r * (L(1.3981999507e-3f) + r * L(1.9875691500e-4f)))));
+	}
+
+	// (log(1 + r) - r + r^2 / 2) / r^3 for r in [sqrt(2) / 2 - 1, sqrt(2) - 1]. The lowp and mediump
+	// polynomials are minimax approximations of log(1 + r) with absolute errors of 2.5e-4 and 5e-7,
+	// highp is the one of Cephes.
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_log_tail(L const & r)
+	{
+		if(Q == lowp)
+			return L(3.6111720811e-1f) + r * L(-2.6384030397e-1f);
+		if(Q == mediump)
+			return L(3.3304538285e-1f) + r * (L(-2.4967428006e-1f) + r * (L(2.0788085031e-1f) + r * (L(-1.8141356525e-1f) + r * L(9.9607467633e-2f))));
+		return L(3.3333331174e-1f) + r * (L(-2.4999993993e-1f) + r * (L(2.0000714765e-1f) + r * (L(-1.6668057665e-1f) + r * (L(1.4249322787e-1f)
+			+ r * (L(-1.2420140846e-1f) + r * (L(1.1676998740e-1f) + r * (L(-1.1514610310e-1f) + r * L(7.0376836292e-2f))))))));
+	}
+
+	// Exp * 2^n for an integer n in [-126, 128], 2^128 overflows so the last power is applied as a product
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_ldexp(L const & Exp, L const & n)
+	{
+		L const High = step(L(127.5f), n);
+		return Exp * pow2i(n - High) * (L(1.0f) + High);
+	}
+
+	// Flush to zero below Min, overflow to infinity above Max and propagate NaNs
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_exp_special(L const & x, L const & Exp, L const & Min, L const & Max)
+	{
+		L const Special = select(x < Min, L(0.0f), L(std::numeric_limits<float>::infinity()));
+		return select((x >= Min) & (x <= Max), Exp, select(x == x, Special, x));
+	}
+
+	// exp(x) = 2^n * exp(r) with n the nearest integer to x / ln(2). ln(2) is split in 2 parts (Cody-Waite),
+	// n times the first part is exact.
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_exp(L const & x)
+	{
+		L const Min(-87.3365448f);
+		L const Max(88.7228394f);
+
+		L const Clamped = min(max(x, Min), Max);
+		L const n = fast_floor(Clamped * L(1.44269504088896341f) + L(0.5f));
+		L const r = (Clamped - n * L(0.693359375f)) + n * L(2.12194440e-4f);
+		L const Exp = r * r * fast_exp_tail<Q>(r) + r + L(1.0f);
+		return fast_exp_special(x, fast_ldexp(Exp, n), Min, Max);
+	}
+
+	// exp2(x) = 2^n * exp((x - n) * ln(2)) with n the nearest integer to x
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_exp2(L const & x)
+	{
+		L const Min(-126.0f);
+		L const Max(128.0f);
+
+		L const Clamped = min(max(x, Min), Max);
+		L const n = fast_floor(Clamped + L(0.5f));
+		L const r = (Clamped - n) * L(0.693147180559945309f);
+		L const Exp = r * r * fast_exp_tail<Q>(r) + r + L(1.0f);
+		return fast_exp_special(x, fast_ldexp(Exp, n), Min, Max);
+	}
+
+	// Split x in 2^Exponent * (1 + r) with r in [sqrt(2) / 2 - 1, sqrt(2) - 1],
+	// return log(1 + r) - r which is small compared to r
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_log_reduce(L const & x, L & Exponent, L & r)
+	{
+		L const Mantissa = split_exponent(x, Exponent);
+		Exponent = select(Mantissa > L(1.41421356f), Exponent + L(1.0f), Exponent);
+		r = select(Mantissa > L(1.41421356f), Mantissa * L(0.5f), Mantissa) - L(1.0f);
+
+		L const r2 = r * r;
+		return r * r2 * fast_log_tail<Q>(r) - L(0.5f) * r2;
+	}
+
+	// log(+inf) = +inf, log(0) = -inf and log(x) = NaN for negative values, denormals are handled as zeros
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_log_special(L const & x, L const & Log)
+	{
+		L const Infinity(std::numeric_limits<float>::infinity());
+		L const Special = select(x < L(0.0f), L(std::numeric_limits<float>::quiet_NaN()), select(x == Infinity, Infinity, -Infinity));
+		return select((x >= L(std::numeric_limits<float>::min())) & (x < Infinity), Log, select(x == x, Special, x));
+	}
+
+	// log(x) = Exponent * ln(2) + log(1 + r), with the same split of ln(2) as fast_exp
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_log(L const & x)
+	{
+		L Exponent, r;
+		L const Tail = fast_log_reduce<Q>(x, Exponent, r);
+		return fast_log_special(x, (r + (Tail - Exponent * L(2.12194440e-4f))) + Exponent * L(0.693359375f));
+	}
+
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_log2(L const & x)
+	{
+		L Exponent, r;
+		L const Tail = fast_log_reduce<Q>(x, Exponent, r);
+		return fast_log_special(x, Exponent + (r + Tail) * L(1.44269504088896341f));
+	}
+
+	// The scalar versions compute in double precision with tables, which is faster than the polynomials
+	// of the lanes. Q selects the order of the expansions after the table lookups. Floats keep the ranges
+	// of the lanes, doubles get the range of double, the standard library computes the results out of
+	// the normal doubles.
+	template <typename T>
+	struct fast_exponential_table
+	{
+		static double const Exp2[128];
+		static double const Rcp[64];
+		static double const Log2[64];
+	};
+
+	// 2^(i / 128)
+	template <typename T>
+	double const fast_exponential_table<T>::Exp2[128] =
+	{
+		1.0, 1.0054299011128027, 1.0108892860517005, 1.016378314910953,
+		1.0218971486541166, 1.0274459491187637, 1.0330248790212284, 1.0386341019613787,
+		1.0442737824274138, 1.0499440858006872, 1.0556451783605572, 1.061377227289262,
+		1.0671404006768237, 1.0729348675259756, 1.0787607977571199, 1.0846183622133092,
+		1.0905077326652577, 1.0964290818163769, 1.102382583307841, 1.1083684117236787,
+		1.1143867425958924, 1.1204377524096067, 1.1265216186082418, 1.1326385195987192,
+		1.1387886347566916, 1.1449721444318042, 1.1511892299529827, 1.1574400736337511,
+		1.1637248587775775, 1.1700437696832502, 1.1763969916502812, 1.182784710984341,
+		1.189207115002721, 1.1956643920398273, 1.202156731452703, 1.2086843236265816,
+		1.215247359980469, 1.2218460329727576, 1.22848053610687, 1.2351510639369334,
+		1.241857812073484, 1.2486009771892048, 1.255380757024691, 1.2621973503942507,
+		1.2690509571917332, 1.275941778396392, 1.2828700160787783, 1.2898358734066657,
+		1.2968395546510096, 1.3038812651919358, 1.3109612115247644, 1.318079601266064,
+		1.3252366431597413, 1.3324325470831615, 1.339667524053303, 1.3469417862329458,
+		1.3542555469368927, 1.3616090206382248, 1.3690024229745905, 1.3764359707545302,
+		1.383909881963832, 1.3914243757719262, 1.3989796725383112, 1.4065759938190154,
+		1.4142135623730951, 1.4218926021691656, 1.42961333839197, 1.4373759974489824,
+		1.4451808069770467, 1.4530279958490526, 1.460917794180647, 1.4688504333369818,
+		1.4768261459394993, 1.4848451658727524, 1.4929077282912648, 1.5010140696264256,
+		1.5091644275934228, 1.5173590411982147, 1.5255981507445384, 1.533881997840956,
+		1.5422108254079407, 1.550584877685, 1.559004400237837, 1.567469639965553,
+		1.5759808451078865, 1.5845382652524937, 1.593142151342267, 1.6017927556826934,
+		1.6104903319492543, 1.6192351351948637, 1.6280274218573478, 1.6368674497669644,
+		1.645755478153965, 1.6546917676561943, 1.6636765803267364, 1.6727101796415966,
+		1.681792830507429, 1.6909247992693053, 1.7001063537185235, 1.709337763100463,
+		1.718619298122478, 1.7279512309618377, 1.7373338352737062, 1.746767386199169,
+		1.7562521603732995, 1.7657884359332727, 1.7753764925265212, 1.785016611318935,
+		1.7947090750031072, 1.804454167806624, 1.8142521755003989, 1.8241033854070534,
+		1.8340080864093424, 1.843966568958626, 1.8539791250833855, 1.864046048397789,
+		1.8741676341103, 1.8843441790323345, 1.8945759815869656, 1.9048633418176741,
+		1.9152065613971474, 1.925605943636125, 1.9360617934922943, 1.9465744175792332,
+		1.9571441241754002, 1.9677712232331759, 1.978456026387951, 1.9891988469672663
+	};
+
+	// 1 / c and log2(c) for c the center of the i-th interval of fast_log_scalar, 1 for the two intervals
+	// around 1 to keep the relative accuracy of the results close to 0
+	template <typename T>
+	double const fast_exponential_table<T>::Rcp[64] =
+	{
+		1.4463276836158192, 1.4301675977653632, 1.4143646408839778, 1.3989071038251366,
+		1.3837837837837839, 1.3689839572192513, 1.3544973544973544, 1.3403141361256545,
+		1.3264248704663213, 1.3128205128205128, 1.299492385786802, 1.2864321608040201,
+		1.2736318407960199, 1.2610837438423645, 1.248780487804878, 1.2367149758454106,
+		1.2248803827751196, 1.2132701421800949, 1.2018779342723005, 1.1906976744186046,
+		1.1797235023041475, 1.1689497716894977, 1.158371040723982, 1.147982062780269,
+		1.1377777777777778, 1.1277533039647578, 1.1179039301310043, 1.1082251082251082,
+		1.0987124463519313, 1.0893617021276596, 1.080168776371308, 1.0711297071129706,
+		1.062240663900415, 1.0534979423868314, 1.0448979591836736, 1.0364372469635628,
+		1.0281124497991967, 1.0199203187250996, 1.0118577075098814, 1.0,
+		1.0, 0.9770992366412213, 0.9624060150375939, 0.9481481481481482,
+		0.9343065693430657, 0.920863309352518, 0.9078014184397163, 0.8951048951048951,
+		0.8827586206896552, 0.8707482993197279, 0.8590604026845637, 0.847682119205298,
+		0.8366013071895425, 0.8258064516129032, 0.8152866242038217, 0.8050314465408805,
+		0.7950310559006211, 0.7852760736196319, 0.7757575757575758, 0.7664670658682635,
+		0.757396449704142, 0.7485380116959064, 0.7398843930635838, 0.7314285714285714
+	};
+
+	template <typename T>
+	double const fast_exponential_table<T>::Log2[64] =
+	{
+		-0.5323944499170026, -0.5161842227357436, -0.5001541129167947, -0.4843001617159575,
+		-0.46861853948368787, -0.4531055401123633, -0.4377575757789273, -0.4225711719642513,
+		-0.4075429627319196, -0.3926696862503893, -0.3779481805436237, -0.3633753794563512,
+		-0.34894830882107136, -0.3346640828148238, -0.320519900494554, -0.30651304250067474,
+		-0.29264086791911725, -0.27890081129281485, -0.26529037977416176, -0.2518071504105397,
+		-0.2384487675555207, -0.22521294039882658, -0.21209744060856844, -0.19910010007969528,
+		-0.18621880878296293, -0.17345151270908502, -0.16079621190305607, -0.14825095858394247,
+		-0.13581385534571977, -0.12348305343500028, -0.1112567511017409, -0.09913319201925144,
+		-0.08711066377003839, -0.0751874963942191, -0.06336206099742944, -0.05163276841532235,
+		-0.03999806793191906, -0.02845644604922801, -0.01700642530568987, 0.0,
+		0.0, 0.03342300153745028, 0.0552824355011896, 0.0768155970508309,
+		0.09803208296052672, 0.11894107272350743, 0.13955135239879354, 0.1598713367783894,
+		0.17990909001493446, 0.1996723448363644, 0.21916852046216156, 0.2384047393250789,
+		0.25738784269265175, 0.27612440527423754, 0.294620748891627, 0.31288295528435534,
+		0.33091687811461695, 0.34872815423107756, 0.3663222142458158, 0.38370429247405224,
+		0.4008794362821843, 0.41785251488589786, 0.43462822763672465, 0.4512111118323288
+	};
+
+	// 2^(z / 128) for z in [-130816, 130944], 2^(z / 128) = 2^(k / 128) * exp(r) with k the nearest integer
+	// to z and r = (z - k) * ln(2) / 128. 2^(k / 128) is built from the table and the exponent bits, exp(r)
+	// is expanded to the first order for lowp and mediump, a relative error of 3.7e-6, and to the second
+	// order for highp.
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_exp2_scalar(double z)
+	{
+#		if((GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG)) && !defined(__FAST_MATH__))
+			// Adding 1.5 * 2^52 rounds to the nearest integer, which is in the low bits, fast math would
+			// simplify the subtraction
+			double const Shifted = z + 6755399441055744.0;
+			uint64 k;
+			std::memcpy(&k, &Shifted, sizeof(k));
+			double const u = z - (Shifted - 6755399441055744.0);
+#		elif(GLM_ARCH & GLM_ARCH_SSE2)
+			uint64 const k = static_cast<uint64>(static_cast<int64>(_mm_cvtsd_si32(_mm_set_sd(z))));
+			double const u = z - static_cast<double>(static_cast<int64>(k));
+#		else
+			// Shifted by a multiple of 128 to truncate positive values
+			uint64 const k = static_cast<uint64>(static_cast<int64>(static_cast<int32>(z + 131072.5) - 131072));
+			double const u = z - static_cast<double>(static_cast<int64>(k));
+#		endif
+
+		// k / 128 is the exponent of 2^(k / 128)
+		uint64 Bits;
+		std::memcpy(&Bits, &fast_exponential_table<void>::Exp2[k & 127], sizeof(Bits));
+		Bits += (k >> 7) << 52;
+		double Scale;
+		std::memcpy(&Scale, &Bits, sizeof(Scale));
+
+		if(Q == highp)
+			return Scale * (1.0 + u * (0.0054152123481245725 + u * 1.4662262387640423e-05));
+		return Scale * (1.0 + u * 0.0054152123481245725);
+	}
+
+	// log(1 + r) for |r| < 1/64, expanded to the first order for lowp, an absolute error of 1.2e-4, to the
+	// second order for mediump, 1.3e-6, and to the fourth order for highp
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_log1p_scalar(double r)
+	{
+		if(Q == lowp)
+			return r;
+		if(Q == mediump)
+			return r * (1.0 - r * 0.5);
+		return r * (1.0 + r * (-0.5 + r * (0.333333333333333333 - r * 0.25)));
+	}
+
+	// log2(1 + r) with the expansions of fast_log1p_scalar
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_log2_1p_scalar(double r)
+	{
+		if(Q == lowp)
+			return r * 1.44269504088896341;
+		if(Q == mediump)
+			return r * (1.44269504088896341 - r * 0.721347520444481703);
+		return r * (1.44269504088896341 + r * (-0.721347520444481703 + r * (0.480898346962987803 - r * 0.360673760222240852)));
+	}
+
+	// log2(1 + r) for fast_pow, which only needs the absolute accuracy of the logarithm, the third order
+	// is enough for highp
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_pow_log2_1p_scalar(double r)
+	{
+		if(Q == highp)
+			return r * (1.44269504088896341 + r * (-0.721347520444481703 + r * 0.480898346962987803));
+		return fast_log2_1p_scalar<Q>(r);
+	}
+
+	// x = 2^e * c * (1 + r) with c the center of the interval of [0.6875, 1.375) holding x / 2^e, split in
+	// intervals of 1/128 below 1 and 1/64 above. Base = e + log2(c). False when x isn't a positive normal number.
+	GLM_FUNC_QUALIFIER bool fast_log_scalar(float x, double & Base, double & r)
+	{
+		uint32 Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		if(Bits - 0x00800000u >= 0x7f000000u)
+			return false;
+
+		uint32 const Offset = Bits - 0x3f300000u;
+		uint32 const Index = (Offset >> 17) & 63;
+		Bits -= Offset & 0xff800000u;
+		float z;
+		std::memcpy(&z, &Bits, sizeof(z));
+		Base = static_cast<double>(static_cast<int32>(Offset) >> 23) + fast_exponential_table<void>::Log2[Index];
+		r = z * fast_exponential_table<void>::Rcp[Index] - 1.0;
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER bool fast_log_scalar(double x, double & Base, double & r)
+	{
+		uint64 Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		if(Bits - 0x0010000000000000ull >= 0x7fe0000000000000ull)
+			return false;
+
+		uint64 const Offset = Bits - 0x3fe6000000000000ull;
+		uint32 const Index = static_cast<uint32>(Offset >> 46) & 63;
+		Bits -= Offset & 0xfff0000000000000ull;
+		double z;
+		std::memcpy(&z, &Bits, sizeof(z));
+		Base = static_cast<double>(static_cast<int64>(Offset) >> 52) + fast_exponential_table<void>::Log2[Index];
+		r = z * fast_exponential_table<void>::Rcp[Index] - 1.0;
+		return true;
+	}
+
+	// The first check keeps the common values, the others are close to the overflow or out of the range
+	template <precision Q>
+	GLM_FUNC_QUALIFIER float fast_exp(float const & x)
+	{
+		float const Min(-87.3365448f);
+		float const Max(88.7228394f);
+		if(!(std::abs(x) <= -Min))
+			return x > 0.0f && x <= Max ? static_cast<float>(fast_exp2_scalar<Q>(x * 184.6649652337873)) : fast_exp_special(x, 0.0f, Min, Max);
+		return static_cast<float>(fast_exp2_scalar<Q>(x * 184.6649652337873));
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_exp(double const & x)
+	{
+		if(!(std::abs(x) <= 708.396418532264106))
+			return x > 0.0 && x <= 709.089565712824051 ? fast_exp2_scalar<Q>(x * 184.6649652337873) : std::exp(x);
+		return fast_exp2_scalar<Q>(x * 184.6649652337873);
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER float fast_exp2(float const & x)
+	{
+		if(!(std::abs(x) <= 126.0f))
+			return x > 0.0f && x <= 128.0f ? static_cast<float>(fast_exp2_scalar<Q>(x * 128.0)) : fast_exp_special(x, 0.0f, -126.0f, 128.0f);
+		return static_cast<float>(fast_exp2_scalar<Q>(x * 128.0));
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_exp2(double const & x)
+	{
+		if(!(std::abs(x) <= 1022.0))
+			return x > 0.0 && x <= 1023.0 ? fast_exp2_scalar<Q>(x * 128.0) : std::pow(2.0, x);
+		return fast_exp2_scalar<Q>(x * 128.0);
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER float fast_log(float const & x)
+	{
+		double Base(0), r(0);
+		if(!fast_log_scalar(x, Base, r))
+			return fast_log_special(x, 0.0f);
+		return static_cast<float>(Base * 0.693147180559945309 + fast_log1p_scalar<Q>(r));
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_log(double const & x)
+	{
+		double Base(0), r(0);
+		if(!fast_log_scalar(x, Base, r))
+			return std::log(x);
+		return Base * 0.693147180559945309 + fast_log1p_scalar<Q>(r);
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER float fast_log2(float const & x)
+	{
+		double Base(0), r(0);
+		if(!fast_log_scalar(x, Base, r))
+			return fast_log_special(x, 0.0f);
+		return static_cast<float>(Base + fast_log2_1p_scalar<Q>(r));
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_log2(double const & x)
+	{
+		double Base(0), r(0);
+		if(!fast_log_scalar(x, Base, r))
+			return std::log(x) * 1.44269504088896341;
+		return Base + fast_log2_1p_scalar<Q>(r);
+	}
+
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_pow(L const & x, L const & y)
+	{
+		return fast_exp2<Q>(y * fast_log2<Q>(x));
+	}
+
+	// y * log2(x) stays in double precision between the scalar logarithm and exponential
+	template <precision Q>
+	GLM_FUNC_QUALIFIER float fast_pow(float const & x, float const & y)
+	{
+		double Base(0), r(0);
+		if(!fast_log_scalar(x, Base, r))
+			return fast_exp2<Q>(y * fast_log2<Q>(x));
+
+		double const t = y * (Base + fast_pow_log2_1p_scalar<Q>(r));
+		if(!(std::abs(t) <= 126.0))
+			return fast_exp2<Q>(static_cast<float>(t));
+		return static_cast<float>(fast_exp2_scalar<Q>(t * 128.0));
+	}
+
+	template <precision Q>
+	GLM_FUNC_QUALIFIER double fast_pow(double const & x, double const & y)
+	{
+		double Base(0), r(0);
+		if(!fast_log_scalar(x, Base, r))
+			return fast_exp2<Q>(y * fast_log2<Q>(x));
+
+		double const t = y * (Base + fast_pow_log2_1p_scalar<Q>(r));
+		if(!(std::abs(t) <= 1022.0))
+			return fast_exp2<Q>(t);
+		return fast_exp2_scalar<Q>(t * 128.0);
+	}
+
+	enum fast_exponential_func
+	{
+		FAST_EXP,
+		FAST_EXP2,
+		FAST_LOG,
+		FAST_LOG2
+	};
+
+	template <fast_exponential_func func, precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_exponential(L const & x)
+	{
+		switch(func)
+		{
+		default:
+		case FAST_EXP:
+			return fast_exp<Q>(x);
+		case FAST_EXP2:
+			return fast_exp2<Q>(x);
+		case FAST_LOG:
+			return fast_log<Q>(x);
+		case FAST_LOG2:
+			return fast_log2<Q>(x);
+		}
+	}
+
+	template <typename T>
+	struct compute_fast_exponential
+	{
+		template <fast_exponential_func func, precision Q>
+		GLM_FUNC_QUALIFIER static void call(T const * In, T * Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fast_exponential<func, Q>(In[i]);
+		}
+
+		template <precision Q>
+		GLM_FUNC_QUALIFIER static void pow(T const * x, T const * y, T * Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fast_pow<Q>(x[i], y[i]);
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <>
+	struct compute_fast_exponential<float>
+	{
+		typedef lane<float> lane_type;
+
+		static std::size_t const Size = lane_type::size;
+
+		template <fast_exponential_func func, precision Q>
+		GLM_FUNC_QUALIFIER static void call(float const * In, float * Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				lane_type::store(Out + i, fast_exponential<func, Q>(lane_type::load(In + i, 1)));
+
+			// Padded with ones which are valid inputs of all the functions
+			if(i < Count)
+			{
+				float Tail[Size];
+				for(std::size_t j = 0; j < Size; ++j)
+					Tail[j] = i + j < Count ? In[i + j] : 1.0f;
+				lane_type::store(Tail, fast_exponential<func, Q>(lane_type::load(Tail, 1)));
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Out[i + j] = Tail[j];
+			}
+		}
+
+		template <precision Q>
+		GLM_FUNC_QUALIFIER static void pow(float const * x, float const * y, float * Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				lane_type::store(Out + i, fast_pow<Q>(lane_type::load(x + i, 1), lane_type::load(y + i, 1)));
+
+			if(i < Count)
+			{
+				float TailX[Size], TailY[Size];
+				for(std::size_t j = 0; j < Size; ++j)
+				{
+					TailX[j] = i + j < Count ? x[i + j] : 1.0f;
+					TailY[j] = i + j < Count ? y[i + j] : 1.0f;
+				}
+				lane_type::store(TailX, fast_pow<Q>(lane_type::load(TailX, 1), lane_type::load(TailY, 1)));
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Out[i + j] = TailX[j];
+			}
+		}
+	};
+
+	template <fast_exponential_func func, precision Q, precision P>
+	GLM_FUNC_QUALIFIER tvec4<float, P> fast_exponential(tvec4<float, P> const & x)
+	{
+		tvec4<float, P> Result;
+		_mm_storeu_ps(&Result.x, fast_exponential<func, Q>(lane4_ps(_mm_loadu_ps(&x.x))).data);
+		return Result;
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	template <fast_exponential_func func, precision Q, typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> fast_exponential(vecType<T, P> const & x)
+	{
+		vecType<T, P> Result;
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = fast_exponential<func, Q>(x[i]);
+		return Result;
+	}
+}//namespace detail
+
 	// fastPow:
+	template <precision Q, typename genType>
+	GLM_FUNC_QUALIFIER genType fastPow(genType const & x, genType const & y)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'fastPow' only accept floating-point inputs");
+		return detail::fast_pow<Q>(x, y);
+	}
+
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> fastPow(vecType<T, P> const & x, vecType<T, P> const & y)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastPow' only accept floating-point inputs");
+		vecType<T, P> Result;
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = detail::fast_pow<Q>(x[i], y[i]);
+		return Result;
+	}
+
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType fastPow(genType const & x, genType const & y)
 	{
-		return exp(y * log(x));
+		return fastPow<mediump>(x, y);
 	}
 
-	VECTORIZE_VEC_VEC(fastPow)
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastPow(T const * x, T const * y, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastPow' only accept floating-point inputs");
+		detail::compute_fast_exponential<T>::template pow<Q>(x, y, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastPow(T const * x, T const * y, T * Out, std::size_t Count)
+	{
+		fastPow<mediump>(x, y, Out, Count);
+	}
 
 	template <typename T>
 	GLM_FUNC_QUALIFIER T fastPow(const T x, int y)
@@ -29,7 +585,7 @@ namespace glm
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tvec2<T, P> fastPow(
-		const detail::tvec2<T, P>& x, 
+		const detail::tvec2<T, P>& x,
 		const detail::tvec2<int, P>& y)
 	{
 		return detail::tvec2<T, P>(
@@ -39,7 +595,7 @@ namespace glm
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tvec3<T, P> fastPow(
-		const detail::tvec3<T, P>& x, 
+		const detail::tvec3<T, P>& x,
 		const detail::tvec3<int, P>& y)
 	{
 		return detail::tvec3<T, P>(
@@ -50,7 +606,7 @@ namespace glm
 
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tvec4<T, P> fastPow(
-		const detail::tvec4<T, P>& x, 
+		const detail::tvec4<T, P>& x,
 		const detail::tvec4<int, P>& y)
 	{
 		return detail::tvec4<T, P>(
@@ -61,88 +617,145 @@ namespace glm
 	}
 
 	// fastExp
-	// Note: This function provides accurate results only for value between -1 and 1, else avoid it.
-	template <typename T>
-	GLM_FUNC_QUALIFIER T fastExp(const T x)
+	template <precision Q, typename genType>
+	GLM_FUNC_QUALIFIER genType fastExp(genType const & x)
 	{
-		// This has a better looking and same performance in release mode than the following code. However, in debug mode it's slower.
-		// return 1.0f + x * (1.0f + x * 0.5f * (1.0f + x * 0.3333333333f * (1.0f + x * 0.25 * (1.0f + x * 0.2f))));
-		T x2 = x * x;
-		T x3 = x2 * x;
-		T x4 = x3 * x;
-		T x5 = x4 * x;
-		return T(1) + x + (x2 * T(0.5)) + (x3 * T(0.1666666667)) + (x4 * T(0.041666667)) + (x5 * T(0.008333333333));
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'fastExp' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_EXP, Q>(x);
 	}
-	/*  // Try to handle all values of float... but often shower than std::exp, glm::floor and the loop kill the performance
-	GLM_FUNC_QUALIFIER float fastExp(float x)
-	{
-		const float e = 2.718281828f;
-		const float IntegerPart = floor(x);
-		const float FloatPart = x - IntegerPart;
-		float z = 1.f;
 
-		for(int i = 0; i < int(IntegerPart); ++i)
-			z *= e;
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> fastExp(vecType<T, P> const & x)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastExp' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_EXP, Q>(x);
+	}
 
-		const float x2 = FloatPart * FloatPart;
-		const float x3 = x2 * FloatPart;
-		const float x4 = x3 * FloatPart;
-		const float x5 = x4 * FloatPart;
-		return z * (1.0f + FloatPart + (x2 * 0.5f) + (x3 * 0.1666666667f) + (x4 * 0.041666667f) + (x5 * 0.008333333333f));
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fastExp(const T& x)
+	{
+		return fastExp<mediump>(x);
 	}
 
-	// Increase accuracy on number bigger that 1 and smaller than -1 but it's not enough for high and negative numbers
-	GLM_FUNC_QUALIFIER float fastExp(float x)
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastExp(T const * In, T * Out, std::size_t Count)
 	{
-		// This has a better looking and same performance in release mode than the following code. However, in debug mode it's slower.
-		// return 1.0f + x * (1.0f + x * 0.5f * (1.0f + x * 0.3333333333f * (1.0f + x * 0.25 * (1.0f + x * 0.2f))));
-		float x2 = x * x;
-		float x3 = x2 * x;
-		float x4 = x3 * x;
-		float x5 = x4 * x;
-		float x6 = x5 * x;
-		float x7 = x6 * x;
-		float x8 = x7 * x;
-		return 1.0f + x + (x2 * 0.5f) + (x3 * 0.1666666667f) + (x4 * 0.041666667f) + (x5 * 0.008333333333f)+ (x6 * 0.00138888888888f) + (x7 * 0.000198412698f) + (x8 * 0.0000248015873f);;
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastExp' only accept floating-point inputs");
+		detail::compute_fast_exponential<T>::template call<detail::FAST_EXP, Q>(In, Out, Count);
 	}
-	*/
 
-	VECTORIZE_VEC(fastExp)
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastExp(T const * In, T * Out, std::size_t Count)
+	{
+		fastExp<mediump>(In, Out, Count);
+	}
 
 	// fastLog
-	template <typename genType>
+	template <precision Q, typename genType>
 	GLM_FUNC_QUALIFIER genType fastLog(genType const & x)
 	{
-		return std::log(x);
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'fastLog' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_LOG, Q>(x);
 	}
 
-	/* Slower than the VC7.1 function...
-	GLM_FUNC_QUALIFIER float fastLog(float x)
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> fastLog(vecType<T, P> const & x)
 	{
-		float y1 = (x - 1.0f) / (x + 1.0f);
-		float y2 = y1 * y1;
-		return 2.0f * y1 * (1.0f + y2 * (0.3333333333f + y2 * (0.2f + y2 * 0.1428571429f)));
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastLog' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_LOG, Q>(x);
 	}
-	*/
 
-	VECTORIZE_VEC(fastLog)
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fastLog(const T& x)
+	{
+		return fastLog<mediump>(x);
+	}
 
-	//fastExp2, ln2 = 0.69314718055994530941723212145818f
-	template <typename genType>
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastLog(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastLog' only accept floating-point inputs");
+		detail::compute_fast_exponential<T>::template call<detail::FAST_LOG, Q>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastLog(T const * In, T * Out, std::size_t Count)
+	{
+		fastLog<mediump>(In, Out, Count);
+	}
+
+	// fastExp2
+	template <precision Q, typename genType>
 	GLM_FUNC_QUALIFIER genType fastExp2(genType const & x)
 	{
-		return fastExp(0.69314718055994530941723212145818f * x);
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'fastExp2' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_EXP2, Q>(x);
+	}
+
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> fastExp2(vecType<T, P> const & x)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastExp2' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_EXP2, Q>(x);
 	}
 
-	VECTORIZE_VEC(fastExp2)
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fastExp2(const T& x)
+	{
+		return fastExp2<mediump>(x);
+	}
 
-	// fastLog2, ln2 = 0.69314718055994530941723212145818f
-	template <typename genType>
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastExp2(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastExp2' only accept floating-point inputs");
+		detail::compute_fast_exponential<T>::template call<detail::FAST_EXP2, Q>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastExp2(T const * In, T * Out, std::size_t Count)
+	{
+		fastExp2<mediump>(In, Out, Count);
+	}
+
+	// fastLog2
+	template <precision Q, typename genType>
 	GLM_FUNC_QUALIFIER genType fastLog2(genType const & x)
 	{
-		return fastLog(x) / 0.69314718055994530941723212145818f;
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'fastLog2' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_LOG2, Q>(x);
 	}
 
-	VECTORIZE_VEC(fastLog2)
+	template <precision Q, typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER vecType<T, P> fastLog2(vecType<T, P> const & x)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastLog2' only accept floating-point inputs");
+		return detail::fast_exponential<detail::FAST_LOG2, Q>(x);
+	}
 
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fastLog2(const T& x)
+	{
+		return fastLog2<mediump>(x);
+	}
+
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastLog2(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastLog2' only accept floating-point inputs");
+		detail::compute_fast_exponential<T>::template call<detail::FAST_LOG2, Q>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastLog2(T const * In, T * Out, std::size_t Count)
+	{
+		fastLog2<mediump>(In, Out, Count);
+	}
+
+	// fastLn
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fastLn(const T& x)
+	{
+		return fastLog(x);
+	}
 }//namespace glm
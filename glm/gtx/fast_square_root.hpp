@@ -22,7 +22,7 @@
 ///
 /// @ref gtx_fast_square_root
 /// @file glm/gtx/fast_square_root.hpp
-/// @date 2006-01-04 / 2011-06-07
+/// @date 2006-01-04 / 2014-10-16
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -34,6 +34,13 @@
 /// - Sqrt optimisation based on Newton's method, 
 /// www.gamedev.net/community/forums/topic.asp?topic id=139956
 /// 
+/// The array versions of fastInverseSqrt and fastNormalize compute 4 (SSE2)
+/// or 8 (AVX) floats at once. The precision qualifier passed as template
+/// argument selects the accuracy:
+/// - lowp: the rsqrt estimate, relative error lower than 2e-3 (4e-4 with SSE),
+/// - mediump: the estimate refined by a Newton-Raphson step, relative error lower than 5e-6 (5e-7 with SSE), the default,
+/// - highp: a square root and a division, the same results as inversesqrt and normalize.
+/// 
 /// <glm/gtx/fast_square_root.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +48,7 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTX_fast_square_root extension included")
@@ -81,6 +89,72 @@ namespace glm
 	template <typename genType> 
 	GLM_FUNC_DECL genType fastNormalize(genType const & x);
 
+	//! Write the inverse square roots of the Count values of In in Out, with the accuracy Q.
+	//! From GLM_GTX_fast_square_root extension.
+	template <precision Q, typename T>
+	GLM_FUNC_DECL void fastInverseSqrt(T const * In, T * Out, std::size_t Count);
+
+	//! Write the inverse square roots of the Count values of In in Out, with the mediump accuracy.
+	//! From GLM_GTX_fast_square_root extension.
+	template <typename T>
+	GLM_FUNC_DECL void fastInverseSqrt(T const * In, T * Out, std::size_t Count);
+
+	//! Normalize Count vectors with the accuracy Q, In and Out may be the same array.
+	//! Vectors with a squared length lower than the smallest normal number of type T,
+	//! like zero length vectors, or higher than the largest one are written as zero vectors.
+	//! From GLM_GTX_fast_square_root extension.
+	template <precision Q, typename T, precision P>
+	GLM_FUNC_DECL void fastNormalize(detail::tvec3<T, P> const * In, detail::tvec3<T, P> * Out, std::size_t Count);
+
+	//! Normalize Count vectors with the accuracy Q, In and Out may be the same array.
+	//! From GLM_GTX_fast_square_root extension.
+	template <precision Q, typename T, precision P>
+	GLM_FUNC_DECL void fastNormalize(detail::tvec4<T, P> const * In, detail::tvec4<T, P> * Out, std::size_t Count);
+
+	//! Normalize Count vectors with the mediump accuracy.
+	//! From GLM_GTX_fast_square_root extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void fastNormalize(detail::tvec3<T, P> const * In, detail::tvec3<T, P> * Out, std::size_t Count);
+
+	//! Normalize Count vectors with the mediump accuracy.
+	//! From GLM_GTX_fast_square_root extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void fastNormalize(detail::tvec4<T, P> const * In, detail::tvec4<T, P> * Out, std::size_t Count);
+
+	//! Normalize Count vectors stored as one array per component, with the accuracy Q.
+	//! The input and output arrays may be the same.
+	//! From GLM_GTX_fast_square_root extension.
+	template <precision Q, typename T>
+	GLM_FUNC_DECL void fastNormalize(
+		T const * InX, T const * InY, T const * InZ,
+		T * OutX, T * OutY, T * OutZ,
+		std::size_t Count);
+
+	//! Normalize Count vectors stored as one array per component, with the accuracy Q.
+	//! The input and output arrays may be the same.
+	//! From GLM_GTX_fast_square_root extension.
+	template <precision Q, typename T>
+	GLM_FUNC_DECL void fastNormalize(
+		T const * InX, T const * InY, T const * InZ, T const * InW,
+		T * OutX, T * OutY, T * OutZ, T * OutW,
+		std::size_t Count);
+
+	//! Normalize Count vectors stored as one array per component, with the mediump accuracy.
+	//! From GLM_GTX_fast_square_root extension.
+	template <typename T>
+	GLM_FUNC_DECL void fastNormalize(
+		T const * InX, T const * InY, T const * InZ,
+		T * OutX, T * OutY, T * OutZ,
+		std::size_t Count);
+
+	//! Normalize Count vectors stored as one array per component, with the mediump accuracy.
+	//! From GLM_GTX_fast_square_root extension.
+	template <typename T>
+	GLM_FUNC_DECL void fastNormalize(
+		T const * InX, T const * InY, T const * InZ, T const * InW,
+		T * OutX, T * OutY, T * OutZ, T * OutW,
+		std::size_t Count);
+
 	/// @}
 }// namespace glm
 
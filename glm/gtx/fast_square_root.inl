@@ -2,13 +2,174 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2006-01-04
-// Updated : 2011-10-14
+// Updated : 2014-10-16
 // Licence : This source is under MIT License
 // File    : glm/gtx/fast_square_root.inl
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace glm
+#include "../detail/_lane.hpp"
+#include <limits>
+
+namespace glm{
+namespace detail
 {
+	template <precision Q, typename L>
+	GLM_FUNC_QUALIFIER L fast_inversesqrt(L const & x)
+	{
+		if(Q == highp)
+			return L(1.0f) / sqrt(x);
+
+		L const Estimate = rsqrt(x);
+		if(Q == lowp)
+			return Estimate;
+
+		// One Newton-Raphson step doubles the number of correct bits
+		return Estimate * (L(1.5f) - L(0.5f) * x * Estimate * Estimate);
+	}
+
+	// Vectors whose squared length is not a normal number of type T are set to zero
+	template <precision Q, length_t Components, typename T, typename L>
+	GLM_FUNC_QUALIFIER void fast_normalize_soa(L v[Components])
+	{
+		L Dot = v[0] * v[0];
+		for(length_t i = 1; i < Components; ++i)
+			Dot = Dot + v[i] * v[i];
+
+		L const Scale = select(
+			(Dot >= L(std::numeric_limits<T>::min())) & (Dot <= L(std::numeric_limits<T>::max())),
+			fast_inversesqrt<Q>(Dot), L(0.0f));
+		for(length_t i = 0; i < Components; ++i)
+			v[i] = v[i] * Scale;
+	}
+
+	template <typename T, precision P>
+	struct compute_fast_square_root
+	{
+		template <precision Q>
+		GLM_FUNC_QUALIFIER static void inversesqrt(T const * In, T * Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fast_inversesqrt<Q>(In[i]);
+		}
+
+		template <precision Q, length_t Components, template <typename, precision> class vecType>
+		GLM_FUNC_QUALIFIER static void normalize(vecType<T, P> const * In, vecType<T, P> * Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T v[Components];
+				for(length_t j = 0; j < Components; ++j)
+					v[j] = In[i][j];
+				fast_normalize_soa<Q, Components, T>(v);
+				for(length_t j = 0; j < Components; ++j)
+					Out[i][j] = v[j];
+			}
+		}
+
+		template <precision Q, length_t Components>
+		GLM_FUNC_QUALIFIER static void normalize_soa(T const * const In[Components], T * const Out[Components], std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T v[Components];
+				for(length_t j = 0; j < Components; ++j)
+					v[j] = In[j][i];
+				fast_normalize_soa<Q, Components, T>(v);
+				for(length_t j = 0; j < Components; ++j)
+					Out[j][i] = v[j];
+			}
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_fast_square_root<float, P>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		template <precision Q>
+		GLM_FUNC_QUALIFIER static void inversesqrt(float const * In, float * Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				lane_type::store(Out + i, fast_inversesqrt<Q>(lane_type::load(In + i, 1)));
+
+			if(i < Count)
+			{
+				float Tail[Size];
+				for(std::size_t j = 0; j < Size; ++j)
+					Tail[j] = i + j < Count ? In[i + j] : 1.0f;
+				lane_type::store(Tail, fast_inversesqrt<Q>(lane_type::load(Tail, 1)));
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Out[i + j] = Tail[j];
+			}
+		}
+
+		template <precision Q, length_t Components, template <typename, precision> class vecType>
+		GLM_FUNC_QUALIFIER static void normalize_block(vecType<float, P> const * In, vecType<float, P> * Out)
+		{
+			L v[Components];
+			lane_type::template load_soa<Components>(&In[0].x, Components, v);
+			fast_normalize_soa<Q, Components, float>(v);
+			lane_type::template store_soa<Components>(&Out[0].x, Components, v);
+		}
+
+		template <precision Q, length_t Components, template <typename, precision> class vecType>
+		GLM_FUNC_QUALIFIER static void normalize(vecType<float, P> const * In, vecType<float, P> * Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				normalize_block<Q, Components>(In + i, Out + i);
+
+			if(i < Count)
+			{
+				vecType<float, P> Tail[Size];
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Tail[j] = In[i + j];
+				normalize_block<Q, Components>(Tail, Tail);
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Out[i + j] = Tail[j];
+			}
+		}
+
+		template <precision Q, length_t Components>
+		GLM_FUNC_QUALIFIER static void normalize_soa(float const * const In[Components], float * const Out[Components], std::size_t Count)
+		{
+			L v[Components];
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+			{
+				for(length_t j = 0; j < Components; ++j)
+					v[j] = lane_type::load(In[j] + i, 1);
+				fast_normalize_soa<Q, Components, float>(v);
+				for(length_t j = 0; j < Components; ++j)
+					lane_type::store(Out[j] + i, v[j]);
+			}
+
+			if(i < Count)
+			{
+				float Tail[Components][Size];
+				for(length_t j = 0; j < Components; ++j)
+				for(std::size_t k = 0; k < Size; ++k)
+					Tail[j][k] = i + k < Count ? In[j][i + k] : 0.0f;
+				for(length_t j = 0; j < Components; ++j)
+					v[j] = lane_type::load(Tail[j], 1);
+				fast_normalize_soa<Q, Components, float>(v);
+				for(length_t j = 0; j < Components; ++j)
+				{
+					lane_type::store(Tail[j], v[j]);
+					for(std::size_t k = 0; i + k < Count; ++k)
+						Out[j][i + k] = Tail[j][k];
+				}
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
 	// fastSqrt
 	template <typename genType>
 	GLM_FUNC_QUALIFIER genType fastSqrt
@@ -177,4 +338,94 @@ namespace glm
 		valType sqr = x.x * x.x + x.y * x.y + x.z * x.z + x.w * x.w;
 		return x * fastInverseSqrt(sqr);
 	}
+
+	// Arrays
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastInverseSqrt(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastInverseSqrt' only accept floating-point inputs");
+		detail::compute_fast_square_root<T, defaultp>::template inversesqrt<Q>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastInverseSqrt(T const * In, T * Out, std::size_t Count)
+	{
+		fastInverseSqrt<mediump>(In, Out, Count);
+	}
+
+	template <precision Q, typename T, precision P>
+	GLM_FUNC_QUALIFIER void fastNormalize(detail::tvec3<T, P> const * In, detail::tvec3<T, P> * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastNormalize' only accept floating-point inputs");
+		detail::compute_fast_square_root<T, P>::template normalize<Q, 3>(In, Out, Count);
+	}
+
+	template <precision Q, typename T, precision P>
+	GLM_FUNC_QUALIFIER void fastNormalize(detail::tvec4<T, P> const * In, detail::tvec4<T, P> * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastNormalize' only accept floating-point inputs");
+		detail::compute_fast_square_root<T, P>::template normalize<Q, 4>(In, Out, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void fastNormalize(detail::tvec3<T, P> const * In, detail::tvec3<T, P> * Out, std::size_t Count)
+	{
+		fastNormalize<mediump>(In, Out, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void fastNormalize(detail::tvec4<T, P> const * In, detail::tvec4<T, P> * Out, std::size_t Count)
+	{
+		fastNormalize<mediump>(In, Out, Count);
+	}
+
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastNormalize
+	(
+		T const * InX, T const * InY, T const * InZ,
+		T * OutX, T * OutY, T * OutZ,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastNormalize' only accept floating-point inputs");
+		T const * const In[] = {InX, InY, InZ};
+		T * const Out[] = {OutX, OutY, OutZ};
+		detail::compute_fast_square_root<T, defaultp>::template normalize_soa<Q, 3>(In, Out, Count);
+	}
+
+	template <precision Q, typename T>
+	GLM_FUNC_QUALIFIER void fastNormalize
+	(
+		T const * InX, T const * InY, T const * InZ, T const * InW,
+		T * OutX, T * OutY, T * OutZ, T * OutW,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastNormalize' only accept floating-point inputs");
+		T const * const In[] = {InX, InY, InZ, InW};
+		T * const Out[] = {OutX, OutY, OutZ, OutW};
+		detail::compute_fast_square_root<T, defaultp>::template normalize_soa<Q, 4>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastNormalize
+	(
+		T const * InX, T const * InY, T const * InZ,
+		T * OutX, T * OutY, T * OutZ,
+		std::size_t Count
+	)
+	{
+		fastNormalize<mediump>(InX, InY, InZ, OutX, OutY, OutZ, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastNormalize
+	(
+		T const * InX, T const * InY, T const * InZ, T const * InW,
+		T * OutX, T * OutY, T * OutZ, T * OutW,
+		std::size_t Count
+	)
+	{
+		fastNormalize<mediump>(InX, InY, InZ, InW, OutX, OutY, OutZ, OutW, Count);
+	}
 }//namespace glm
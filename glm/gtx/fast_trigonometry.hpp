@@ -22,7 +22,7 @@
 ///
 /// @ref gtx_fast_trigonometry
 /// @file glm/gtx/fast_trigonometry.hpp
-/// @date 2006-01-08 / 2011-06-07
+/// @date 2006-01-08 / 2014-10-16
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -32,6 +32,13 @@
 /// 
 /// @brief Fast but less accurate implementations of trigonometric functions.
 /// 
+/// fastSin, fastCos and fastTan have the accuracy of float whatever the type.
+/// The scalar versions expand the sine around the nearest multiple of pi/64
+/// read in a table, without branches. The array versions compute 4 (SSE2) or
+/// 8 (AVX) float angles at once, reducing them to [-pi/4, pi/4] for minimax
+/// polynomials. Angles larger than 1e5 radians, infinities and NaNs are passed
+/// to the functions of the standard library.
+/// 
 /// <glm/gtx/fast_trigonometry.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +46,7 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTX_fast_trigonometry extension included")
@@ -49,24 +57,58 @@ namespace glm
 	/// @addtogroup gtx_fast_trigonometry
 	/// @{
 
-	//! Faster than the common sin function but less accurate. 
-	//! Defined between -2pi and 2pi. 
+	//! Faster than the common sin function but less accurate.
+	//! For |angle| <= 8192, the absolute error is lower than 1e-7 and,
+	//! for |angle| <= pi, lower than 2 ULPs of the float result.
+	//! Up to |angle| = 1e5, the absolute error stays lower than about 1e-6,
+	//! larger angles use std::sin so the results stay in [-1, 1].
 	//! From GLM_GTX_fast_trigonometry extension.
 	template <typename T> 
 	GLM_FUNC_DECL T fastSin(const T& angle);
 
 	//! Faster than the common cos function but less accurate.
-	//! Defined between -2pi and 2pi.
+	//! Same accuracy as fastSin.
 	//! From GLM_GTX_fast_trigonometry extension.
 	template <typename T> 
 	GLM_FUNC_DECL T fastCos(const T& angle);
 
-	//! Faster than the common tan function but less accurate. 
-	//! Defined between -2pi and 2pi. 
+	//! Faster than the common tan function but less accurate.
+	//! For |angle| <= pi, the error is lower than 4 ULPs of the float result.
+	//! Close to the poles of larger angles, the error of the range reduction dominates.
+	//! Angles larger than 1e5 use std::tan.
 	//! From GLM_GTX_fast_trigonometry extension.
 	template <typename T> 
 	GLM_FUNC_DECL T fastTan(const T& angle);
 
+	//! Compute fastSin and fastCos of angle together, sharing the range reduction.
+	//! From GLM_GTX_fast_trigonometry extension.
+	template <typename T> 
+	GLM_FUNC_DECL void fastSinCos(const T& angle, T& sin, T& cos);
+
+	//! Write fastSin of the Count angles of In in Out.
+	//! Float angles are computed by groups of 4 (SSE2) or 8 (AVX).
+	//! From GLM_GTX_fast_trigonometry extension.
+	template <typename T> 
+	GLM_FUNC_DECL void fastSin(T const * In, T * Out, std::size_t Count);
+
+	//! Write fastCos of the Count angles of In in Out.
+	//! Float angles are computed by groups of 4 (SSE2) or 8 (AVX).
+	//! From GLM_GTX_fast_trigonometry extension.
+	template <typename T> 
+	GLM_FUNC_DECL void fastCos(T const * In, T * Out, std::size_t Count);
+
+	//! Write fastTan of the Count angles of In in Out.
+	//! Float angles are computed by groups of 4 (SSE2) or 8 (AVX).
+	//! From GLM_GTX_fast_trigonometry extension.
+	template <typename T> 
+	GLM_FUNC_DECL void fastTan(T const * In, T * Out, std::size_t Count);
+
+	//! Write fastSin and fastCos of the Count angles of In in Sin and Cos.
+	//! Float angles are computed by groups of 4 (SSE2) or 8 (AVX).
+	//! From GLM_GTX_fast_trigonometry extension.
+	template <typename T> 
+	GLM_FUNC_DECL void fastSinCos(T const * In, T * Sin, T * Cos, std::size_t Count);
+
 	//! Faster than the common asin function but less accurate. 
 	//! Defined between -2pi and 2pi.
 	//! From GLM_GTX_fast_trigonometry extension.
@@ -2,18 +2,477 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2006-01-08
-// Updated : 2011-10-14
+// Updated : 2014-10-16
 // Licence : This source is under MIT License
 // File    : glm/gtx/fast_trigonometry.inl
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace glm
+#include "../detail/_lane.hpp"
+
+namespace glm{
+namespace detail
 {
+	// Beyond this angle the range reduction loses precision, the standard library is used
+	float const fast_trigonometry_max = 1e5f;
+
+	// sin and cos of x - Quadrant * pi/2, with Quadrant the nearest integer to x * 2/pi.
+	// pi/2 is split in 3 parts (Cody-Waite), Quadrant times the first part is exact for
+	// |x| <= fast_trigonometry_max. The polynomials are the minimax approximations of sin
+	// and cos on [-pi/4, pi/4] of the Cephes library.
+	template <typename L>
+	GLM_FUNC_QUALIFIER void fast_sincos_reduced(L const & x, L const & Quadrant, L & SinR, L & CosR)
+	{
+		L const r = ((x - Quadrant * L(1.5703125f)) - Quadrant * L(4.837512969970703125e-4f)) - Quadrant * L(7.54978995489188216e-8f);
+		L const r2 = r * r;
+
+		SinR = r + r * r2 * (L(-1.6666654611e-1f) + r2 * (L(8.3321608736e-3f) + r2 * L(-1.9515295891e-4f)));
+		CosR = L(1.0f) - L(0.5f) * r2 + r2 * r2 * (L(4.166664568298827e-2f) + r2 * (L(-1.388731625493765e-3f) + r2 * L(2.443315711809948e-5f)));
+	}
+
+	// Swap is true for odd quadrants, where sin(x) = +-cos(r) and cos(x) = +-sin(r).
+	template <typename L>
+	GLM_FUNC_QUALIFIER void fast_sincos_quadrant(L const & x, L & SinR, L & CosR, L & Quadrant)
+	{
+		Quadrant = fast_floor(x * L(0.636619772367581343f) + L(0.5f));
+		fast_sincos_reduced(x, Quadrant, SinR, CosR);
+
+		// Quadrant modulo 4
+		Quadrant = Quadrant - L(4.0f) * fast_floor(Quadrant * L(0.25f));
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER void fast_sincos(L const & x, L & Sin, L & Cos)
+	{
+		L SinR, CosR, Quadrant;
+		fast_sincos_quadrant(x, SinR, CosR, Quadrant);
+
+		L const Swap = (Quadrant == L(1.0f)) | (Quadrant == L(3.0f));
+		L const S = select(Swap, CosR, SinR);
+		L const C = select(Swap, SinR, CosR);
+		Sin = select(Quadrant >= L(2.0f), -S, S);
+		Cos = select((Quadrant == L(1.0f)) | (Quadrant == L(2.0f)), -C, C);
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_tan(L const & x)
+	{
+		L SinR, CosR, Quadrant;
+		fast_sincos_quadrant(x, SinR, CosR, Quadrant);
+
+		// tan(x) = -1 / tan(r) in odd quadrants
+		L const Swap = (Quadrant == L(1.0f)) | (Quadrant == L(3.0f));
+		return select(Swap, -CosR, SinR) / select(Swap, SinR, CosR);
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_sin(L const & x)
+	{
+		L Sin, Cos;
+		fast_sincos(x, Sin, Cos);
+		return Sin;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER L fast_cos(L const & x)
+	{
+		L Sin, Cos;
+		fast_sincos(x, Sin, Cos);
+		return Cos;
+	}
+
+	// The scalar versions split the angle in i * pi/64 + r, with |r| <= pi/128, in
+	// double precision and expand the sine around i * pi/64 to the third order. The
+	// coefficients of the expansion are looked up in a table of one period, the cosine is
+	// the sine a quarter period later. The only branch is the domain check.
+	template <typename T>
+	struct fast_trigonometry_table
+	{
+		static double const Rows[128][4];
+	};
+
+	// sin(a), cos(a), -sin(a) / 2 and -cos(a) / 6 for a = i * pi/64
+	template <typename T>
+	double const fast_trigonometry_table<T>::Rows[128][4] =
+	{
+		{0.0, 1.0, 0.0, -0.16666666666666666},
+		{0.049067674327418015, 0.9987954562051724, -0.024533837163709007, -0.16646590936752872},
+		{0.0980171403295606, 0.9951847266721968, -0.0490085701647803, -0.1658641211120328},
+		{0.14673047445536175, 0.989176509964781, -0.07336523722768087, -0.16486275166079684},
+		{0.19509032201612825, 0.9807852804032304, -0.09754516100806412, -0.1634642134005384},
+		{0.24298017990326387, 0.970031253194544, -0.12149008995163194, -0.161671875532424},
+		{0.29028467725446233, 0.9569403357322089, -0.14514233862723117, -0.15949005595536817},
+		{0.33688985339222005, 0.9415440651830208, -0.16844492669611003, -0.1569240108638368},
+		{0.3826834323650898, 0.9238795325112867, -0.1913417161825449, -0.15397992208521447},
+		{0.4275550934302821, 0.9039892931234433, -0.21377754671514104, -0.15066488218724056},
+		{0.47139673682599764, 0.8819212643483549, -0.23569836841299882, -0.1469868773913925},
+		{0.5141027441932217, 0.8577286100002721, -0.25705137209661083, -0.1429547683333787},
+		{0.5555702330196022, 0.8314696123025452, -0.2777851165098011, -0.13857826871709086},
+		{0.5956993044924334, 0.8032075314806448, -0.2978496522462167, -0.1338679219134408},
+		{0.6343932841636455, 0.773010453362737, -0.31719664208182274, -0.12883507556045617},
+		{0.6715589548470183, 0.7409511253549591, -0.33577947742350917, -0.12349185422582652},
+		{0.7071067811865475, 0.7071067811865475, -0.35355339059327373, -0.1178511301977579},
+		{0.7409511253549591, 0.6715589548470183, -0.37047556267747955, -0.11192649247450305},
+		{0.773010453362737, 0.6343932841636455, -0.3865052266813685, -0.10573221402727424},
+		{0.8032075314806448, 0.5956993044924334, -0.4016037657403224, -0.09928321741540556},
+		{0.8314696123025452, 0.5555702330196022, -0.4157348061512726, -0.09259503883660036},
+		{0.8577286100002721, 0.5141027441932217, -0.42886430500013606, -0.08568379069887028},
+		{0.8819212643483549, 0.47139673682599764, -0.44096063217417747, -0.07856612280433294},
+		{0.9039892931234433, 0.4275550934302821, -0.45199464656172167, -0.07125918223838035},
+		{0.9238795325112867, 0.3826834323650898, -0.46193976625564337, -0.06378057206084829},
+		{0.9415440651830208, 0.33688985339222005, -0.4707720325915104, -0.05614830889870334},
+		{0.9569403357322089, 0.29028467725446233, -0.47847016786610447, -0.048380779542410386},
+		{0.970031253194544, 0.24298017990326387, -0.485015626597272, -0.04049669665054398},
+		{0.9807852804032304, 0.19509032201612825, -0.4903926402016152, -0.032515053669354706},
+		{0.989176509964781, 0.14673047445536175, -0.4945882549823905, -0.024455079075893626},
+		{0.9951847266721968, 0.0980171403295606, -0.4975923633360984, -0.01633619005492677},
+		{0.9987954562051724, 0.049067674327418015, -0.4993977281025862, -0.008177945721236335},
+		{1.0, 0.0, -0.5, 0.0},
+		{0.9987954562051724, -0.049067674327418015, -0.4993977281025862, 0.008177945721236335},
+		{0.9951847266721968, -0.0980171403295606, -0.4975923633360984, 0.01633619005492677},
+		{0.989176509964781, -0.14673047445536175, -0.4945882549823905, 0.024455079075893626},
+		{0.9807852804032304, -0.19509032201612825, -0.4903926402016152, 0.032515053669354706},
+		{0.970031253194544, -0.24298017990326387, -0.485015626597272, 0.04049669665054398},
+		{0.9569403357322089, -0.29028467725446233, -0.47847016786610447, 0.048380779542410386},
+		{0.9415440651830208, -0.33688985339222005, -0.4707720325915104, 0.05614830889870334},
+		{0.9238795325112867, -0.3826834323650898, -0.46193976625564337, 0.06378057206084829},
+		{0.9039892931234433, -0.4275550934302821, -0.45199464656172167, 0.07125918223838035},
+		{0.8819212643483549, -0.47139673682599764, -0.44096063217417747, 0.07856612280433294},
+		{0.8577286100002721, -0.5141027441932217, -0.42886430500013606, 0.08568379069887028},
+		{0.8314696123025452, -0.5555702330196022, -0.4157348061512726, 0.09259503883660036},
+		{0.8032075314806448, -0.5956993044924334, -0.4016037657403224, 0.09928321741540556},
+		{0.773010453362737, -0.6343932841636455, -0.3865052266813685, 0.10573221402727424},
+		{0.7409511253549591, -0.6715589548470183, -0.37047556267747955, 0.11192649247450305},
+		{0.7071067811865475, -0.7071067811865475, -0.35355339059327373, 0.1178511301977579},
+		{0.6715589548470183, -0.7409511253549591, -0.33577947742350917, 0.12349185422582652},
+		{0.6343932841636455, -0.773010453362737, -0.31719664208182274, 0.12883507556045617},
+		{0.5956993044924334, -0.8032075314806448, -0.2978496522462167, 0.1338679219134408},
+		{0.5555702330196022, -0.8314696123025452, -0.2777851165098011, 0.13857826871709086},
+		{0.5141027441932217, -0.8577286100002721, -0.25705137209661083, 0.1429547683333787},
+		{0.47139673682599764, -0.8819212643483549, -0.23569836841299882, 0.1469868773913925},
+		{0.4275550934302821, -0.9039892931234433, -0.21377754671514104, 0.15066488218724056},
+		{0.3826834323650898, -0.9238795325112867, -0.1913417161825449, 0.15397992208521447},
+		{0.33688985339222005, -0.9415440651830208, -0.16844492669611003, 0.1569240108638368},
+		{0.29028467725446233, -0.9569403357322089, -0.14514233862723117, 0.15949005595536817},
+		{0.24298017990326387, -0.970031253194544, -0.12149008995163194, 0.161671875532424},
+		{0.19509032201612825, -0.9807852804032304, -0.09754516100806412, 0.1634642134005384},
+		{0.14673047445536175, -0.989176509964781, -0.07336523722768087, 0.16486275166079684},
+		{0.0980171403295606, -0.9951847266721968, -0.0490085701647803, 0.1658641211120328},
+		{0.049067674327418015, -0.9987954562051724, -0.024533837163709007, 0.16646590936752872},
+		{0.0, -1.0, 0.0, 0.16666666666666666},
+		{-0.049067674327418015, -0.9987954562051724, 0.024533837163709007, 0.16646590936752872},
+		{-0.0980171403295606, -0.9951847266721968, 0.0490085701647803, 0.1658641211120328},
+		{-0.14673047445536175, -0.989176509964781, 0.07336523722768087, 0.16486275166079684},
+		{-0.19509032201612825, -0.9807852804032304, 0.09754516100806412, 0.1634642134005384},
+		{-0.24298017990326387, -0.970031253194544, 0.12149008995163194, 0.161671875532424},
+		{-0.29028467725446233, -0.9569403357322089, 0.14514233862723117, 0.15949005595536817},
+		{-0.33688985339222005, -0.9415440651830208, 0.16844492669611003, 0.1569240108638368},
+		{-0.3826834323650898, -0.9238795325112867, 0.1913417161825449, 0.15397992208521447},
+		{-0.4275550934302821, -0.9039892931234433, 0.21377754671514104, 0.15066488218724056},
+		{-0.47139673682599764, -0.8819212643483549, 0.23569836841299882, 0.1469868773913925},
+		{-0.5141027441932217, -0.8577286100002721, 0.25705137209661083, 0.1429547683333787},
+		{-0.5555702330196022, -0.8314696123025452, 0.2777851165098011, 0.13857826871709086},
+		{-0.5956993044924334, -0.8032075314806448, 0.2978496522462167, 0.1338679219134408},
+		{-0.6343932841636455, -0.773010453362737, 0.31719664208182274, 0.12883507556045617},
+		{-0.6715589548470183, -0.7409511253549591, 0.33577947742350917, 0.12349185422582652},
+		{-0.7071067811865475, -0.7071067811865475, 0.35355339059327373, 0.1178511301977579},
+		{-0.7409511253549591, -0.6715589548470183, 0.37047556267747955, 0.11192649247450305},
+		{-0.773010453362737, -0.6343932841636455, 0.3865052266813685, 0.10573221402727424},
+		{-0.8032075314806448, -0.5956993044924334, 0.4016037657403224, 0.09928321741540556},
+		{-0.8314696123025452, -0.5555702330196022, 0.4157348061512726, 0.09259503883660036},
+		{-0.8577286100002721, -0.5141027441932217, 0.42886430500013606, 0.08568379069887028},
+		{-0.8819212643483549, -0.47139673682599764, 0.44096063217417747, 0.07856612280433294},
+		{-0.9039892931234433, -0.4275550934302821, 0.45199464656172167, 0.07125918223838035},
+		{-0.9238795325112867, -0.3826834323650898, 0.46193976625564337, 0.06378057206084829},
+		{-0.9415440651830208, -0.33688985339222005, 0.4707720325915104, 0.05614830889870334},
+		{-0.9569403357322089, -0.29028467725446233, 0.47847016786610447, 0.048380779542410386},
+		{-0.970031253194544, -0.24298017990326387, 0.485015626597272, 0.04049669665054398},
+		{-0.9807852804032304, -0.19509032201612825, 0.4903926402016152, 0.032515053669354706},
+		{-0.989176509964781, -0.14673047445536175, 0.4945882549823905, 0.024455079075893626},
+		{-0.9951847266721968, -0.0980171403295606, 0.4975923633360984, 0.01633619005492677},
+		{-0.9987954562051724, -0.049067674327418015, 0.4993977281025862, 0.008177945721236335},
+		{-1.0, 0.0, 0.5, 0.0},
+		{-0.9987954562051724, 0.049067674327418015, 0.4993977281025862, -0.008177945721236335},
+		{-0.9951847266721968, 0.0980171403295606, 0.4975923633360984, -0.01633619005492677},
+		{-0.989176509964781, 0.14673047445536175, 0.4945882549823905, -0.024455079075893626},
+		{-0.9807852804032304, 0.19509032201612825, 0.4903926402016152, -0.032515053669354706},
+		{-0.970031253194544, 0.24298017990326387, 0.485015626597272, -0.04049669665054398},
+		{-0.9569403357322089, 0.29028467725446233, 0.47847016786610447, -0.048380779542410386},
+		{-0.9415440651830208, 0.33688985339222005, 0.4707720325915104, -0.05614830889870334},
+		{-0.9238795325112867, 0.3826834323650898, 0.46193976625564337, -0.06378057206084829},
+		{-0.9039892931234433, 0.4275550934302821, 0.45199464656172167, -0.07125918223838035},
+		{-0.8819212643483549, 0.47139673682599764, 0.44096063217417747, -0.07856612280433294},
+		{-0.8577286100002721, 0.5141027441932217, 0.42886430500013606, -0.08568379069887028},
+		{-0.8314696123025452, 0.5555702330196022, 0.4157348061512726, -0.09259503883660036},
+		{-0.8032075314806448, 0.5956993044924334, 0.4016037657403224, -0.09928321741540556},
+		{-0.773010453362737, 0.6343932841636455, 0.3865052266813685, -0.10573221402727424},
+		{-0.7409511253549591, 0.6715589548470183, 0.37047556267747955, -0.11192649247450305},
+		{-0.7071067811865475, 0.7071067811865475, 0.35355339059327373, -0.1178511301977579},
+		{-0.6715589548470183, 0.7409511253549591, 0.33577947742350917, -0.12349185422582652},
+		{-0.6343932841636455, 0.773010453362737, 0.31719664208182274, -0.12883507556045617},
+		{-0.5956993044924334, 0.8032075314806448, 0.2978496522462167, -0.1338679219134408},
+		{-0.5555702330196022, 0.8314696123025452, 0.2777851165098011, -0.13857826871709086},
+		{-0.5141027441932217, 0.8577286100002721, 0.25705137209661083, -0.1429547683333787},
+		{-0.47139673682599764, 0.8819212643483549, 0.23569836841299882, -0.1469868773913925},
+		{-0.4275550934302821, 0.9039892931234433, 0.21377754671514104, -0.15066488218724056},
+		{-0.3826834323650898, 0.9238795325112867, 0.1913417161825449, -0.15397992208521447},
+		{-0.33688985339222005, 0.9415440651830208, 0.16844492669611003, -0.1569240108638368},
+		{-0.29028467725446233, 0.9569403357322089, 0.14514233862723117, -0.15949005595536817},
+		{-0.24298017990326387, 0.970031253194544, 0.12149008995163194, -0.161671875532424},
+		{-0.19509032201612825, 0.9807852804032304, 0.09754516100806412, -0.1634642134005384},
+		{-0.14673047445536175, 0.989176509964781, 0.07336523722768087, -0.16486275166079684},
+		{-0.0980171403295606, 0.9951847266721968, 0.0490085701647803, -0.1658641211120328},
+		{-0.049067674327418015, 0.9987954562051724, 0.024533837163709007, -0.16646590936752872}
+	};
+
+	GLM_FUNC_QUALIFIER double fast_trigonometry_row(uint32 Row, double r)
+	{
+		double const * C = fast_trigonometry_table<void>::Rows[Row & 127];
+		return C[0] + r * (C[1] + r * (C[2] + r * C[3]));
+	}
+
+	// Nearest integer to x * 64/pi, false when x is out of the domain, infinite or NaN
+	GLM_FUNC_QUALIFIER bool fast_trigonometry_index(double x, uint32 & Index)
+	{
+#		if(GLM_ARCH & GLM_ARCH_SSE2)
+			// The conversion gives INT_MIN for NaNs and overflows
+			Index = static_cast<uint32>(_mm_cvtsd_si32(_mm_set_sd(x * 20.371832715762602978)));
+			return Index + 2037184u <= 4074368u;
+#		else
+			if(!(std::abs(x) <= static_cast<double>(fast_trigonometry_max)))
+				return false;
+			// Shifted by a multiple of 128 to truncate positive values
+			Index = static_cast<uint32>(static_cast<int>(x * 20.371832715762602978 + 2037248.5)) - 2037248u;
+			return true;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER double fast_trigonometry_reduce(double x, uint32 Index)
+	{
+		return x - static_cast<double>(static_cast<int>(Index)) * 0.049087385212340519350978;
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fast_sin_scalar(T const & x, uint32 Shift)
+	{
+		uint32 Index;
+		if(!fast_trigonometry_index(x, Index))
+			return Shift ? std::cos(x) : std::sin(x);
+
+		double const r = fast_trigonometry_reduce(x, Index);
+		return static_cast<T>(fast_trigonometry_row(Index + Shift, r));
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fast_sincos_scalar(T const & x, T & Sin, T & Cos)
+	{
+		uint32 Index;
+		if(!fast_trigonometry_index(x, Index))
+		{
+			Sin = std::sin(x);
+			Cos = std::cos(x);
+			return;
+		}
+
+		double const r = fast_trigonometry_reduce(x, Index);
+		Sin = static_cast<T>(fast_trigonometry_row(Index, r));
+		Cos = static_cast<T>(fast_trigonometry_row(Index + 32, r));
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fast_tan_scalar(T const & x)
+	{
+		uint32 Index;
+		if(!fast_trigonometry_index(x, Index))
+			return std::tan(x);
+
+		double const r = fast_trigonometry_reduce(x, Index);
+		return static_cast<T>(fast_trigonometry_row(Index, r) / fast_trigonometry_row(Index + 32, r));
+	}
+
+	GLM_FUNC_QUALIFIER float fast_sin(float const & x)
+	{
+		return fast_sin_scalar(x, 0);
+	}
+
+	GLM_FUNC_QUALIFIER double fast_sin(double const & x)
+	{
+		return fast_sin_scalar(x, 0);
+	}
+
+	GLM_FUNC_QUALIFIER float fast_cos(float const & x)
+	{
+		return fast_sin_scalar(x, 32);
+	}
+
+	GLM_FUNC_QUALIFIER double fast_cos(double const & x)
+	{
+		return fast_sin_scalar(x, 32);
+	}
+
+	GLM_FUNC_QUALIFIER void fast_sincos(float const & x, float & Sin, float & Cos)
+	{
+		fast_sincos_scalar(x, Sin, Cos);
+	}
+
+	GLM_FUNC_QUALIFIER void fast_sincos(double const & x, double & Sin, double & Cos)
+	{
+		fast_sincos_scalar(x, Sin, Cos);
+	}
+
+	GLM_FUNC_QUALIFIER float fast_tan(float const & x)
+	{
+		return fast_tan_scalar(x);
+	}
+
+	GLM_FUNC_QUALIFIER double fast_tan(double const & x)
+	{
+		return fast_tan_scalar(x);
+	}
+
+	enum fast_trigonometry_func
+	{
+		FAST_SIN,
+		FAST_COS,
+		FAST_TAN
+	};
+
+	template <fast_trigonometry_func func, typename L>
+	GLM_FUNC_QUALIFIER L fast_trigonometry(L const & x)
+	{
+		if(func == FAST_TAN)
+			return fast_tan(x);
+		if(func == FAST_SIN)
+			return fast_sin(x);
+		return fast_cos(x);
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// The lanes set in Mask are out of the domain of the range reduction, they are computed
+	// again by the scalar versions which use the standard library. NaNs stay NaNs in lanes.
+	GLM_FUNC_QUALIFIER int fast_trigonometry_outside(lane4_ps const & x)
+	{
+		return _mm_movemask_ps((abs(x) > lane4_ps(fast_trigonometry_max)).data);
+	}
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		GLM_FUNC_QUALIFIER int fast_trigonometry_outside(lane8_ps const & x)
+		{
+			return _mm256_movemask_ps((abs(x) > lane8_ps(fast_trigonometry_max)).data);
+		}
+#	endif
+
+	template <fast_trigonometry_func func>
+	GLM_FUNC_QUALIFIER void fast_trigonometry_fix(float const * In, float * Out, int Mask)
+	{
+		for(std::size_t j = 0; Mask; ++j, Mask >>= 1)
+			if(Mask & 1)
+				Out[j] = fast_trigonometry<func>(In[j]);
+	}
+
+	GLM_FUNC_QUALIFIER void fast_sincos_fix(float const * In, float * Sin, float * Cos, int Mask)
+	{
+		for(std::size_t j = 0; Mask; ++j, Mask >>= 1)
+			if(Mask & 1)
+				fast_sincos(In[j], Sin[j], Cos[j]);
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	template <typename T>
+	struct compute_fast_trigonometry
+	{
+		template <fast_trigonometry_func func>
+		GLM_FUNC_QUALIFIER static void call(T const * In, T * Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = fast_trigonometry<func>(In[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void sincos(T const * In, T * Sin, T * Cos, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				fast_sincos(In[i], Sin[i], Cos[i]);
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <>
+	struct compute_fast_trigonometry<float>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		template <fast_trigonometry_func func>
+		GLM_FUNC_QUALIFIER static void block(float const * In, float * Out)
+		{
+			L const x = lane_type::load(In, 1);
+			lane_type::store(Out, fast_trigonometry<func>(x));
+
+			int const Outside = fast_trigonometry_outside(x);
+			if(Outside)
+				fast_trigonometry_fix<func>(In, Out, Outside);
+		}
+
+		GLM_FUNC_QUALIFIER static void sincos_block(float const * In, float * Sin, float * Cos)
+		{
+			L const x = lane_type::load(In, 1);
+			L S, C;
+			fast_sincos(x, S, C);
+			lane_type::store(Sin, S);
+			lane_type::store(Cos, C);
+
+			int const Outside = fast_trigonometry_outside(x);
+			if(Outside)
+				fast_sincos_fix(In, Sin, Cos, Outside);
+		}
+
+		template <fast_trigonometry_func func>
+		GLM_FUNC_QUALIFIER static void call(float const * In, float * Out, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				block<func>(In + i, Out + i);
+
+			if(i < Count)
+			{
+				float Tail[Size] = {0}, TailOut[Size];
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Tail[j] = In[i + j];
+				block<func>(Tail, TailOut);
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Out[i + j] = TailOut[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void sincos(float const * In, float * Sin, float * Cos, std::size_t Count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				sincos_block(In + i, Sin + i, Cos + i);
+
+			if(i < Count)
+			{
+				float TailSin[Size], TailCos[Size], Tail[Size] = {0};
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Tail[j] = In[i + j];
+				sincos_block(Tail, TailSin, TailCos);
+				for(std::size_t j = 0; i + j < Count; ++j)
+				{
+					Sin[i + j] = TailSin[j];
+					Cos[i + j] = TailCos[j];
+				}
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
 	// sin
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastSin(T const & x)
 	{
-		return x - ((x * x * x) / T(6)) + ((x * x * x * x * x) / T(120)) - ((x * x * x * x * x * x * x) / T(5040));
+		return detail::fast_trigonometry<detail::FAST_SIN>(x);
 	}
 
 	VECTORIZE_VEC(fastSin)
@@ -22,7 +481,7 @@ namespace glm
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastCos(T const & x)
 	{
-		return T(1) - (x * x * T(0.5)) + (x * x * x * x * T(0.041666666666)) - (x * x * x * x * x * x * T(0.00138888888888));
+		return detail::fast_trigonometry<detail::FAST_COS>(x);
 	}
 
 	VECTORIZE_VEC(fastCos)
@@ -31,11 +490,84 @@ namespace glm
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastTan(T const & x)
 	{
-		return x + (x * x * x * T(0.3333333333)) + (x * x * x * x * x * T(0.1333333333333)) + (x * x * x * x * x * x * x * T(0.0539682539));
+		return detail::fast_trigonometry<detail::FAST_TAN>(x);
 	}
 
 	VECTORIZE_VEC(fastTan)
 
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	GLM_FUNC_QUALIFIER detail::tvec4<float, P> fastSin(detail::tvec4<float, P> const & x)
+	{
+		detail::lane4_ps const Angle(_mm_loadu_ps(&x.x));
+		detail::tvec4<float, P> Result;
+		_mm_storeu_ps(&Result.x, detail::fast_trigonometry<detail::FAST_SIN>(Angle).data);
+		int const Outside = detail::fast_trigonometry_outside(Angle);
+		if(Outside)
+			detail::fast_trigonometry_fix<detail::FAST_SIN>(&x.x, &Result.x, Outside);
+		return Result;
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER detail::tvec4<float, P> fastCos(detail::tvec4<float, P> const & x)
+	{
+		detail::lane4_ps const Angle(_mm_loadu_ps(&x.x));
+		detail::tvec4<float, P> Result;
+		_mm_storeu_ps(&Result.x, detail::fast_trigonometry<detail::FAST_COS>(Angle).data);
+		int const Outside = detail::fast_trigonometry_outside(Angle);
+		if(Outside)
+			detail::fast_trigonometry_fix<detail::FAST_COS>(&x.x, &Result.x, Outside);
+		return Result;
+	}
+
+	template <precision P>
+	GLM_FUNC_QUALIFIER detail::tvec4<float, P> fastTan(detail::tvec4<float, P> const & x)
+	{
+		detail::lane4_ps const Angle(_mm_loadu_ps(&x.x));
+		detail::tvec4<float, P> Result;
+		_mm_storeu_ps(&Result.x, detail::fast_trigonometry<detail::FAST_TAN>(Angle).data);
+		int const Outside = detail::fast_trigonometry_outside(Angle);
+		if(Outside)
+			detail::fast_trigonometry_fix<detail::FAST_TAN>(&x.x, &Result.x, Outside);
+		return Result;
+	}
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	// sincos
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastSinCos(T const & x, T & s, T & c)
+	{
+		detail::fast_sincos(x, s, c);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastSin(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastSin' only accept floating-point inputs");
+		detail::compute_fast_trigonometry<T>::template call<detail::FAST_SIN>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastCos(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastCos' only accept floating-point inputs");
+		detail::compute_fast_trigonometry<T>::template call<detail::FAST_COS>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastTan(T const * In, T * Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastTan' only accept floating-point inputs");
+		detail::compute_fast_trigonometry<T>::template call<detail::FAST_TAN>(In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void fastSinCos(T const * In, T * Sin, T * Cos, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastSinCos' only accept floating-point inputs");
+		detail::compute_fast_trigonometry<T>::sincos(In, Sin, Cos, Count);
+	}
+
 	// asin
 	template <typename T> 
 	GLM_FUNC_QUALIFIER T fastAsin(T const & x)
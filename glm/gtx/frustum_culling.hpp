@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_frustum_culling
+/// @file glm/gtx/frustum_culling.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_frustum_culling GLM_GTX_frustum_culling
+/// @ingroup gtx
+///
+/// @brief Extract the planes of a view frustum and cull arrays of spheres and boxes.
+///
+/// The bounds are stored as structures of arrays, one array per component.
+/// Float bounds are tested by blocks of 4 (SSE2) or 8 (AVX) objects against
+/// all the planes and the indices of the visible objects are written without
+/// branches. The objects are split into ranges of 4096 objects which are
+/// distributed across threads with OpenMP when it is enabled.
+///
+/// <glm/gtx/frustum_culling.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/_lane.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_frustum_culling extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum_culling
+	/// @{
+
+	/// Extract the left, right, bottom, top, near and far planes of the view frustum
+	/// of a view projection matrix, with OpenGL clip space conventions (depth in [-1, 1]).
+	/// The normals xyz are normalized and point inside the frustum, a point p is inside
+	/// a plane when dot(vec3(plane), p) + plane.w >= 0.
+	/// @see gtx_frustum_culling
+	template <typename T, precision P>
+	GLM_FUNC_DECL void frustumPlanes(
+		detail::tmat4x4<T, P> const & ViewProjection,
+		detail::tvec4<T, P> Planes[6]);
+
+	/// Write in Visible the indices, in increasing order, of the spheres that intersect
+	/// all the planes, and return their number. Visible must have room for Count indices.
+	/// The test is conservative: spheres close to the edges of the frustum may be visible.
+	/// @see gtx_frustum_culling
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_DECL std::size_t cullSpheres(
+		detail::tvec4<T, P> const Planes[6],
+		T const * CenterX,
+		T const * CenterY,
+		T const * CenterZ,
+		T const * Radius,
+		indexType * Visible,
+		std::size_t Count);
+
+	/// Write in Visible the indices, in increasing order, of the axis aligned boxes that
+	/// intersect all the planes, and return their number. Visible must have room for Count indices.
+	/// The test is conservative: boxes close to the edges of the frustum may be visible.
+	/// @see gtx_frustum_culling
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_DECL std::size_t cullBoxes(
+		detail::tvec4<T, P> const Planes[6],
+		T const * MinX,
+		T const * MinY,
+		T const * MinZ,
+		T const * MaxX,
+		T const * MaxY,
+		T const * MaxZ,
+		indexType * Visible,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "frustum_culling.inl"
@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/frustum_culling.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Objects culled by each task, a multiple of every lane size
+	std::size_t const frustum_culling_range = 4096;
+
+	enum frustum_bounds
+	{
+		FRUSTUM_SPHERES,	// Center x, y, z and radius
+		FRUSTUM_BOXES		// Min x, y, z and max x, y, z
+	};
+
+	template <typename T, precision P, typename indexType>
+	struct compute_frustum_culling
+	{
+		template <frustum_bounds kind>
+		GLM_FUNC_QUALIFIER static std::size_t call(tvec4<T, P> const * planes, T const * const bounds[6], std::size_t begin, std::size_t end, indexType * visible)
+		{
+			std::size_t Count = 0;
+			for(std::size_t i = begin; i < end; ++i)
+			{
+				bool Inside = true;
+				for(std::size_t k = 0; k < 6 && Inside; ++k)
+				{
+					tvec4<T, P> const & Plane = planes[k];
+					T Distance;
+					if(kind == FRUSTUM_SPHERES)
+						Distance = Plane.x * bounds[0][i] + Plane.y * bounds[1][i] + Plane.z * bounds[2][i] + Plane.w + bounds[3][i];
+					else // The box corner the furthest along the normal
+						Distance =
+							Plane.x * bounds[Plane.x >= T(0) ? 3 : 0][i] +
+							Plane.y * bounds[Plane.y >= T(0) ? 4 : 1][i] +
+							Plane.z * bounds[Plane.z >= T(0) ? 5 : 2][i] + Plane.w;
+					Inside = Distance >= T(0);
+				}
+				if(Inside)
+					visible[Count++] = static_cast<indexType>(i);
+			}
+			return Count;
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P, typename indexType>
+	struct compute_frustum_culling<float, P, indexType>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		template <frustum_bounds kind>
+		GLM_FUNC_QUALIFIER static L distance(L const Plane[4], length_t const Corner[3], L const Bounds[6])
+		{
+			if(kind == FRUSTUM_SPHERES)
+				return Plane[0] * Bounds[0] + Plane[1] * Bounds[1] + Plane[2] * Bounds[2] + Plane[3] + Bounds[3];
+			else
+				return Plane[0] * Bounds[Corner[0]] + Plane[1] * Bounds[Corner[1]] + Plane[2] * Bounds[Corner[2]] + Plane[3];
+		}
+
+		// Bit j is set when the object in lane j is inside all the planes, the minimum of the
+		// distances is reduced as a tree to shorten the dependency chain. For boxes, Corners[k]
+		// are the bounds of the corner the furthest along the normal of plane k.
+		template <frustum_bounds kind>
+		GLM_FUNC_QUALIFIER static int block(L const Planes[6][4], length_t const Corners[6][3], float const * const bounds[6], std::size_t i)
+		{
+			L Bounds[6];
+			Bounds[0] = lane_type::load(bounds[0] + i, 1);
+			Bounds[1] = lane_type::load(bounds[1] + i, 1);
+			Bounds[2] = lane_type::load(bounds[2] + i, 1);
+			Bounds[3] = lane_type::load(bounds[3] + i, 1);
+			if(kind == FRUSTUM_BOXES)
+			{
+				Bounds[4] = lane_type::load(bounds[4] + i, 1);
+				Bounds[5] = lane_type::load(bounds[5] + i, 1);
+			}
+
+			L const Distance01 = min(distance<kind>(Planes[0], Corners[0], Bounds), distance<kind>(Planes[1], Corners[1], Bounds));
+			L const Distance23 = min(distance<kind>(Planes[2], Corners[2], Bounds), distance<kind>(Planes[3], Corners[3], Bounds));
+			L const Distance45 = min(distance<kind>(Planes[4], Corners[4], Bounds), distance<kind>(Planes[5], Corners[5], Bounds));
+			return lane_type::movemask(min(min(Distance01, Distance23), Distance45) >= L(0.0f));
+		}
+
+		// Write the index of every lane and only advance past the visible ones
+		GLM_FUNC_QUALIFIER static std::size_t compact(int Mask, std::size_t i, std::size_t n, indexType * visible, std::size_t count)
+		{
+			for(std::size_t j = 0; j < n; ++j)
+			{
+				visible[count] = static_cast<indexType>(i + j);
+				count += static_cast<std::size_t>((Mask >> j) & 1);
+			}
+			return count;
+		}
+
+		// Same as compact for a full block, unrolled by 4 lanes to shift by constants
+		GLM_FUNC_QUALIFIER static std::size_t compact_block(int Mask, std::size_t i, indexType * visible, std::size_t count)
+		{
+			for(std::size_t j = 0; j < Size; j += 4, Mask >>= 4)
+			{
+				visible[count] = static_cast<indexType>(i + j + 0);
+				count += static_cast<std::size_t>(Mask & 1);
+				visible[count] = static_cast<indexType>(i + j + 1);
+				count += static_cast<std::size_t>((Mask >> 1) & 1);
+				visible[count] = static_cast<indexType>(i + j + 2);
+				count += static_cast<std::size_t>((Mask >> 2) & 1);
+				visible[count] = static_cast<indexType>(i + j + 3);
+				count += static_cast<std::size_t>((Mask >> 3) & 1);
+			}
+			return count;
+		}
+
+		template <frustum_bounds kind>
+		GLM_FUNC_QUALIFIER static std::size_t call(tvec4<float, P> const * planes, float const * const bounds[6], std::size_t begin, std::size_t end, indexType * visible)
+		{
+			L Planes[6][4];
+			length_t Corners[6][3];
+			for(length_t k = 0; k < 6; ++k)
+			{
+				for(length_t c = 0; c < 4; ++c)
+					Planes[k][c] = L(planes[k][c]);
+				for(length_t c = 0; c < 3; ++c)
+					Corners[k][c] = planes[k][c] >= 0.0f ? c + 3 : c;
+			}
+
+			std::size_t Count = 0;
+			std::size_t i = begin;
+			for(; i + Size <= end; i += Size)
+				Count = compact_block(block<kind>(Planes, Corners, bounds, i), i, visible, Count);
+
+			if(i < end)
+			{
+				float Tail[6][Size];
+				float const * TailBounds[6];
+				for(length_t k = 0; k < 6; ++k)
+				{
+					for(std::size_t j = 0; j < Size; ++j)
+						Tail[k][j] = i + j < end && bounds[k] ? bounds[k][i + j] : 0.0f;
+					TailBounds[k] = Tail[k];
+				}
+				Count = compact(block<kind>(Planes, Corners, TailBounds, 0), i, end - i, visible, Count);
+			}
+
+			return Count;
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+
+	// Each range writes its visible indices at its own offset, they are packed afterwards
+	template <frustum_bounds kind, typename T, precision P, typename indexType>
+	GLM_FUNC_QUALIFIER std::size_t cull_ranges(tvec4<T, P> const * planes, T const * const bounds[6], indexType * visible, std::size_t count)
+	{
+		if(count <= frustum_culling_range)
+			return compute_frustum_culling<T, P, indexType>::template call<kind>(planes, bounds, 0, count, visible);
+
+		int const RangeCount = static_cast<int>((count + frustum_culling_range - 1) / frustum_culling_range);
+		std::vector<std::size_t> Visible(static_cast<std::size_t>(RangeCount));
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for schedule(static)
+#		endif
+		for(int Range = 0; Range < RangeCount; ++Range)
+		{
+			std::size_t const Begin = static_cast<std::size_t>(Range) * frustum_culling_range;
+			std::size_t const End = min(Begin + frustum_culling_range, count);
+			Visible[static_cast<std::size_t>(Range)] = compute_frustum_culling<T, P, indexType>::template call<kind>(planes, bounds, Begin, End, visible + Begin);
+		}
+
+		std::size_t Count = Visible[0];
+		for(std::size_t Range = 1; Range < Visible.size(); ++Range)
+		{
+			// The indices are already in place while every previous range is fully visible,
+			// std::copy requires the destination to be outside of the source range
+			indexType const * First = visible + Range * frustum_culling_range;
+			if(First != visible + Count)
+				std::copy(First, First + Visible[Range], visible + Count);
+			Count += Visible[Range];
+		}
+		return Count;
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void frustumPlanes
+	(
+		detail::tmat4x4<T, P> const & ViewProjection,
+		detail::tvec4<T, P> Planes[6]
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'frustumPlanes' only accept floating-point inputs");
+
+		detail::tvec4<T, P> const Row0(ViewProjection[0][0], ViewProjection[1][0], ViewProjection[2][0], ViewProjection[3][0]);
+		detail::tvec4<T, P> const Row1(ViewProjection[0][1], ViewProjection[1][1], ViewProjection[2][1], ViewProjection[3][1]);
+		detail::tvec4<T, P> const Row2(ViewProjection[0][2], ViewProjection[1][2], ViewProjection[2][2], ViewProjection[3][2]);
+		detail::tvec4<T, P> const Row3(ViewProjection[0][3], ViewProjection[1][3], ViewProjection[2][3], ViewProjection[3][3]);
+
+		// -w <= x, y, z <= w in clip space
+		Planes[0] = Row3 + Row0;
+		Planes[1] = Row3 - Row0;
+		Planes[2] = Row3 + Row1;
+		Planes[3] = Row3 - Row1;
+		Planes[4] = Row3 + Row2;
+		Planes[5] = Row3 - Row2;
+
+		for(length_t i = 0; i < 6; ++i)
+			Planes[i] /= length(detail::tvec3<T, P>(Planes[i]));
+	}
+
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_QUALIFIER std::size_t cullSpheres
+	(
+		detail::tvec4<T, P> const Planes[6],
+		T const * CenterX,
+		T const * CenterY,
+		T const * CenterZ,
+		T const * Radius,
+		indexType * Visible,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cullSpheres' only accept floating-point inputs");
+
+		T const * const Bounds[6] = {CenterX, CenterY, CenterZ, Radius, 0, 0};
+		return detail::cull_ranges<detail::FRUSTUM_SPHERES>(Planes, Bounds, Visible, Count);
+	}
+
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_QUALIFIER std::size_t cullBoxes
+	(
+		detail::tvec4<T, P> const Planes[6],
+		T const * MinX,
+		T const * MinY,
+		T const * MinZ,
+		T const * MaxX,
+		T const * MaxY,
+		T const * MaxZ,
+		indexType * Visible,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cullBoxes' only accept floating-point inputs");
+
+		T const * const Bounds[6] = {MinX, MinY, MinZ, MaxX, MaxY, MaxZ};
+		return detail::cull_ranges<detail::FRUSTUM_BOXES>(Planes, Bounds, Visible, Count);
+	}
+}//namespace glm
@@ -41,6 +41,11 @@
 // Dependency:
 #include "../glm.hpp"
 #include "../gtx/closest_point.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/_lane.hpp"
+#endif
 
 #if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
 #	pragma message("GLM: GLM_GTX_closest_point extension included")
@@ -102,6 +107,31 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1, 
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the nearest intersection of a ray and count triangles, like intersectRayTriangle for each triangle.
+	//! On a hit, index is the index of the nearest triangle and baryPosition its result from intersectRayTriangle:
+	//! the barycentric coordinates in x and y and the distance along dir in z.
+	//! Float triangles are tested by groups of 4 (SSE2) or 8 (AVX).
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool intersectRayTriangles(
+		detail::tvec3<T, P> const & orig, detail::tvec3<T, P> const & dir,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		std::size_t count,
+		detail::tvec3<T, P> & baryPosition, std::size_t & index);
+
+	//! Compute the intersections of count rays and a triangle, like intersectRayTriangle for each ray.
+	//! baryPositions[i] is replaced when ray i hits the triangle at a distance lower than baryPositions[i].z.
+	//! Initialize the z components to the maximum distance, calling this function for each triangle keeps the nearest hit of every ray.
+	//! Returns the number of rays whose baryPositions was replaced.
+	//! Float rays are tested by groups of 4 (SSE2) or 8 (AVX).
+	//! From GLM_GTX_intersect extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL std::size_t intersectRaysTriangle(
+		detail::tvec3<T, P> const * orig, detail::tvec3<T, P> const * dir,
+		std::size_t count,
+		detail::tvec3<T, P> const & vert0, detail::tvec3<T, P> const & vert1, detail::tvec3<T, P> const & vert2,
+		detail::tvec3<T, P> * baryPositions);
+
 	/// @}
 }//namespace glm
 
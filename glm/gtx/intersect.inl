@@ -214,4 +214,232 @@ namespace glm
 		intersectionNormal2 = (intersectionPoint2 - sphereCenter) / sphereRadius;
 		return true;
 	}
+
+namespace detail
+{
+	// Same computations and tests as intersectRayTriangle, returns the mask of the hits
+	template <typename L>
+	GLM_FUNC_QUALIFIER L ray_triangle_soa(L const o[3], L const d[3], L const v0[3], L const v1[3], L const v2[3], L bary[3])
+	{
+		L const e1x = v1[0] - v0[0];
+		L const e1y = v1[1] - v0[1];
+		L const e1z = v1[2] - v0[2];
+		L const e2x = v2[0] - v0[0];
+		L const e2y = v2[1] - v0[1];
+		L const e2z = v2[2] - v0[2];
+
+		L const px = d[1] * e2z - d[2] * e2y;
+		L const py = d[2] * e2x - d[0] * e2z;
+		L const pz = d[0] * e2y - d[1] * e2x;
+
+		L const a = e1x * px + e1y * py + e1z * pz;
+		L const f = L(1.0f) / a;
+
+		L const sx = o[0] - v0[0];
+		L const sy = o[1] - v0[1];
+		L const sz = o[2] - v0[2];
+		L const u = f * (sx * px + sy * py + sz * pz);
+
+		L const qx = sy * e1z - sz * e1y;
+		L const qy = sz * e1x - sx * e1z;
+		L const qz = sx * e1y - sy * e1x;
+		L const v = f * (d[0] * qx + d[1] * qy + d[2] * qz);
+		L const t = f * (e2x * qx + e2y * qy + e2z * qz);
+
+		bary[0] = u;
+		bary[1] = v;
+		bary[2] = t;
+
+		L const Zero(0.0f);
+		L const One(1.0f);
+		return (a >= L(std::numeric_limits<float>::epsilon())) & (u >= Zero) & (u <= One) & (v >= Zero) & (v + u <= One) & (t >= Zero);
+	}
+
+	template <typename T, precision P>
+	struct compute_intersect_array
+	{
+		GLM_FUNC_QUALIFIER static bool ray_triangles(tvec3<T, P> const & orig, tvec3<T, P> const & dir, tvec3<T, P> const * vert0, tvec3<T, P> const * vert1, tvec3<T, P> const * vert2, std::size_t count, tvec3<T, P> & bary, std::size_t & index)
+		{
+			bool Found = false;
+			tvec3<T, P> Nearest(static_cast<T>(0), static_cast<T>(0), std::numeric_limits<T>::max());
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tvec3<T, P> Bary;
+				if(intersectRayTriangle(orig, dir, vert0[i], vert1[i], vert2[i], Bary) && Bary.z < Nearest.z)
+				{
+					Nearest = Bary;
+					index = i;
+					Found = true;
+				}
+			}
+			if(Found)
+				bary = Nearest;
+			return Found;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t rays_triangle(tvec3<T, P> const * orig, tvec3<T, P> const * dir, std::size_t count, tvec3<T, P> const & vert0, tvec3<T, P> const & vert1, tvec3<T, P> const & vert2, tvec3<T, P> * bary)
+		{
+			std::size_t Count = 0;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tvec3<T, P> Bary;
+				if(intersectRayTriangle(orig[i], dir[i], vert0, vert1, vert2, Bary) && Bary.z < bary[i].z)
+				{
+					bary[i] = Bary;
+					++Count;
+				}
+			}
+			return Count;
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_intersect_array<float, P>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		GLM_FUNC_QUALIFIER static void broadcast(tvec3<float, P> const & v, L out[3])
+		{
+			out[0] = L(v.x);
+			out[1] = L(v.y);
+			out[2] = L(v.z);
+		}
+
+		// Keep the first of the nearest hits of the group, in the order of the triangles
+		GLM_FUNC_QUALIFIER static void ray_triangles_block(L const O[3], L const D[3], tvec3<float, P> const * vert0, tvec3<float, P> const * vert1, tvec3<float, P> const * vert2, std::size_t i, tvec3<float, P> & nearest, std::size_t & index)
+		{
+			L V0[3], V1[3], V2[3], Bary[3];
+			lane_type::load_soa<3>(&vert0[0].x, 3, V0);
+			lane_type::load_soa<3>(&vert1[0].x, 3, V1);
+			lane_type::load_soa<3>(&vert2[0].x, 3, V2);
+
+			L Hit = ray_triangle_soa(O, D, V0, V1, V2, Bary);
+			Hit = Hit & (Bary[2] < L(nearest.z));
+			int const Mask = lane_type::movemask(Hit);
+			if(Mask == 0)
+				return;
+
+			float u[Size], v[Size], t[Size];
+			lane_type::store(u, Bary[0]);
+			lane_type::store(v, Bary[1]);
+			lane_type::store(t, Bary[2]);
+			for(std::size_t j = 0; j < Size; ++j)
+				if((Mask >> j) & 1 && t[j] < nearest.z)
+				{
+					nearest = tvec3<float, P>(u[j], v[j], t[j]);
+					index = i + j;
+				}
+		}
+
+		GLM_FUNC_QUALIFIER static bool ray_triangles(tvec3<float, P> const & orig, tvec3<float, P> const & dir, tvec3<float, P> const * vert0, tvec3<float, P> const * vert1, tvec3<float, P> const * vert2, std::size_t count, tvec3<float, P> & bary, std::size_t & index)
+		{
+			L O[3], D[3];
+			broadcast(orig, O);
+			broadcast(dir, D);
+
+			tvec3<float, P> Nearest(0.0f, 0.0f, std::numeric_limits<float>::max());
+			std::size_t Index = count;
+
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				ray_triangles_block(O, D, vert0 + i, vert1 + i, vert2 + i, i, Nearest, Index);
+
+			if(i < count)
+			{
+				// Degenerated triangles are never hit
+				tvec3<float, P> Vert0[Size], Vert1[Size], Vert2[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					Vert0[j] = vert0[i + j];
+					Vert1[j] = vert1[i + j];
+					Vert2[j] = vert2[i + j];
+				}
+				ray_triangles_block(O, D, Vert0, Vert1, Vert2, i, Nearest, Index);
+			}
+
+			if(Index == count)
+				return false;
+			bary = Nearest;
+			index = Index;
+			return true;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t rays_triangle_block(tvec3<float, P> const * orig, tvec3<float, P> const * dir, L const V0[3], L const V1[3], L const V2[3], tvec3<float, P> * bary)
+		{
+			L O[3], D[3], Bary[3], Nearest[3];
+			lane_type::load_soa<3>(&orig[0].x, 3, O);
+			lane_type::load_soa<3>(&dir[0].x, 3, D);
+			lane_type::load_soa<3>(&bary[0].x, 3, Nearest);
+
+			L Hit = ray_triangle_soa(O, D, V0, V1, V2, Bary);
+			Hit = Hit & (Bary[2] < Nearest[2]);
+			for(length_t c = 0; c < 3; ++c)
+				Nearest[c] = select(Hit, Bary[c], Nearest[c]);
+			lane_type::store_soa<3>(&bary[0].x, 3, Nearest);
+
+			return static_cast<std::size_t>(bitCount(lane_type::movemask(Hit)));
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t rays_triangle(tvec3<float, P> const * orig, tvec3<float, P> const * dir, std::size_t count, tvec3<float, P> const & vert0, tvec3<float, P> const & vert1, tvec3<float, P> const & vert2, tvec3<float, P> * bary)
+		{
+			L V0[3], V1[3], V2[3];
+			broadcast(vert0, V0);
+			broadcast(vert1, V1);
+			broadcast(vert2, V2);
+
+			std::size_t Count = 0;
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				Count += rays_triangle_block(orig + i, dir + i, V0, V1, V2, bary + i);
+
+			if(i < count)
+			{
+				// Null directions never hit
+				tvec3<float, P> Orig[Size], Dir[Size], Bary[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					Orig[j] = orig[i + j];
+					Dir[j] = dir[i + j];
+					Bary[j] = bary[i + j];
+				}
+				Count += rays_triangle_block(Orig, Dir, V0, V1, V2, Bary);
+				for(std::size_t j = 0; i + j < count; ++j)
+					bary[i + j] = Bary[j];
+			}
+
+			return Count;
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		detail::tvec3<T, P> const & orig, detail::tvec3<T, P> const & dir,
+		detail::tvec3<T, P> const * vert0, detail::tvec3<T, P> const * vert1, detail::tvec3<T, P> const * vert2,
+		std::size_t count,
+		detail::tvec3<T, P> & baryPosition, std::size_t & index
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRayTriangles' only accept floating-point inputs");
+		return detail::compute_intersect_array<T, P>::ray_triangles(orig, dir, vert0, vert1, vert2, count, baryPosition, index);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER std::size_t intersectRaysTriangle
+	(
+		detail::tvec3<T, P> const * orig, detail::tvec3<T, P> const * dir,
+		std::size_t count,
+		detail::tvec3<T, P> const & vert0, detail::tvec3<T, P> const & vert1, detail::tvec3<T, P> const & vert2,
+		detail::tvec3<T, P> * baryPositions
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'intersectRaysTriangle' only accept floating-point inputs");
+		return detail::compute_intersect_array<T, P>::rays_triangle(orig, dir, count, vert0, vert1, vert2, baryPositions);
+	}
 }//namespace glm
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_matrix_decompose
+/// @file glm/gtx/matrix_decompose.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_quaternion_array (dependence)
+///
+/// @defgroup gtx_matrix_decompose GLM_GTX_matrix_decompose
+/// @ingroup gtx
+///
+/// @brief Decompose affine matrices in translation, rotation and scale and back.
+///
+/// The columns of the upper 3x3 matrix are orthonormalized with Gram-Schmidt and
+/// the rotation is converted to a quaternion without branches, selecting the
+/// largest diagonal combination like Shepperd's method. Reflections end up in
+/// the z scale. Float arrays are decomposed and recomposed by blocks of 4 (SSE2)
+/// or 8 (AVX) matrices, one matrix per lane.
+///
+/// <glm/gtx/matrix_decompose.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/quaternion_array.hpp"
+#include "../detail/_lane.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_matrix_decompose extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_decompose
+	/// @{
+
+	/// Decompose m so that m == translate(translation) * mat4_cast(rotation) * scale(scale).
+	/// The last row of m is ignored and assumed to be (0, 0, 0, 1), the upper 3x3 matrix must be invertible.
+	/// @return true when the columns of the upper 3x3 matrix aren't orthogonal: m has a shear which isn't part of the decomposition.
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL bool decompose(
+		detail::tmat4x4<T, P> const & m,
+		detail::tvec3<T, P> & translation,
+		detail::tquat<T, P> & rotation,
+		detail::tvec3<T, P> & scale);
+
+	/// Build translate(translation) * mat4_cast(rotation) * scale(scale).
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL detail::tmat4x4<T, P> recompose(
+		detail::tvec3<T, P> const & translation,
+		detail::tquat<T, P> const & rotation,
+		detail::tvec3<T, P> const & scale);
+
+	/// Decompose count matrices, like decompose.
+	/// Sheared may be null, otherwise Sheared[i] receives the result of decompose for In[i].
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL void decompose(
+		detail::tmat4x4<T, P> const * In,
+		detail::tvec3<T, P> * Translations,
+		detail::tquat<T, P> * Rotations,
+		detail::tvec3<T, P> * Scales,
+		bool * Sheared,
+		std::size_t Count);
+
+	/// Recompose count matrices, like recompose.
+	/// @see gtx_matrix_decompose
+	template <typename T, precision P>
+	GLM_FUNC_DECL void recompose(
+		detail::tvec3<T, P> const * Translations,
+		detail::tquat<T, P> const * Rotations,
+		detail::tvec3<T, P> const * Scales,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_decompose.inl"
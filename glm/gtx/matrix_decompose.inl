@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/matrix_decompose.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// m is column major, the upper 3x3 matrix is orthonormalized with Gram-Schmidt: m = R * U
+	// with U upper triangular. The diagonal of U is the scale, the reflection goes to the z scale.
+	// Returns the sum of the squares of the shear factors, the off diagonal terms of U divided by the diagonal.
+	template <typename L>
+	GLM_FUNC_QUALIFIER L mat4_decompose_soa(L const m[16], L t[3], L q[4], L s[3])
+	{
+		t[0] = m[12];
+		t[1] = m[13];
+		t[2] = m[14];
+
+		L const Length0 = sqrt(m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+		L const r0x = m[0] / Length0;
+		L const r0y = m[1] / Length0;
+		L const r0z = m[2] / Length0;
+
+		L const Shear01 = r0x * m[4] + r0y * m[5] + r0z * m[6];
+		L const u1x = m[4] - r0x * Shear01;
+		L const u1y = m[5] - r0y * Shear01;
+		L const u1z = m[6] - r0z * Shear01;
+		L const Length1 = sqrt(u1x * u1x + u1y * u1y + u1z * u1z);
+		L const r1x = u1x / Length1;
+		L const r1y = u1y / Length1;
+		L const r1z = u1z / Length1;
+
+		L const r2x = r0y * r1z - r0z * r1y;
+		L const r2y = r0z * r1x - r0x * r1z;
+		L const r2z = r0x * r1y - r0y * r1x;
+
+		L const Shear02 = r0x * m[8] + r0y * m[9] + r0z * m[10];
+		L const Shear12 = r1x * m[8] + r1y * m[9] + r1z * m[10];
+		L const Length2 = r2x * m[8] + r2y * m[9] + r2z * m[10];
+
+		s[0] = Length0;
+		s[1] = Length1;
+		s[2] = Length2;
+
+		// Rij is the row i and the column j of the rotation, the largest of 4 * x^2, 4 * y^2,
+		// 4 * z^2 and 4 * w^2 is selected and the 3 other components are derived from it.
+		L const One(1.0f);
+		L const Sxy = r1x + r0y;
+		L const Sxz = r0z + r2x;
+		L const Syz = r2y + r1z;
+		L const Dx = r1z - r2y;
+		L const Dy = r2x - r0z;
+		L const Dz = r0y - r1x;
+
+		L const NegativeZ = r2z < L(0.0f);
+		L const LargestX = r0x > r1y;
+		L const LargestZ = r0x < -r1y;
+
+		L const Trace = select(NegativeZ,
+			select(LargestX, One + r0x - r1y - r2z, One - r0x + r1y - r2z),
+			select(LargestZ, One - r0x - r1y + r2z, One + r0x + r1y + r2z));
+		L const Factor = L(0.5f) / sqrt(Trace);
+
+		q[0] = Factor * select(NegativeZ, select(LargestX, Trace, Sxy), select(LargestZ, Sxz, Dx));
+		q[1] = Factor * select(NegativeZ, select(LargestX, Sxy, Trace), select(LargestZ, Syz, Dy));
+		q[2] = Factor * select(NegativeZ, select(LargestX, Sxz, Syz), select(LargestZ, Trace, Dz));
+		q[3] = Factor * select(NegativeZ, select(LargestX, Dx, Dy), select(LargestZ, Dz, Trace));
+
+		return (Shear01 * Shear01) / (Length1 * Length1) + (Shear02 * Shear02 + Shear12 * Shear12) / (Length2 * Length2);
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER void mat4_recompose_soa(L const t[3], L const q[4], L const s[3], L out[16])
+	{
+		L Rotation[9];
+		quat_mat3_soa(q, Rotation);
+
+		L const Zero(0.0f);
+		for(length_t i = 0; i < 3; ++i)
+		{
+			out[i * 4 + 0] = Rotation[i * 3 + 0] * s[i];
+			out[i * 4 + 1] = Rotation[i * 3 + 1] * s[i];
+			out[i * 4 + 2] = Rotation[i * 3 + 2] * s[i];
+			out[i * 4 + 3] = Zero;
+		}
+		out[12] = t[0];
+		out[13] = t[1];
+		out[14] = t[2];
+		out[15] = L(1.0f);
+	}
+
+	// Shear factors are significant above the square root of the epsilon of T
+	template <typename T>
+	GLM_FUNC_QUALIFIER bool is_sheared(T ShearSquared)
+	{
+		return ShearSquared > std::numeric_limits<T>::epsilon();
+	}
+
+	template <typename T, precision P>
+	struct compute_matrix_decompose
+	{
+		GLM_FUNC_QUALIFIER static bool decompose(tmat4x4<T, P> const & m, tvec3<T, P> & t, tquat<T, P> & q, tvec3<T, P> & s)
+		{
+			return is_sheared(mat4_decompose_soa(&m[0][0], &t.x, &q.x, &s.x));
+		}
+
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> recompose(tvec3<T, P> const & t, tquat<T, P> const & q, tvec3<T, P> const & s)
+		{
+			tmat4x4<T, P> Result(tmat4x4<T, P>::_null);
+			mat4_recompose_soa(&t.x, &q.x, &s.x, &Result[0][0]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void decompose(tmat4x4<T, P> const * in, tvec3<T, P> * t, tquat<T, P> * q, tvec3<T, P> * s, bool * sheared, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				bool const Sheared = decompose(in[i], t[i], q[i], s[i]);
+				if(sheared)
+					sheared[i] = Sheared;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void recompose(tvec3<T, P> const * t, tquat<T, P> const * q, tvec3<T, P> const * s, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = recompose(t[i], q[i], s[i]);
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_matrix_decompose<float, P>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		GLM_FUNC_QUALIFIER static bool decompose(tmat4x4<float, P> const & m, tvec3<float, P> & t, tquat<float, P> & q, tvec3<float, P> & s)
+		{
+			return is_sheared(mat4_decompose_soa(&m[0][0], &t.x, &q.x, &s.x));
+		}
+
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> recompose(tvec3<float, P> const & t, tquat<float, P> const & q, tvec3<float, P> const & s)
+		{
+			tmat4x4<float, P> Result(tmat4x4<float, P>::_null);
+			mat4_recompose_soa(&t.x, &q.x, &s.x, &Result[0][0]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void decompose_block(tmat4x4<float, P> const * in, tvec3<float, P> * t, tquat<float, P> * q, tvec3<float, P> * s, bool * sheared)
+		{
+			L M[16], Translation[3], Rotation[4], Scale[3];
+			lane_type::load_soa<4>(&in[0][0].x, 16, M + 0);
+			lane_type::load_soa<4>(&in[0][1].x, 16, M + 4);
+			lane_type::load_soa<4>(&in[0][2].x, 16, M + 8);
+			lane_type::load_soa<4>(&in[0][3].x, 16, M + 12);
+
+			L const Shear = mat4_decompose_soa(M, Translation, Rotation, Scale);
+
+			lane_type::store_soa<3>(&t[0].x, 3, Translation);
+			lane_type::store_soa<4>(&q[0].x, 4, Rotation);
+			lane_type::store_soa<3>(&s[0].x, 3, Scale);
+
+			if(sheared)
+			{
+				float Flags[Size];
+				lane_type::store(Flags, select(Shear > L(std::numeric_limits<float>::epsilon()), L(1.0f), L(0.0f)));
+				for(std::size_t j = 0; j < Size; ++j)
+					sheared[j] = Flags[j] != 0.0f;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void recompose_block(tvec3<float, P> const * t, tquat<float, P> const * q, tvec3<float, P> const * s, tmat4x4<float, P> * out)
+		{
+			L Translation[3], Rotation[4], Scale[3], Result[16];
+			lane_type::load_soa<3>(&t[0].x, 3, Translation);
+			lane_type::load_soa<4>(&q[0].x, 4, Rotation);
+			lane_type::load_soa<3>(&s[0].x, 3, Scale);
+
+			mat4_recompose_soa(Translation, Rotation, Scale, Result);
+
+			lane_type::store_soa<4>(&out[0][0].x, 16, Result + 0);
+			lane_type::store_soa<4>(&out[0][1].x, 16, Result + 4);
+			lane_type::store_soa<4>(&out[0][2].x, 16, Result + 8);
+			lane_type::store_soa<4>(&out[0][3].x, 16, Result + 12);
+		}
+
+		GLM_FUNC_QUALIFIER static void decompose(tmat4x4<float, P> const * in, tvec3<float, P> * t, tquat<float, P> * q, tvec3<float, P> * s, bool * sheared, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				decompose_block(in + i, t + i, q + i, s + i, sheared ? sheared + i : 0);
+
+			if(i < count)
+			{
+				// Identity padding keeps the unused lanes invertible
+				tmat4x4<float, P> In[Size];
+				tvec3<float, P> Translation[Size], Scale[Size];
+				tquat<float, P> Rotation[Size];
+				bool Sheared[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+					In[j] = in[i + j];
+				decompose_block(In, Translation, Rotation, Scale, Sheared);
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					t[i + j] = Translation[j];
+					q[i + j] = Rotation[j];
+					s[i + j] = Scale[j];
+					if(sheared)
+						sheared[i + j] = Sheared[j];
+				}
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void recompose(tvec3<float, P> const * t, tquat<float, P> const * q, tvec3<float, P> const * s, tmat4x4<float, P> * out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				recompose_block(t + i, q + i, s + i, out + i);
+
+			if(i < count)
+			{
+				tvec3<float, P> Translation[Size], Scale[Size];
+				tquat<float, P> Rotation[Size];
+				tmat4x4<float, P> Result[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					Translation[j] = t[i + j];
+					Rotation[j] = q[i + j];
+					Scale[j] = s[i + j];
+				}
+				recompose_block(Translation, Rotation, Scale, Result);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER bool decompose
+	(
+		detail::tmat4x4<T, P> const & m,
+		detail::tvec3<T, P> & translation,
+		detail::tquat<T, P> & rotation,
+		detail::tvec3<T, P> & scale
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'decompose' only accept floating-point inputs");
+		return detail::compute_matrix_decompose<T, P>::decompose(m, translation, rotation, scale);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T, P> recompose
+	(
+		detail::tvec3<T, P> const & translation,
+		detail::tquat<T, P> const & rotation,
+		detail::tvec3<T, P> const & scale
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'recompose' only accept floating-point inputs");
+		return detail::compute_matrix_decompose<T, P>::recompose(translation, rotation, scale);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void decompose
+	(
+		detail::tmat4x4<T, P> const * In,
+		detail::tvec3<T, P> * Translations,
+		detail::tquat<T, P> * Rotations,
+		detail::tvec3<T, P> * Scales,
+		bool * Sheared,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'decompose' only accept floating-point inputs");
+		detail::compute_matrix_decompose<T, P>::decompose(In, Translations, Rotations, Scales, Sheared, Count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void recompose
+	(
+		detail::tvec3<T, P> const * Translations,
+		detail::tquat<T, P> const * Rotations,
+		detail::tvec3<T, P> const * Scales,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'recompose' only accept floating-point inputs");
+		detail::compute_matrix_decompose<T, P>::recompose(Translations, Rotations, Scales, Out, Count);
+	}
+}//namespace glm
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_matrix_hierarchy
+/// @file glm/gtx/matrix_hierarchy.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_matrix_hierarchy GLM_GTX_matrix_hierarchy
+/// @ingroup gtx
+///
+/// @brief Concatenation of arrays of mat4 and propagation of the world matrices of a hierarchy.
+///
+/// The nodes of a hierarchy are sorted so that each parent comes before its
+/// children. The nodes are processed by runs of nodes whose parents all come
+/// before the run, which are the levels of the hierarchy when the nodes are
+/// sorted by depth, as a breadth first traversal does. The nodes of a run are
+/// split into tiles of 256 nodes which are distributed across threads with
+/// OpenMP when it is enabled. The tiles are only the unit of work given to
+/// each thread, a single thread processes the nodes in order.
+/// Float matrices are multiplied with SSE2 intrinsics, VEX encoded when AVX
+/// is enabled, other types use the generic matrix product.
+///
+/// <glm/gtx/matrix_hierarchy.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_matrix_hierarchy extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_hierarchy
+	/// @{
+
+	/// Multiply Count pairs of matrices: Out[i] = A[i] * B[i].
+	/// Out may alias A or B but the arrays must not partially overlap.
+	/// @see gtx_matrix_hierarchy
+	template <typename T, precision P>
+	GLM_FUNC_DECL void multiply(
+		detail::tmat4x4<T, P> const * A,
+		detail::tmat4x4<T, P> const * B,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count);
+
+	/// Compute the world matrices of Count nodes: Worlds[i] = Worlds[Parents[i]] * Locals[i].
+	/// A node whose parent index isn't lower than its own index, such as -1, is a root: Worlds[i] = Locals[i].
+	/// Worlds may alias Locals.
+	/// @see gtx_matrix_hierarchy
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_DECL void propagateHierarchy(
+		detail::tmat4x4<T, P> const * Locals,
+		indexType const * Parents,
+		detail::tmat4x4<T, P> * Worlds,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_hierarchy.inl"
@@ -0,0 +1,172 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/matrix_hierarchy.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Nodes multiplied by each OpenMP task, without OpenMP the tiles are processed in order
+	std::size_t const matrix_hierarchy_tile = 256;
+
+	template <typename T, precision P>
+	struct compute_matrix_hierarchy
+	{
+		GLM_FUNC_QUALIFIER static void multiply(tmat4x4<T, P> const * a, tmat4x4<T, P> const * b, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = a[i] * b[i];
+		}
+
+		template <typename indexType>
+		GLM_FUNC_QUALIFIER static void propagate(tmat4x4<T, P> const * Locals, indexType const * Parents, tmat4x4<T, P> * Worlds, std::size_t Begin, std::size_t End)
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				std::size_t const Parent = static_cast<std::size_t>(Parents[i]);
+				if(Parent < i)
+					Worlds[i] = Worlds[Parent] * Locals[i];
+				else
+					Worlds[i] = Locals[i];
+			}
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Same as sse_mul_ps but the components of b are broadcast from memory, which VEX
+	// encoded loads do without shuffles. a is passed in registers and each column of
+	// b is read before the same column of out is written, out may alias b.
+	GLM_FUNC_QUALIFIER void sse_mul_columns_ps(__m128 const a[4], float const * b, float * out)
+	{
+		for(length_t k = 0; k < 4; ++k)
+		{
+			__m128 const m0 = _mm_mul_ps(a[0], _mm_set1_ps(b[k * 4 + 0]));
+			__m128 const m1 = _mm_mul_ps(a[1], _mm_set1_ps(b[k * 4 + 1]));
+			__m128 const m2 = _mm_mul_ps(a[2], _mm_set1_ps(b[k * 4 + 2]));
+			__m128 const m3 = _mm_mul_ps(a[3], _mm_set1_ps(b[k * 4 + 3]));
+			_mm_storeu_ps(out + k * 4, _mm_add_ps(_mm_add_ps(m0, m1), _mm_add_ps(m2, m3)));
+		}
+	}
+
+	template <precision P>
+	struct compute_matrix_hierarchy<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void load(tmat4x4<float, P> const & m, __m128 out[4])
+		{
+			out[0] = _mm_loadu_ps(&m[0].x);
+			out[1] = _mm_loadu_ps(&m[1].x);
+			out[2] = _mm_loadu_ps(&m[2].x);
+			out[3] = _mm_loadu_ps(&m[3].x);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(tmat4x4<float, P> const * a, tmat4x4<float, P> const * b, tmat4x4<float, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				__m128 A[4];
+				load(a[i], A);
+				sse_mul_columns_ps(A, &b[i][0].x, &out[i][0].x);
+			}
+		}
+
+		// Siblings are usually contiguous, the world matrix of their parent stays in registers
+		template <typename indexType>
+		GLM_FUNC_QUALIFIER static void propagate(tmat4x4<float, P> const * Locals, indexType const * Parents, tmat4x4<float, P> * Worlds, std::size_t Begin, std::size_t End)
+		{
+			__m128 World[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+			std::size_t Loaded = ~std::size_t(0);
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				std::size_t const Parent = static_cast<std::size_t>(Parents[i]);
+				if(Parent < i)
+				{
+					if(Parent != Loaded)
+					{
+						load(Worlds[Parent], World);
+						Loaded = Parent;
+					}
+					sse_mul_columns_ps(World, &Locals[i][0].x, &Worlds[i][0].x);
+				}
+				else
+					Worlds[i] = Locals[i];
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void multiply
+	(
+		detail::tmat4x4<T, P> const * A,
+		detail::tmat4x4<T, P> const * B,
+		detail::tmat4x4<T, P> * Out,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'multiply' only accept floating-point inputs");
+
+		int const TileCount = static_cast<int>((Count + detail::matrix_hierarchy_tile - 1) / detail::matrix_hierarchy_tile);
+
+#		if GLM_HAS_OPENMP
+#			pragma omp parallel for schedule(static) if(TileCount > 1)
+#		endif
+		for(int Tile = 0; Tile < TileCount; ++Tile)
+		{
+			std::size_t const Begin = static_cast<std::size_t>(Tile) * detail::matrix_hierarchy_tile;
+			std::size_t const End = min(Begin + detail::matrix_hierarchy_tile, Count);
+			detail::compute_matrix_hierarchy<T, P>::multiply(A + Begin, B + Begin, Out + Begin, End - Begin);
+		}
+	}
+
+	template <typename T, precision P, typename indexType>
+	GLM_FUNC_QUALIFIER void propagateHierarchy
+	(
+		detail::tmat4x4<T, P> const * Locals,
+		indexType const * Parents,
+		detail::tmat4x4<T, P> * Worlds,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'propagateHierarchy' only accept floating-point inputs");
+
+		std::size_t RunBegin = 0;
+		while(RunBegin < Count)
+		{
+			// Extend the run while the parents of its nodes come before it
+			std::size_t RunEnd = RunBegin + 1;
+			for(; RunEnd < Count; ++RunEnd)
+			{
+				std::size_t const Parent = static_cast<std::size_t>(Parents[RunEnd]);
+				if(Parent >= RunBegin && Parent < RunEnd)
+					break;
+			}
+
+			// Short runs, as in depth first order, don't pay for the threads
+			if(RunEnd - RunBegin < 2 * detail::matrix_hierarchy_tile)
+			{
+				detail::compute_matrix_hierarchy<T, P>::propagate(Locals, Parents, Worlds, RunBegin, RunEnd);
+			}
+			else
+			{
+				int const TileCount = static_cast<int>((RunEnd - RunBegin + detail::matrix_hierarchy_tile - 1) / detail::matrix_hierarchy_tile);
+
+#				if GLM_HAS_OPENMP
+#					pragma omp parallel for schedule(static)
+#				endif
+				for(int Tile = 0; Tile < TileCount; ++Tile)
+				{
+					std::size_t const Begin = RunBegin + static_cast<std::size_t>(Tile) * detail::matrix_hierarchy_tile;
+					std::size_t const End = min(Begin + detail::matrix_hierarchy_tile, RunEnd);
+					detail::compute_matrix_hierarchy<T, P>::propagate(Locals, Parents, Worlds, Begin, End);
+				}
+			}
+
+			RunBegin = RunEnd;
+		}
+	}
+}//namespace glm
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_morton
+/// @file glm/gtx/morton.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtc_type_precision (dependence)
+/// @see gtx_bit
+///
+/// @defgroup gtx_morton GLM_GTX_morton
+/// @ingroup gtx
+/// 
+/// @brief Morton codes (Z-order curve keys) encoding and decoding.
+/// 
+/// The bits of the coordinates are interleaved, the first bit of the key is
+/// the first bit of x, like bitfieldInterleave. 2D keys store 16 bits per axis
+/// in 32 bits and 32 bits per axis in 64 bits, 3D keys store 10 bits per axis
+/// in 32 bits and 21 bits per axis in 64 bits.
+/// 
+/// With BMI2 (see GLM_HAS_BMI2), keys are encoded with PDEP and decoded with
+/// PEXT. Otherwise they are encoded with lookup tables and decoded with shifts
+/// and masks. The array versions quantize 4 (SSE2) or 8 (AVX) positions at once.
+/// 
+/// <glm/gtx/morton.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/type_precision.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_morton extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_morton
+	/// @{
+
+	/// Morton code of a 2D position of 16 bits per axis.
+	/// @see gtx_morton
+	GLM_FUNC_DECL uint32 mortonEncode(u16vec2 const & Position);
+
+	/// Morton code of a 2D position of 32 bits per axis.
+	/// @see gtx_morton
+	GLM_FUNC_DECL uint64 mortonEncode(u32vec2 const & Position);
+
+	/// Morton code of a 3D position of 10 bits per axis, the upper bits are ignored.
+	/// @see gtx_morton
+	GLM_FUNC_DECL uint32 mortonEncode(u16vec3 const & Position);
+
+	/// Morton code of a 3D position of 21 bits per axis, the upper bits are ignored.
+	/// @see gtx_morton
+	GLM_FUNC_DECL uint64 mortonEncode(u32vec3 const & Position);
+
+	/// 2D position of a 32 bits Morton code.
+	/// @see gtx_morton
+	GLM_FUNC_DECL u16vec2 mortonDecode2(uint32 Key);
+
+	/// 2D position of a 64 bits Morton code.
+	/// @see gtx_morton
+	GLM_FUNC_DECL u32vec2 mortonDecode2(uint64 Key);
+
+	/// 3D position of a 32 bits Morton code, the upper 2 bits are ignored.
+	/// @see gtx_morton
+	GLM_FUNC_DECL u16vec3 mortonDecode3(uint32 Key);
+
+	/// 3D position of a 64 bits Morton code, the upper bit is ignored.
+	/// @see gtx_morton
+	GLM_FUNC_DECL u32vec3 mortonDecode3(uint64 Key);
+
+	/// Write in Keys the Morton codes of the Count positions of In.
+	/// The box between Min and Max is divided in 1024 (uint32 keys) or 2097152
+	/// (uint64 keys) cells per axis, positions outside the box are clamped to it
+	/// and NaN coordinates are moved to Min.
+	/// Float positions are quantized by groups of 4 (SSE2) or 8 (AVX).
+	/// @tparam genUType uint32 or uint64
+	/// @see gtx_morton
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_DECL void mortonEncode(
+		detail::tvec3<T, P> const * In,
+		genUType * Keys,
+		std::size_t Count,
+		detail::tvec3<T, P> const & Min,
+		detail::tvec3<T, P> const & Max);
+
+	/// Write in Out the centers of the cells of the Count Morton codes of Keys,
+	/// the inverse of the array version of mortonEncode.
+	/// @tparam genUType uint32 or uint64
+	/// @see gtx_morton
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_DECL void mortonDecode(
+		genUType const * Keys,
+		detail::tvec3<T, P> * Out,
+		std::size_t Count,
+		detail::tvec3<T, P> const & Min,
+		detail::tvec3<T, P> const & Max);
+
+	/// @}
+}//namespace glm
+
+#include "morton.inl"
@@ -0,0 +1,479 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/morton.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../detail/_lane.hpp"
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Bits of a byte spread to every second (Spread2) or every third (Spread3) bit
+	template <typename T>
+	struct morton_table
+	{
+		static uint16 const Spread2[256];
+		static uint32 const Spread3[256];
+	};
+
+	template <typename T>
+	uint16 const morton_table<T>::Spread2[256] =
+	{
+		0x0000, 0x0001, 0x0004, 0x0005, 0x0010, 0x0011, 0x0014, 0x0015,
+		0x0040, 0x0041, 0x0044, 0x0045, 0x0050, 0x0051, 0x0054, 0x0055,
+		0x0100, 0x0101, 0x0104, 0x0105, 0x0110, 0x0111, 0x0114, 0x0115,
+		0x0140, 0x0141, 0x0144, 0x0145, 0x0150, 0x0151, 0x0154, 0x0155,
+		0x0400, 0x0401, 0x0404, 0x0405, 0x0410, 0x0411, 0x0414, 0x0415,
+		0x0440, 0x0441, 0x0444, 0x0445, 0x0450, 0x0451, 0x0454, 0x0455,
+		0x0500, 0x0501, 0x0504, 0x0505, 0x0510, 0x0511, 0x0514, 0x0515,
+		0x0540, 0x0541, 0x0544, 0x0545, 0x0550, 0x0551, 0x0554, 0x0555,
+		0x1000, 0x1001, 0x1004, 0x1005, 0x1010, 0x1011, 0x1014, 0x1015,
+		0x1040, 0x1041, 0x1044, 0x1045, 0x1050, 0x1051, 0x1054, 0x1055,
+		0x1100, 0x1101, 0x1104, 0x1105, 0x1110, 0x1111, 0x1114, 0x1115,
+		0x1140, 0x1141, 0x1144, 0x1145, 0x1150, 0x1151, 0x1154, 0x1155,
+		0x1400, 0x1401, 0x1404, 0x1405, 0x1410, 0x1411, 0x1414, 0x1415,
+		0x1440, 0x1441, 0x1444, 0x1445, 0x1450, 0x1451, 0x1454, 0x1455,
+		0x1500, 0x1501, 0x1504, 0x1505, 0x1510, 0x1511, 0x1514, 0x1515,
+		0x1540, 0x1541, 0x1544, 0x1545, 0x1550, 0x1551, 0x1554, 0x1555,
+		0x4000, 0x4001, 0x4004, 0x4005, 0x4010, 0x4011, 0x4014, 0x4015,
+		0x4040, 0x4041, 0x4044, 0x4045, 0x4050, 0x4051, 0x4054, 0x4055,
+		0x4100, 0x4101, 0x4104, 0x4105, 0x4110, 0x4111, 0x4114, 0x4115,
+		0x4140, 0x4141, 0x4144, 0x4145, 0x4150, 0x4151, 0x4154, 0x4155,
+		0x4400, 0x4401, 0x4404, 0x4405, 0x4410, 0x4411, 0x4414, 0x4415,
+		0x4440, 0x4441, 0x4444, 0x4445, 0x4450, 0x4451, 0x4454, 0x4455,
+		0x4500, 0x4501, 0x4504, 0x4505, 0x4510, 0x4511, 0x4514, 0x4515,
+		0x4540, 0x4541, 0x4544, 0x4545, 0x4550, 0x4551, 0x4554, 0x4555,
+		0x5000, 0x5001, 0x5004, 0x5005, 0x5010, 0x5011, 0x5014, 0x5015,
+		0x5040, 0x5041, 0x5044, 0x5045, 0x5050, 0x5051, 0x5054, 0x5055,
+		0x5100, 0x5101, 0x5104, 0x5105, 0x5110, 0x5111, 0x5114, 0x5115,
+		0x5140, 0x5141, 0x5144, 0x5145, 0x5150, 0x5151, 0x5154, 0x5155,
+		0x5400, 0x5401, 0x5404, 0x5405, 0x5410, 0x5411, 0x5414, 0x5415,
+		0x5440, 0x5441, 0x5444, 0x5445, 0x5450, 0x5451, 0x5454, 0x5455,
+		0x5500, 0x5501, 0x5504, 0x5505, 0x5510, 0x5511, 0x5514, 0x5515,
+		0x5540, 0x5541, 0x5544, 0x5545, 0x5550, 0x5551, 0x5554, 0x5555
+	};
+
+	template <typename T>
+	uint32 const morton_table<T>::Spread3[256] =
+	{
+		0x00000000, 0x00000001, 0x00000008, 0x00000009, 0x00000040, 0x00000041, 0x00000048, 0x00000049,
+		0x00000200, 0x00000201, 0x00000208, 0x00000209, 0x00000240, 0x00000241, 0x00000248, 0x00000249,
+		0x00001000, 0x00001001, 0x00001008, 0x00001009, 0x00001040, 0x00001041, 0x00001048, 0x00001049,
+		0x00001200, 0x00001201, 0x00001208, 0x00001209, 0x00001240, 0x00001241, 0x00001248, 0x00001249,
+		0x00008000, 0x00008001, 0x00008008, 0x00008009, 0x00008040, 0x00008041, 0x00008048, 0x00008049,
+		0x00008200, 0x00008201, 0x00008208, 0x00008209, 0x00008240, 0x00008241, 0x00008248, 0x00008249,
+		0x00009000, 0x00009001, 0x00009008, 0x00009009, 0x00009040, 0x00009041, 0x00009048, 0x00009049,
+		0x00009200, 0x00009201, 0x00009208, 0x00009209, 0x00009240, 0x00009241, 0x00009248, 0x00009249,
+		0x00040000, 0x00040001, 0x00040008, 0x00040009, 0x00040040, 0x00040041, 0x00040048, 0x00040049,
+		0x00040200, 0x00040201, 0x00040208, 0x00040209, 0x00040240, 0x00040241, 0x00040248, 0x00040249,
+		0x00041000, 0x00041001, 0x00041008, 0x00041009, 0x00041040, 0x00041041, 0x00041048, 0x00041049,
+		0x00041200, 0x00041201, 0x00041208, 0x00041209, 0x00041240, 0x00041241, 0x00041248, 0x00041249,
+		0x00048000, 0x00048001, 0x00048008, 0x00048009, 0x00048040, 0x00048041, 0x00048048, 0x00048049,
+		0x00048200, 0x00048201, 0x00048208, 0x00048209, 0x00048240, 0x00048241, 0x00048248, 0x00048249,
+		0x00049000, 0x00049001, 0x00049008, 0x00049009, 0x00049040, 0x00049041, 0x00049048, 0x00049049,
+		0x00049200, 0x00049201, 0x00049208, 0x00049209, 0x00049240, 0x00049241, 0x00049248, 0x00049249,
+		0x00200000, 0x00200001, 0x00200008, 0x00200009, 0x00200040, 0x00200041, 0x00200048, 0x00200049,
+		0x00200200, 0x00200201, 0x00200208, 0x00200209, 0x00200240, 0x00200241, 0x00200248, 0x00200249,
+		0x00201000, 0x00201001, 0x00201008, 0x00201009, 0x00201040, 0x00201041, 0x00201048, 0x00201049,
+		0x00201200, 0x00201201, 0x00201208, 0x00201209, 0x00201240, 0x00201241, 0x00201248, 0x00201249,
+		0x00208000, 0x00208001, 0x00208008, 0x00208009, 0x00208040, 0x00208041, 0x00208048, 0x00208049,
+		0x00208200, 0x00208201, 0x00208208, 0x00208209, 0x00208240, 0x00208241, 0x00208248, 0x00208249,
+		0x00209000, 0x00209001, 0x00209008, 0x00209009, 0x00209040, 0x00209041, 0x00209048, 0x00209049,
+		0x00209200, 0x00209201, 0x00209208, 0x00209209, 0x00209240, 0x00209241, 0x00209248, 0x00209249,
+		0x00240000, 0x00240001, 0x00240008, 0x00240009, 0x00240040, 0x00240041, 0x00240048, 0x00240049,
+		0x00240200, 0x00240201, 0x00240208, 0x00240209, 0x00240240, 0x00240241, 0x00240248, 0x00240249,
+		0x00241000, 0x00241001, 0x00241008, 0x00241009, 0x00241040, 0x00241041, 0x00241048, 0x00241049,
+		0x00241200, 0x00241201, 0x00241208, 0x00241209, 0x00241240, 0x00241241, 0x00241248, 0x00241249,
+		0x00248000, 0x00248001, 0x00248008, 0x00248009, 0x00248040, 0x00248041, 0x00248048, 0x00248049,
+		0x00248200, 0x00248201, 0x00248208, 0x00248209, 0x00248240, 0x00248241, 0x00248248, 0x00248249,
+		0x00249000, 0x00249001, 0x00249008, 0x00249009, 0x00249040, 0x00249041, 0x00249048, 0x00249049,
+		0x00249200, 0x00249201, 0x00249208, 0x00249209, 0x00249240, 0x00249241, 0x00249248, 0x00249249
+	};
+
+	GLM_FUNC_QUALIFIER uint32 morton_encode(uint32 x, uint32 y)
+	{
+#	if GLM_HAS_BMI2
+		return _pdep_u32(x, 0x55555555) | _pdep_u32(y, 0xAAAAAAAA);
+#	else
+		uint16 const * Spread = morton_table<int>::Spread2;
+		uint32 const SpreadX = uint32(Spread[x & 0xFF]) | (uint32(Spread[(x >> 8) & 0xFF]) << 16);
+		uint32 const SpreadY = uint32(Spread[y & 0xFF]) | (uint32(Spread[(y >> 8) & 0xFF]) << 16);
+		return SpreadX | (SpreadY << 1);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER uint64 morton_encode(uint64 x, uint64 y)
+	{
+#	if GLM_HAS_BMI2
+		return _pdep_u64(x, uint64(0x5555555555555555)) | _pdep_u64(y, uint64(0xAAAAAAAAAAAAAAAA));
+#	else
+		return uint64(morton_encode(uint32(x & 0xFFFF), uint32(y & 0xFFFF))) | (uint64(morton_encode(uint32((x >> 16) & 0xFFFF), uint32((y >> 16) & 0xFFFF))) << 32);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER uint32 morton_encode(uint32 x, uint32 y, uint32 z)
+	{
+#	if GLM_HAS_BMI2
+		return _pdep_u32(x, 0x09249249) | _pdep_u32(y, 0x12492492) | _pdep_u32(z, 0x24924924);
+#	else
+		uint32 const * Spread = morton_table<int>::Spread3;
+		uint32 const SpreadX = Spread[x & 0xFF] | (Spread[(x >> 8) & 0x03] << 24);
+		uint32 const SpreadY = Spread[y & 0xFF] | (Spread[(y >> 8) & 0x03] << 24);
+		uint32 const SpreadZ = Spread[z & 0xFF] | (Spread[(z >> 8) & 0x03] << 24);
+		return SpreadX | (SpreadY << 1) | (SpreadZ << 2);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER uint64 morton_encode(uint64 x, uint64 y, uint64 z)
+	{
+#	if GLM_HAS_BMI2
+		return _pdep_u64(x, uint64(0x1249249249249249)) | _pdep_u64(y, uint64(0x2492492492492492)) | _pdep_u64(z, uint64(0x4924924924924924));
+#	else
+		uint32 const * Spread = morton_table<int>::Spread3;
+		uint64 const SpreadX = uint64(Spread[x & 0xFF]) | (uint64(Spread[(x >> 8) & 0xFF]) << 24) | (uint64(Spread[(x >> 16) & 0x1F]) << 48);
+		uint64 const SpreadY = uint64(Spread[y & 0xFF]) | (uint64(Spread[(y >> 8) & 0xFF]) << 24) | (uint64(Spread[(y >> 16) & 0x1F]) << 48);
+		uint64 const SpreadZ = uint64(Spread[z & 0xFF]) | (uint64(Spread[(z >> 8) & 0xFF]) << 24) | (uint64(Spread[(z >> 16) & 0x1F]) << 48);
+		return SpreadX | (SpreadY << 1) | (SpreadZ << 2);
+#	endif
+	}
+
+	// Gather every second (compact2) or every third (compact3) bit
+	GLM_FUNC_QUALIFIER uint32 morton_compact2(uint32 v)
+	{
+		v &= 0x55555555;
+		v = (v | (v >> 1)) & 0x33333333;
+		v = (v | (v >> 2)) & 0x0F0F0F0F;
+		v = (v | (v >> 4)) & 0x00FF00FF;
+		return (v | (v >> 8)) & 0x0000FFFF;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 morton_compact2(uint64 v)
+	{
+		v &= uint64(0x5555555555555555);
+		v = (v | (v >> 1)) & uint64(0x3333333333333333);
+		v = (v | (v >> 2)) & uint64(0x0F0F0F0F0F0F0F0F);
+		v = (v | (v >> 4)) & uint64(0x00FF00FF00FF00FF);
+		v = (v | (v >> 8)) & uint64(0x0000FFFF0000FFFF);
+		return (v | (v >> 16)) & uint64(0x00000000FFFFFFFF);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 morton_compact3(uint32 v)
+	{
+		v &= 0x09249249;
+		v = (v | (v >> 2)) & 0x030C30C3;
+		v = (v | (v >> 4)) & 0x0300F00F;
+		v = (v | (v >> 8)) & 0x030000FF;
+		return (v | (v >> 16)) & 0x000003FF;
+	}
+
+	GLM_FUNC_QUALIFIER uint64 morton_compact3(uint64 v)
+	{
+		v &= uint64(0x1249249249249249);
+		v = (v | (v >> 2)) & uint64(0x10C30C30C30C30C3);
+		v = (v | (v >> 4)) & uint64(0x100F00F00F00F00F);
+		v = (v | (v >> 8)) & uint64(0x001F0000FF0000FF);
+		v = (v | (v >> 16)) & uint64(0x001F00000000FFFF);
+		return (v | (v >> 32)) & uint64(0x00000000001FFFFF);
+	}
+
+	GLM_FUNC_QUALIFIER void morton_decode(uint32 Key, uint32 & x, uint32 & y)
+	{
+#	if GLM_HAS_BMI2
+		x = _pext_u32(Key, 0x55555555);
+		y = _pext_u32(Key, 0xAAAAAAAA);
+#	else
+		x = morton_compact2(Key);
+		y = morton_compact2(Key >> 1);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER void morton_decode(uint64 Key, uint64 & x, uint64 & y)
+	{
+#	if GLM_HAS_BMI2
+		x = _pext_u64(Key, uint64(0x5555555555555555));
+		y = _pext_u64(Key, uint64(0xAAAAAAAAAAAAAAAA));
+#	else
+		x = morton_compact2(Key);
+		y = morton_compact2(Key >> 1);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER void morton_decode(uint32 Key, uint32 & x, uint32 & y, uint32 & z)
+	{
+#	if GLM_HAS_BMI2
+		x = _pext_u32(Key, 0x09249249);
+		y = _pext_u32(Key, 0x12492492);
+		z = _pext_u32(Key, 0x24924924);
+#	else
+		x = morton_compact3(Key);
+		y = morton_compact3(Key >> 1);
+		z = morton_compact3(Key >> 2);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER void morton_decode(uint64 Key, uint64 & x, uint64 & y, uint64 & z)
+	{
+#	if GLM_HAS_BMI2
+		x = _pext_u64(Key, uint64(0x1249249249249249));
+		y = _pext_u64(Key, uint64(0x2492492492492492));
+		z = _pext_u64(Key, uint64(0x4924924924924924));
+#	else
+		x = morton_compact3(Key);
+		y = morton_compact3(Key >> 1);
+		z = morton_compact3(Key >> 2);
+#	endif
+	}
+
+	// Bits per axis of the 3D keys
+	template <typename genUType>
+	struct morton_bits3
+	{};
+
+	template <>
+	struct morton_bits3<uint32>
+	{
+		static int const value = 10;
+	};
+
+	template <>
+	struct morton_bits3<uint64>
+	{
+		static int const value = 21;
+	};
+
+	// Cell of a coordinate, clamped to [0, Limit], NaN coordinates go to the first cell
+	template <typename L>
+	GLM_FUNC_QUALIFIER L morton_quantize(L const & x, L const & Min, L const & Scale, L const & Limit)
+	{
+		L const Cell = (x - Min) * Scale;
+		L const Positive = select(Cell > L(0.0f), Cell, L(0.0f));
+		return select(Positive < Limit, Positive, Limit);
+	}
+
+	template <typename genUType, typename T>
+	GLM_FUNC_QUALIFIER T morton_cells()
+	{
+		return static_cast<T>(genUType(1) << morton_bits3<genUType>::value);
+	}
+
+	// Cells per unit of length, zero for empty boxes
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_QUALIFIER tvec3<T, P> morton_scale(tvec3<T, P> const & Min, tvec3<T, P> const & Max)
+	{
+		T const Cells = morton_cells<genUType, T>();
+		tvec3<T, P> const Extent(Max - Min);
+		return tvec3<T, P>(
+			Extent.x > T(0) ? Cells / Extent.x : T(0),
+			Extent.y > T(0) ? Cells / Extent.y : T(0),
+			Extent.z > T(0) ? Cells / Extent.z : T(0));
+	}
+
+	template <typename genUType, typename T, precision P>
+	struct compute_morton
+	{
+		GLM_FUNC_QUALIFIER static void encode(tvec3<T, P> const * In, genUType * Keys, std::size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max)
+		{
+			tvec3<T, P> const Scale(morton_scale<genUType>(Min, Max));
+			T const Limit(morton_cells<genUType, T>() - T(1));
+			for(std::size_t i = 0; i < Count; ++i)
+				Keys[i] = morton_encode(
+					static_cast<genUType>(morton_quantize(In[i].x, Min.x, Scale.x, Limit)),
+					static_cast<genUType>(morton_quantize(In[i].y, Min.y, Scale.y, Limit)),
+					static_cast<genUType>(morton_quantize(In[i].z, Min.z, Scale.z, Limit)));
+		}
+	};
+
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_QUALIFIER void morton_decode_cells(genUType const * Keys, tvec3<T, P> * Out, std::size_t Count, tvec3<T, P> const & Min, tvec3<T, P> const & Max)
+	{
+		// Dividing by the number of cells is exact, the rounding of the cell size would be multiplied by the cell index
+		T const InverseCells = T(1) / morton_cells<genUType, T>();
+		tvec3<T, P> const Extent(Max - Min);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			genUType x, y, z;
+			morton_decode(Keys[i], x, y, z);
+			Out[i] = Min + (tvec3<T, P>(T(x), T(y), T(z)) + T(0.5)) * InverseCells * Extent;
+		}
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Spread the 10 lowest bits of 4 integers to every third bit
+	GLM_FUNC_QUALIFIER __m128i sse_morton_spread3_epi32(__m128i v)
+	{
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 16)), _mm_set1_epi32(0x030000FF));
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 8)), _mm_set1_epi32(0x0300F00F));
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 4)), _mm_set1_epi32(0x030C30C3));
+		return _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 2)), _mm_set1_epi32(0x09249249));
+	}
+
+	GLM_FUNC_QUALIFIER __m128i sse_set1_epi64(uint32 High, uint32 Low)
+	{
+		return _mm_set_epi32(static_cast<int>(High), static_cast<int>(Low), static_cast<int>(High), static_cast<int>(Low));
+	}
+
+	// Spread the 21 lowest bits of 2 integers to every third bit
+	GLM_FUNC_QUALIFIER __m128i sse_morton_spread3_epi64(__m128i v)
+	{
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi64(v, 32)), sse_set1_epi64(0x001F0000, 0x0000FFFF));
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi64(v, 16)), sse_set1_epi64(0x001F0000, 0xFF0000FF));
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi64(v, 8)), sse_set1_epi64(0x100F00F0, 0x0F00F00F));
+		v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi64(v, 4)), sse_set1_epi64(0x10C30C30, 0xC30C30C3));
+		return _mm_and_si128(_mm_or_si128(v, _mm_slli_epi64(v, 2)), sse_set1_epi64(0x12492492, 0x49249249));
+	}
+
+	// Keys of 4 quantized positions
+	GLM_FUNC_QUALIFIER void sse_morton_encode3(float const * x, float const * y, float const * z, uint32 * Keys)
+	{
+		__m128i const SpreadX = sse_morton_spread3_epi32(_mm_cvttps_epi32(_mm_loadu_ps(x)));
+		__m128i const SpreadY = sse_morton_spread3_epi32(_mm_cvttps_epi32(_mm_loadu_ps(y)));
+		__m128i const SpreadZ = sse_morton_spread3_epi32(_mm_cvttps_epi32(_mm_loadu_ps(z)));
+		__m128i const Key = _mm_or_si128(_mm_or_si128(SpreadX, _mm_slli_epi32(SpreadY, 1)), _mm_slli_epi32(SpreadZ, 2));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Keys), Key);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_morton_encode3(float const * x, float const * y, float const * z, uint64 * Keys)
+	{
+		__m128i const Zero = _mm_setzero_si128();
+		__m128i const CellX = _mm_cvttps_epi32(_mm_loadu_ps(x));
+		__m128i const CellY = _mm_cvttps_epi32(_mm_loadu_ps(y));
+		__m128i const CellZ = _mm_cvttps_epi32(_mm_loadu_ps(z));
+		__m128i const KeyLow = _mm_or_si128(_mm_or_si128(
+			sse_morton_spread3_epi64(_mm_unpacklo_epi32(CellX, Zero)),
+			_mm_slli_epi64(sse_morton_spread3_epi64(_mm_unpacklo_epi32(CellY, Zero)), 1)),
+			_mm_slli_epi64(sse_morton_spread3_epi64(_mm_unpacklo_epi32(CellZ, Zero)), 2));
+		__m128i const KeyHigh = _mm_or_si128(_mm_or_si128(
+			sse_morton_spread3_epi64(_mm_unpackhi_epi32(CellX, Zero)),
+			_mm_slli_epi64(sse_morton_spread3_epi64(_mm_unpackhi_epi32(CellY, Zero)), 1)),
+			_mm_slli_epi64(sse_morton_spread3_epi64(_mm_unpackhi_epi32(CellZ, Zero)), 2));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Keys + 0), KeyLow);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Keys + 2), KeyHigh);
+	}
+
+	template <typename genUType, precision P>
+	struct compute_morton<genUType, float, P>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		// Keys of Size positions, quantized with the lanes and spread 4 at a time
+		GLM_FUNC_QUALIFIER static void encode_block(tvec3<float, P> const * In, genUType * Keys, tvec3<float, P> const & Min, tvec3<float, P> const & Scale, float Limit)
+		{
+			L Position[3];
+			lane_type::template load_soa<3>(&In[0].x, 3, Position);
+
+			float Cells[3][Size];
+			for(length_t c = 0; c < 3; ++c)
+				lane_type::store(Cells[c], morton_quantize(Position[c], L(Min[c]), L(Scale[c]), L(Limit)));
+
+			for(std::size_t j = 0; j < Size; j += 4)
+				sse_morton_encode3(Cells[0] + j, Cells[1] + j, Cells[2] + j, Keys + j);
+		}
+
+		GLM_FUNC_QUALIFIER static void encode(tvec3<float, P> const * In, genUType * Keys, std::size_t Count, tvec3<float, P> const & Min, tvec3<float, P> const & Max)
+		{
+			tvec3<float, P> const Scale(morton_scale<genUType>(Min, Max));
+			float const Limit(morton_cells<genUType, float>() - 1.0f);
+
+			std::size_t i = 0;
+			for(; i + Size <= Count; i += Size)
+				encode_block(In + i, Keys + i, Min, Scale, Limit);
+
+			if(i < Count)
+			{
+				tvec3<float, P> Tail[Size];
+				genUType TailKeys[Size];
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Tail[j] = In[i + j];
+				encode_block(Tail, TailKeys, Min, Scale, Limit);
+				for(std::size_t j = 0; i + j < Count; ++j)
+					Keys[i + j] = TailKeys[j];
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER uint32 mortonEncode(u16vec2 const & Position)
+	{
+		return detail::morton_encode(uint32(Position.x), uint32(Position.y));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 mortonEncode(u32vec2 const & Position)
+	{
+		return detail::morton_encode(uint64(Position.x), uint64(Position.y));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 mortonEncode(u16vec3 const & Position)
+	{
+		return detail::morton_encode(uint32(Position.x & 0x3FF), uint32(Position.y & 0x3FF), uint32(Position.z & 0x3FF));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 mortonEncode(u32vec3 const & Position)
+	{
+		return detail::morton_encode(uint64(Position.x & 0x1FFFFF), uint64(Position.y & 0x1FFFFF), uint64(Position.z & 0x1FFFFF));
+	}
+
+	GLM_FUNC_QUALIFIER u16vec2 mortonDecode2(uint32 Key)
+	{
+		uint32 x, y;
+		detail::morton_decode(Key, x, y);
+		return u16vec2(static_cast<uint16>(x), static_cast<uint16>(y));
+	}
+
+	GLM_FUNC_QUALIFIER u32vec2 mortonDecode2(uint64 Key)
+	{
+		uint64 x, y;
+		detail::morton_decode(Key, x, y);
+		return u32vec2(static_cast<uint32>(x), static_cast<uint32>(y));
+	}
+
+	GLM_FUNC_QUALIFIER u16vec3 mortonDecode3(uint32 Key)
+	{
+		uint32 x, y, z;
+		detail::morton_decode(Key, x, y, z);
+		return u16vec3(static_cast<uint16>(x), static_cast<uint16>(y), static_cast<uint16>(z));
+	}
+
+	GLM_FUNC_QUALIFIER u32vec3 mortonDecode3(uint64 Key)
+	{
+		uint64 x, y, z;
+		detail::morton_decode(Key, x, y, z);
+		return u32vec3(static_cast<uint32>(x), static_cast<uint32>(y), static_cast<uint32>(z));
+	}
+
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_QUALIFIER void mortonEncode
+	(
+		detail::tvec3<T, P> const * In,
+		genUType * Keys,
+		std::size_t Count,
+		detail::tvec3<T, P> const & Min,
+		detail::tvec3<T, P> const & Max
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mortonEncode' only accept floating-point inputs");
+		detail::compute_morton<genUType, T, P>::encode(In, Keys, Count, Min, Max);
+	}
+
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_QUALIFIER void mortonDecode
+	(
+		genUType const * Keys,
+		detail::tvec3<T, P> * Out,
+		std::size_t Count,
+		detail::tvec3<T, P> const & Min,
+		detail::tvec3<T, P> const & Max
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mortonDecode' only accept floating-point outputs");
+		detail::morton_decode_cells(Keys, Out, Count, Min, Max);
+	}
+}//namespace glm
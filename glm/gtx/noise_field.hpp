@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_noise_field
+/// @file glm/gtx/noise_field.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_noise_field GLM_GTX_noise_field
+/// @ingroup gtx
+///
+/// @brief Fractal noise fields built from simplex noise: fBm, ridged and turbulence.
+///
+/// A field is a 2D or 3D grid of samples. The grid is split into tiles of
+/// 64x16 samples, which are distributed across threads with OpenMP when it is
+/// enabled. All octaves of a sample are accumulated in registers, so no
+/// intermediate field is allocated. The samples are evaluated by groups of 4
+/// with SSE2 or 8 with AVX. The result doesn't depend on the number of threads.
+///
+/// Octave o uses the frequency Lacunarity^o and the amplitude Gain^o.
+/// The sum of the octaves is divided by the sum of the amplitudes.
+///
+/// <glm/gtx/noise_field.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_noise_field extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_field
+	/// @{
+
+	/// Fractal brownian motion: sum of the octaves of simplex noise, in [-1, 1].
+	/// The sample of the position Origin + Step * (x, y, z) is written in Out[x + Dims.x * (y + Dims.y * z)].
+	/// @see gtx_noise_field
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void fbm(
+		T * Out,
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Dims,
+		int Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	/// Ridged noise: sum of the octaves of (1 - |simplex|)^2, in [0, 1].
+	/// The sample of the position Origin + Step * (x, y, z) is written in Out[x + Dims.x * (y + Dims.y * z)].
+	/// @see gtx_noise_field
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void ridged(
+		T * Out,
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Dims,
+		int Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	/// Turbulence: sum of the octaves of |simplex|, in [0, 1].
+	/// The sample of the position Origin + Step * (x, y, z) is written in Out[x + Dims.x * (y + Dims.y * z)].
+	/// @see gtx_noise_field
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_DECL void turbulence(
+		T * Out,
+		vecType<T, P> const & Origin,
+		vecType<T, P> const & Step,
+		vecType<int, P> const & Dims,
+		int Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	/// @}
+}//namespace glm
+
+#include "noise_field.inl"
@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/noise_field.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Size of the tiles distributed across threads, TileX is a multiple of 8
+	static int const noise_field_tile_x = 64;
+	static int const noise_field_tile_y = 16;
+
+	struct noise_field_fbm
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & Noise)
+		{
+			return Noise;
+		}
+	};
+
+	struct noise_field_ridged
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & Noise)
+		{
+			L const Ridge = L(1) - abs(Noise);
+			return Ridge * Ridge;
+		}
+	};
+
+	struct noise_field_turbulence
+	{
+		template <typename L>
+		GLM_FUNC_QUALIFIER static L call(L const & Noise)
+		{
+			return abs(Noise);
+		}
+	};
+
+	template <typename T>
+	struct noise_field_octaves
+	{
+		int Count;
+		T Lacunarity;
+		T Gain;
+		T Scale; // Inverse of the sum of the amplitudes
+
+		GLM_FUNC_QUALIFIER noise_field_octaves(int Count, T const & Lacunarity, T const & Gain) :
+			Count(Count),
+			Lacunarity(Lacunarity),
+			Gain(Gain)
+		{
+			T Sum(0);
+			T Amplitude(1);
+			for(int o = 0; o < Count; ++o, Amplitude *= Gain)
+				Sum += Amplitude;
+			this->Scale = T(1) / Sum;
+		}
+
+		template <typename fractal, typename L>
+		GLM_FUNC_QUALIFIER L call(L const & x, L const & y) const
+		{
+			L Sum(T(0));
+			T Amplitude(1);
+			T Frequency(1);
+			for(int o = 0; o < this->Count; ++o, Amplitude *= this->Gain, Frequency *= this->Lacunarity)
+				Sum = Sum + L(Amplitude) * fractal::call(noise_simplex::call(x * L(Frequency), y * L(Frequency)));
+			return Sum * L(this->Scale);
+		}
+
+		template <typename fractal, typename L>
+		GLM_FUNC_QUALIFIER L call(L const & x, L const & y, L const & z) const
+		{
+			L Sum(T(0));
+			T Amplitude(1);
+			T Frequency(1);
+			for(int o = 0; o < this->Count; ++o, Amplitude *= this->Gain, Frequency *= this->Lacunarity)
+				Sum = Sum + L(Amplitude) * fractal::call(noise_simplex::call(x * L(Frequency), y * L(Frequency), z * L(Frequency)));
+			return Sum * L(this->Scale);
+		}
+	};
+
+	// Fill the row [BeginX, EndX) of a tile, Y and Z are the coordinates shared by the row
+	template <typename fractal, typename T, typename position>
+	GLM_FUNC_QUALIFIER void noise_field_row(
+		T * Out,
+		int BeginX,
+		int EndX,
+		T const & OriginX,
+		T const & StepX,
+		position const & YZ,
+		noise_field_octaves<T> const & Octaves)
+	{
+		typedef noise_lane<T> lane;
+		typedef typename lane::type L;
+
+		int x = BeginX;
+		for(; x + static_cast<int>(lane::size) <= EndX; x += static_cast<int>(lane::size))
+			lane::store(Out + x, YZ.template call<fractal>(Octaves,
+				L(OriginX) + L(StepX) * (L(static_cast<T>(x)) + lane::index())));
+		for(; x < EndX; ++x)
+			Out[x] = YZ.template call<fractal>(Octaves, OriginX + StepX * static_cast<T>(x));
+	}
+
+	template <typename T>
+	struct noise_field_y
+	{
+		T y;
+
+		template <typename fractal, typename L>
+		GLM_FUNC_QUALIFIER L call(noise_field_octaves<T> const & Octaves, L const & x) const
+		{
+			return Octaves.template call<fractal>(x, L(this->y));
+		}
+	};
+
+	template <typename T>
+	struct noise_field_yz
+	{
+		T y;
+		T z;
+
+		template <typename fractal, typename L>
+		GLM_FUNC_QUALIFIER L call(noise_field_octaves<T> const & Octaves, L const & x) const
+		{
+			return Octaves.template call<fractal>(x, L(this->y), L(this->z));
+		}
+	};
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	struct compute_noise_field{};
+
+	template <typename T, precision P>
+	struct compute_noise_field<T, P, tvec2>
+	{
+		template <typename fractal>
+		GLM_FUNC_QUALIFIER static void call(fractal, T * Out, tvec2<T, P> const & Origin, tvec2<T, P> const & Step, tvec2<int, P> const & Dims, noise_field_octaves<T> const & Octaves)
+		{
+			int const TilesX = (Dims.x + noise_field_tile_x - 1) / noise_field_tile_x;
+			int const TilesY = (Dims.y + noise_field_tile_y - 1) / noise_field_tile_y;
+			int const TileCount = Dims.x > 0 && Dims.y > 0 ? TilesX * TilesY : 0;
+
+#			if GLM_HAS_OPENMP
+#				pragma omp parallel for schedule(dynamic)
+#			endif
+			for(int Tile = 0; Tile < TileCount; ++Tile)
+			{
+				int const BeginX = (Tile % TilesX) * noise_field_tile_x;
+				int const BeginY = (Tile / TilesX) * noise_field_tile_y;
+				int const EndX = min(BeginX + noise_field_tile_x, Dims.x);
+				int const EndY = min(BeginY + noise_field_tile_y, Dims.y);
+
+				for(int y = BeginY; y < EndY; ++y)
+				{
+					noise_field_y<T> const Row = {Origin.y + Step.y * static_cast<T>(y)};
+					noise_field_row<fractal>(Out + static_cast<std::size_t>(y) * static_cast<std::size_t>(Dims.x), BeginX, EndX, Origin.x, Step.x, Row, Octaves);
+				}
+			}
+		}
+	};
+
+	template <typename T, precision P>
+	struct compute_noise_field<T, P, tvec3>
+	{
+		template <typename fractal>
+		GLM_FUNC_QUALIFIER static void call(fractal, T * Out, tvec3<T, P> const & Origin, tvec3<T, P> const & Step, tvec3<int, P> const & Dims, noise_field_octaves<T> const & Octaves)
+		{
+			int const TilesX = (Dims.x + noise_field_tile_x - 1) / noise_field_tile_x;
+			int const TilesY = (Dims.y + noise_field_tile_y - 1) / noise_field_tile_y;
+			int const TileCount = Dims.x > 0 && Dims.y > 0 && Dims.z > 0 ? TilesX * TilesY * Dims.z : 0;
+
+#			if GLM_HAS_OPENMP
+#				pragma omp parallel for schedule(dynamic)
+#			endif
+			for(int Tile = 0; Tile < TileCount; ++Tile)
+			{
+				int const z = Tile / (TilesX * TilesY);
+				int const BeginX = (Tile % TilesX) * noise_field_tile_x;
+				int const BeginY = (Tile / TilesX % TilesY) * noise_field_tile_y;
+				int const EndX = min(BeginX + noise_field_tile_x, Dims.x);
+				int const EndY = min(BeginY + noise_field_tile_y, Dims.y);
+
+				for(int y = BeginY; y < EndY; ++y)
+				{
+					noise_field_yz<T> const Row = {Origin.y + Step.y * static_cast<T>(y), Origin.z + Step.z * static_cast<T>(z)};
+					std::size_t const Offset = (static_cast<std::size_t>(z) * static_cast<std::size_t>(Dims.y) + static_cast<std::size_t>(y)) * static_cast<std::size_t>(Dims.x);
+					noise_field_row<fractal>(Out + Offset, BeginX, EndX, Origin.x, Step.x, Row, Octaves);
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void fbm(T * Out, vecType<T, P> const & Origin, vecType<T, P> const & Step, vecType<int, P> const & Dims, int Octaves, T const & Lacunarity, T const & Gain)
+	{
+		assert(Octaves > 0);
+		detail::compute_noise_field<T, P, vecType>::call(detail::noise_field_fbm(), Out, Origin, Step, Dims, detail::noise_field_octaves<T>(Octaves, Lacunarity, Gain));
+	}
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void ridged(T * Out, vecType<T, P> const & Origin, vecType<T, P> const & Step, vecType<int, P> const & Dims, int Octaves, T const & Lacunarity, T const & Gain)
+	{
+		assert(Octaves > 0);
+		detail::compute_noise_field<T, P, vecType>::call(detail::noise_field_ridged(), Out, Origin, Step, Dims, detail::noise_field_octaves<T>(Octaves, Lacunarity, Gain));
+	}
+
+	template <typename T, precision P, template<typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void turbulence(T * Out, vecType<T, P> const & Origin, vecType<T, P> const & Step, vecType<int, P> const & Dims, int Octaves, T const & Lacunarity, T const & Gain)
+	{
+		assert(Octaves > 0);
+		detail::compute_noise_field<T, P, vecType>::call(detail::noise_field_turbulence(), Out, Origin, Step, Dims, detail::noise_field_octaves<T>(Octaves, Lacunarity, Gain));
+	}
+}//namespace glm
@@ -180,6 +180,8 @@ namespace glm
 		T const & a);
 
 	/// Quaternion normalized linear interpolation.
+	/// The rotation speed isn't constant: the result is up to 0.15 radians away
+	/// from slerp when x and y are opposite rotations.
 	///
 	/// @see gtx_quaternion
 	template<typename T, precision P>
@@ -188,6 +190,19 @@ namespace glm
 		detail::tquat<T, P> const & y,
 		T const & a);
 
+	/// Quaternion interpolation using the rotation short path, approximating slerp.
+	/// Corrects the interpolation factor of a normalized linear interpolation with
+	/// a polynomial of the cosine of the angle so that there is no acos and sin.
+	/// For any pair of unit quaternions and a in [0, 1], the rotation returned is
+	/// less than 6e-5 radians away from the rotation returned by slerp.
+	///
+	/// @see gtx_quaternion
+	template<typename T, precision P>
+	GLM_FUNC_DECL detail::tquat<T, P> fastSlerp(
+		detail::tquat<T, P> const & x,
+		detail::tquat<T, P> const & y,
+		T const & a);
+
 	/// Compute the rotation between two vectors.
 	/// param orig vector, needs to be normalized
 	/// param dest vector, needs to be normalized
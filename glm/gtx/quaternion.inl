@@ -221,6 +221,43 @@ namespace glm
 		return glm::normalize(x * (static_cast<T>(1) - a) + (y * a));
 	}
 
+namespace detail
+{
+	// Interpolation factor which makes the normalized linear interpolation follow slerp.
+	// s = a + a (a - 1/2) (a - 1) K(CosTheta, (a - 1/2)^2), K fitted to minimize the
+	// largest angular error for CosTheta in [0, 1].
+	template <typename T>
+	GLM_FUNC_QUALIFIER T fast_slerp_factor(T const & CosTheta, T const & a)
+	{
+		T const Center(a - T(0.5));
+		T const u(Center * Center);
+		T const K0 = T(0.859372086) + CosTheta * (T(-1.14444762) + CosTheta * (T(0.40235894) + CosTheta * T(-0.120773088)));
+		T const K1 = T(0.810186183) + CosTheta * (T(-1.92136174) + CosTheta * (T(1.33969503) + CosTheta * T(-0.212540319)));
+		T const K2 = T(1.21069865) + CosTheta * (T(-5.0733021) + CosTheta * (T(7.61407299) + CosTheta * T(-3.89886847)));
+		return a + a * Center * (a - T(1)) * (K0 + u * (K1 + u * K2));
+	}
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER detail::tquat<T, P> fastSlerp
+	(
+		detail::tquat<T, P> const & x,
+		detail::tquat<T, P> const & y,
+		T const & a
+	)
+	{
+		T CosTheta = dot(x, y);
+		detail::tquat<T, P> z(y);
+		if(CosTheta < static_cast<T>(0))
+		{
+			z = -y;
+			CosTheta = -CosTheta;
+		}
+
+		T const s = detail::fast_slerp_factor(CosTheta, a);
+		return glm::normalize(x * (static_cast<T>(1) - s) + z * s);
+	}
+
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER detail::tquat<T, P> rotation
 	(
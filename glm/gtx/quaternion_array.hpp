@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_quaternion_array
+/// @file glm/gtx/quaternion_array.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_quaternion (dependence)
+///
+/// @defgroup gtx_quaternion_array GLM_GTX_quaternion_array
+/// @ingroup gtx
+///
+/// @brief Multiply, rotate, interpolate and convert arrays of quaternions.
+///
+/// Float quaternions are loaded by blocks of 4 (SSE2) or 8 (AVX) and transposed
+/// so that each register holds the same component of every quaternion of the block.
+/// The remaining quaternions are processed as a partial block so that every
+/// element goes through the same code. Inputs don't need to be aligned.
+/// The output may alias the inputs but the arrays must not partially overlap.
+///
+/// <glm/gtx/quaternion_array.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/quaternion.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/_lane.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_quaternion_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_array
+	/// @{
+
+	/// out[i] = a[i] * b[i] for count quaternions.
+	/// @see gtx_quaternion_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void multiply(
+		detail::tquat<T, P> const * a,
+		detail::tquat<T, P> const * b,
+		detail::tquat<T, P> * out,
+		std::size_t count);
+
+	/// Rotate count vectors: out[i] = q[i] * v[i].
+	/// @see gtx_quaternion_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void rotate(
+		detail::tquat<T, P> const * q,
+		detail::tvec3<T, P> const * v,
+		detail::tvec3<T, P> * out,
+		std::size_t count);
+
+	/// Spherical linear interpolation of count pairs of quaternions: out[i] = slerp(a[i], b[i], t[i]).
+	/// The float version evaluates acos and sin with polynomials, the results stay within 2e-6 of slerp.
+	/// @see gtx_quaternion_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void slerp(
+		detail::tquat<T, P> const * a,
+		detail::tquat<T, P> const * b,
+		T const * t,
+		detail::tquat<T, P> * out,
+		std::size_t count);
+
+	/// Approximated spherical linear interpolation of count pairs of quaternions: out[i] = fastSlerp(a[i], b[i], t[i]).
+	/// The rotations are less than 6e-5 radians away from slerp.
+	/// @see gtx_quaternion_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void fastSlerp(
+		detail::tquat<T, P> const * a,
+		detail::tquat<T, P> const * b,
+		T const * t,
+		detail::tquat<T, P> * out,
+		std::size_t count);
+
+	/// Convert count quaternions to rotation matrices: out[i] = mat4_cast(q[i]).
+	/// @see gtx_quaternion_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void mat4_cast(
+		detail::tquat<T, P> const * q,
+		detail::tmat4x4<T, P> * out,
+		std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_array.inl"
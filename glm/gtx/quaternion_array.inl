@@ -0,0 +1,410 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/quaternion_array.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_quaternion_array
+	{
+		GLM_FUNC_QUALIFIER static void multiply(tquat<T, P> const * a, tquat<T, P> const * b, tquat<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = a[i] * b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate(tquat<T, P> const * q, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = q[i] * v[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(tquat<T, P> const * a, tquat<T, P> const * b, T const * t, tquat<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::slerp(a[i], b[i], t[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void fastSlerp(tquat<T, P> const * a, tquat<T, P> const * b, T const * t, tquat<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::fastSlerp(a[i], b[i], t[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4_cast(tquat<T, P> const * q, tmat4x4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::mat4_cast(q[i]);
+		}
+	};
+
+	// The kernels below take the components in memory order: x, y, z, w
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER void quat_mul_soa(L const a[4], L const b[4], L out[4])
+	{
+		L const x = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+		L const y = a[3] * b[1] + a[1] * b[3] + a[2] * b[0] - a[0] * b[2];
+		L const z = a[3] * b[2] + a[2] * b[3] + a[0] * b[1] - a[1] * b[0];
+		L const w = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+		out[0] = x;
+		out[1] = y;
+		out[2] = z;
+		out[3] = w;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER void quat_rotate_soa(L const q[4], L const v[3], L out[3])
+	{
+		L const uvx = q[1] * v[2] - q[2] * v[1];
+		L const uvy = q[2] * v[0] - q[0] * v[2];
+		L const uvz = q[0] * v[1] - q[1] * v[0];
+		L const uuvx = q[1] * uvz - q[2] * uvy;
+		L const uuvy = q[2] * uvx - q[0] * uvz;
+		L const uuvz = q[0] * uvy - q[1] * uvx;
+		L const Two(2.0f);
+		out[0] = v[0] + (uvx * q[3] + uuvx) * Two;
+		out[1] = v[1] + (uvy * q[3] + uuvy) * Two;
+		out[2] = v[2] + (uvz * q[3] + uuvz) * Two;
+	}
+
+	// acos(x) for x in [0, 1], Abramowitz and Stegun 4.4.46, absolute error below 2e-8
+	template <typename L>
+	GLM_FUNC_QUALIFIER L quat_acos_positive(L const & x)
+	{
+		L Poly(-0.0012624911f);
+		Poly = Poly * x + L(0.0066700901f);
+		Poly = Poly * x + L(-0.0170881256f);
+		Poly = Poly * x + L(0.0308918810f);
+		Poly = Poly * x + L(-0.0501743046f);
+		Poly = Poly * x + L(0.0889789874f);
+		Poly = Poly * x + L(-0.2145988016f);
+		Poly = Poly * x + L(1.5707963050f);
+		return sqrt(L(1.0f) - x) * Poly;
+	}
+
+	// sin(x) for x in [0, pi / 2], Taylor series up to x^11, absolute error below 6e-8
+	template <typename L>
+	GLM_FUNC_QUALIFIER L quat_sin_quadrant(L const & x)
+	{
+		L const x2 = x * x;
+		L Poly(-2.5052108385e-8f);
+		Poly = Poly * x2 + L(2.7557319224e-6f);
+		Poly = Poly * x2 + L(-1.9841269841e-4f);
+		Poly = Poly * x2 + L(8.3333333333e-3f);
+		Poly = Poly * x2 + L(-1.6666666667e-1f);
+		return x + x * x2 * Poly;
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER void quat_slerp_soa(L const a[4], L const b[4], L const & t, L out[4])
+	{
+		L CosTheta = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+
+		// Take the short way around the sphere
+		L const Negate = CosTheta < L(0.0f);
+		L z[4];
+		for(length_t i = 0; i < 4; ++i)
+			z[i] = select(Negate, -b[i], b[i]);
+		CosTheta = abs(CosTheta);
+
+		// Linear interpolation when sin(angle) is close to zero, like slerp
+		L const Linear = CosTheta > L(1.0f - epsilon<float>());
+		L const Angle = quat_acos_positive(min(CosTheta, L(1.0f)));
+		L const SinAngle = quat_sin_quadrant(Angle);
+		L const SinA = quat_sin_quadrant((L(1.0f) - t) * Angle);
+		L const SinB = quat_sin_quadrant(t * Angle);
+
+		for(length_t i = 0; i < 4; ++i)
+			out[i] = select(Linear, a[i] + t * (z[i] - a[i]), (SinA * a[i] + SinB * z[i]) / SinAngle);
+	}
+
+	template <typename L>
+	GLM_FUNC_QUALIFIER void quat_fast_slerp_soa(L const a[4], L const b[4], L const & t, L out[4])
+	{
+		L CosTheta = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+
+		L const Negate = CosTheta < L(0.0f);
+		L z[4];
+		for(length_t i = 0; i < 4; ++i)
+			z[i] = select(Negate, -b[i], b[i]);
+
+		L const s = fast_slerp_factor(abs(CosTheta), t);
+		L const r = L(1.0f) - s;
+		for(length_t i = 0; i < 4; ++i)
+			out[i] = a[i] * r + z[i] * s;
+
+		L const InvLength = L(1.0f) / sqrt(out[0] * out[0] + out[1] * out[1] + out[2] * out[2] + out[3] * out[3]);
+		for(length_t i = 0; i < 4; ++i)
+			out[i] = out[i] * InvLength;
+	}
+
+	// Columns of the rotation matrix, the last row and column are implicit
+	template <typename L>
+	GLM_FUNC_QUALIFIER void quat_mat3_soa(L const q[4], L out[9])
+	{
+		L const qxx(q[0] * q[0]);
+		L const qyy(q[1] * q[1]);
+		L const qzz(q[2] * q[2]);
+		L const qxz(q[0] * q[2]);
+		L const qxy(q[0] * q[1]);
+		L const qyz(q[1] * q[2]);
+		L const qwx(q[3] * q[0]);
+		L const qwy(q[3] * q[1]);
+		L const qwz(q[3] * q[2]);
+		L const One(1.0f);
+		L const Two(2.0f);
+
+		out[0] = One - Two * (qyy + qzz);
+		out[1] = Two * (qxy + qwz);
+		out[2] = Two * (qxz - qwy);
+
+		out[3] = Two * (qxy - qwz);
+		out[4] = One - Two * (qxx + qzz);
+		out[5] = Two * (qyz + qwx);
+
+		out[6] = Two * (qxz + qwy);
+		out[7] = Two * (qyz - qwx);
+		out[8] = One - Two * (qxx + qyy);
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <precision P>
+	struct compute_quaternion_array<float, P>
+	{
+		typedef lane<float> lane_type;
+		typedef lane_type::type L;
+
+		static std::size_t const Size = lane_type::size;
+
+		GLM_FUNC_QUALIFIER static void multiply_block(tquat<float, P> const * a, tquat<float, P> const * b, tquat<float, P> * out)
+		{
+			L A[4], B[4], Result[4];
+			lane_type::load_soa<4>(&a[0].x, 4, A);
+			lane_type::load_soa<4>(&b[0].x, 4, B);
+			quat_mul_soa(A, B, Result);
+			lane_type::store_soa<4>(&out[0].x, 4, Result);
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate_block(tquat<float, P> const * q, tvec3<float, P> const * v, tvec3<float, P> * out)
+		{
+			L Q[4], V[3], Result[3];
+			lane_type::load_soa<4>(&q[0].x, 4, Q);
+			lane_type::load_soa<3>(&v[0].x, 3, V);
+			quat_rotate_soa(Q, V, Result);
+			lane_type::store_soa<3>(&out[0].x, 3, Result);
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp_block(tquat<float, P> const * a, tquat<float, P> const * b, float const * t, tquat<float, P> * out)
+		{
+			L A[4], B[4], Result[4];
+			lane_type::load_soa<4>(&a[0].x, 4, A);
+			lane_type::load_soa<4>(&b[0].x, 4, B);
+			quat_slerp_soa(A, B, lane_type::load(t, 1), Result);
+			lane_type::store_soa<4>(&out[0].x, 4, Result);
+		}
+
+		GLM_FUNC_QUALIFIER static void fast_slerp_block(tquat<float, P> const * a, tquat<float, P> const * b, float const * t, tquat<float, P> * out)
+		{
+			L A[4], B[4], Result[4];
+			lane_type::load_soa<4>(&a[0].x, 4, A);
+			lane_type::load_soa<4>(&b[0].x, 4, B);
+			quat_fast_slerp_soa(A, B, lane_type::load(t, 1), Result);
+			lane_type::store_soa<4>(&out[0].x, 4, Result);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4_cast_block(tquat<float, P> const * q, tmat4x4<float, P> * out)
+		{
+			L Q[4], Mat[9];
+			lane_type::load_soa<4>(&q[0].x, 4, Q);
+			quat_mat3_soa(Q, Mat);
+
+			L const Zero(0.0f);
+			L const Column0[4] = {Mat[0], Mat[1], Mat[2], Zero};
+			L const Column1[4] = {Mat[3], Mat[4], Mat[5], Zero};
+			L const Column2[4] = {Mat[6], Mat[7], Mat[8], Zero};
+			L const Column3[4] = {Zero, Zero, Zero, L(1.0f)};
+			lane_type::store_soa<4>(&out[0][0].x, 16, Column0);
+			lane_type::store_soa<4>(&out[0][1].x, 16, Column1);
+			lane_type::store_soa<4>(&out[0][2].x, 16, Column2);
+			lane_type::store_soa<4>(&out[0][3].x, 16, Column3);
+		}
+
+		GLM_FUNC_QUALIFIER static void multiply(tquat<float, P> const * a, tquat<float, P> const * b, tquat<float, P> * out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				multiply_block(a + i, b + i, out + i);
+
+			if(i < count)
+			{
+				tquat<float, P> A[Size], B[Size], Result[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					A[j] = a[i + j];
+					B[j] = b[i + j];
+				}
+				multiply_block(A, B, Result);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate(tquat<float, P> const * q, tvec3<float, P> const * v, tvec3<float, P> * out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				rotate_block(q + i, v + i, out + i);
+
+			if(i < count)
+			{
+				tquat<float, P> Q[Size];
+				tvec3<float, P> V[Size], Result[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					Q[j] = q[i + j];
+					V[j] = v[i + j];
+				}
+				rotate_block(Q, V, Result);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(tquat<float, P> const * a, tquat<float, P> const * b, float const * t, tquat<float, P> * out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				slerp_block(a + i, b + i, t + i, out + i);
+
+			if(i < count)
+			{
+				tquat<float, P> A[Size], B[Size], Result[Size];
+				float T[Size] = {0};
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					A[j] = a[i + j];
+					B[j] = b[i + j];
+					T[j] = t[i + j];
+				}
+				slerp_block(A, B, T, Result);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void fastSlerp(tquat<float, P> const * a, tquat<float, P> const * b, float const * t, tquat<float, P> * out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				fast_slerp_block(a + i, b + i, t + i, out + i);
+
+			if(i < count)
+			{
+				tquat<float, P> A[Size], B[Size], Result[Size];
+				float T[Size] = {0};
+				for(std::size_t j = 0; i + j < count; ++j)
+				{
+					A[j] = a[i + j];
+					B[j] = b[i + j];
+					T[j] = t[i + j];
+				}
+				fast_slerp_block(A, B, T, Result);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4_cast(tquat<float, P> const * q, tmat4x4<float, P> * out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + Size <= count; i += Size)
+				mat4_cast_block(q + i, out + i);
+
+			if(i < count)
+			{
+				tquat<float, P> Q[Size];
+				tmat4x4<float, P> Result[Size];
+				for(std::size_t j = 0; i + j < count; ++j)
+					Q[j] = q[i + j];
+				mat4_cast_block(Q, Result);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void multiply
+	(
+		detail::tquat<T, P> const * a,
+		detail::tquat<T, P> const * b,
+		detail::tquat<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'multiply' only accept floating-point inputs");
+		detail::compute_quaternion_array<T, P>::multiply(a, b, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void rotate
+	(
+		detail::tquat<T, P> const * q,
+		detail::tvec3<T, P> const * v,
+		detail::tvec3<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'rotate' only accept floating-point inputs");
+		detail::compute_quaternion_array<T, P>::rotate(q, v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void slerp
+	(
+		detail::tquat<T, P> const * a,
+		detail::tquat<T, P> const * b,
+		T const * t,
+		detail::tquat<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'slerp' only accept floating-point inputs");
+		detail::compute_quaternion_array<T, P>::slerp(a, b, t, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void fastSlerp
+	(
+		detail::tquat<T, P> const * a,
+		detail::tquat<T, P> const * b,
+		T const * t,
+		detail::tquat<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastSlerp' only accept floating-point inputs");
+		detail::compute_quaternion_array<T, P>::fastSlerp(a, b, t, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void mat4_cast
+	(
+		detail::tquat<T, P> const * q,
+		detail::tmat4x4<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mat4_cast' only accept floating-point inputs");
+		detail::compute_quaternion_array<T, P>::mat4_cast(q, out, count);
+	}
+}//namespace glm
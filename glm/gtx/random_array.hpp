@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_random_array
+/// @file glm/gtx/random_array.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtc_random (dependence)
+///
+/// @defgroup gtx_random_array GLM_GTX_random_array
+/// @ingroup gtx
+///
+/// @brief Fill arrays of scalars and vectors with random numbers.
+///
+/// The functions draw their numbers by blocks. With a xoshiro128plus_x8 engine,
+/// 8 numbers are generated at once with SSE2 or AVX2 and the float computations
+/// use SSE2. Any engine of GLM_GTC_random works but draws its numbers one by one.
+/// diskRand and ballRand don't use rejection sampling so that there is no
+/// unpredictable branch.
+///
+/// <glm/gtx/random_array.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/random.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_random_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_random_array
+	/// @{
+
+	/// 8 interleaved xoshiro128+ streams generated together with SIMD instructions.
+	/// The sequence doesn't depend on the instruction set.
+	/// Usable as a C++11 uniform random bit generator, the streams are then read in turn.
+	/// @see gtx_random_array
+	class xoshiro128plus_x8
+	{
+	public:
+		typedef uint32 result_type;
+
+		/// Initialize the 8 streams from Seed with splitmix64
+		GLM_FUNC_DECL explicit xoshiro128plus_x8(uint64 Seed = 0);
+
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		/// Write the next number of each stream
+		GLM_FUNC_DECL void generate(uint32 Out[8]);
+
+		GLM_FUNC_DECL result_type operator()();
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR result_type (min)();
+		GLM_FUNC_DECL static GLM_CONSTEXPR result_type (max)();
+
+	private:
+		uint32 State[4][8];
+		uint32 Buffer[8];
+		length_t Index;
+	};
+
+	/// Fill Out with Count random numbers in the interval [Min, Max], according a linear distribution
+	/// @see gtx_random_array
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL void linearRand(
+		T * Out,
+		std::size_t Count,
+		T const & Min,
+		T const & Max,
+		engineType & Engine);
+
+	/// Fill Out with Count random vectors in the interval [Min, Max], according a linear distribution
+	/// @see gtx_random_array
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_DECL void linearRand(
+		vecType<T, P> * Out,
+		std::size_t Count,
+		vecType<T, P> const & Min,
+		vecType<T, P> const & Max,
+		engineType & Engine);
+
+	/// Fill Out with Count random numbers according a gaussian distribution of standard deviation Deviation.
+	/// Uses the Box-Muller transform.
+	/// @see gtx_random_array
+	template <typename T, typename engineType>
+	GLM_FUNC_DECL void gaussRand(
+		T * Out,
+		std::size_t Count,
+		T const & Mean,
+		T const & Deviation,
+		engineType & Engine);
+
+	/// Fill Out with Count random vectors according a gaussian distribution of standard deviation Deviation.
+	/// Uses the Box-Muller transform.
+	/// @see gtx_random_array
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_DECL void gaussRand(
+		vecType<T, P> * Out,
+		std::size_t Count,
+		vecType<T, P> const & Mean,
+		vecType<T, P> const & Deviation,
+		engineType & Engine);
+
+	/// Fill Out with Count random 2D vectors regulary distributed on a circle of a given radius
+	/// @see gtx_random_array
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_DECL void circularRand(
+		detail::tvec2<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine);
+
+	/// Fill Out with Count random 3D vectors regulary distributed on a sphere of a given radius
+	/// @see gtx_random_array
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_DECL void sphericalRand(
+		detail::tvec3<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine);
+
+	/// Fill Out with Count random 2D vectors regulary distributed within the area of a disk of a given radius
+	/// @see gtx_random_array
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_DECL void diskRand(
+		detail::tvec2<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine);
+
+	/// Fill Out with Count random 3D vectors regulary distributed within the volume of a ball of a given radius
+	/// @see gtx_random_array
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_DECL void ballRand(
+		detail::tvec3<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine);
+
+	/// @}
+}//namespace glm
+
+#include "random_array.inl"
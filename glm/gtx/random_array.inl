@@ -0,0 +1,507 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/random_array.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Number of samples computed together, a multiple of 8
+	static std::size_t const random_array_chunk = 64;
+
+	// Fill U with Count numbers in [0, 1]
+	template <typename engineType>
+	struct compute_random_array_uniform
+	{
+		template <typename T>
+		GLM_FUNC_QUALIFIER static void call(engineType & Engine, T * U, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				U[i] = compute_linearRand<T>::call(static_cast<T>(0), static_cast<T>(1), Engine);
+		}
+	};
+
+	template <>
+	struct compute_random_array_uniform<xoshiro128plus_x8>
+	{
+		template <typename T>
+		GLM_FUNC_QUALIFIER static void call(xoshiro128plus_x8 & Engine, T * U, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				U[i] = compute_linearRand<T>::call(static_cast<T>(0), static_cast<T>(1), Engine);
+		}
+
+		// Count must be a multiple of 8
+		GLM_FUNC_QUALIFIER static void call(xoshiro128plus_x8 & Engine, float * U, std::size_t Count)
+		{
+			uint32 Bits[8];
+			for(std::size_t i = 0; i < Count; i += 8)
+			{
+				Engine.generate(Bits);
+#				if(GLM_ARCH & GLM_ARCH_SSE2)
+					__m128 const Scale = _mm_set1_ps(1.0f / 16777215.0f);
+					__m128i const Bits0 = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&Bits[0])), 8);
+					__m128i const Bits1 = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&Bits[4])), 8);
+					_mm_storeu_ps(U + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(Bits0), Scale));
+					_mm_storeu_ps(U + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(Bits1), Scale));
+#				else
+					for(std::size_t j = 0; j < 8; ++j)
+						U[i + j] = float(Bits[j] >> 8) * (1.0f / 16777215.0f);
+#				endif
+			}
+		}
+	};
+
+	// S and C are sin(2 pi U) and cos(2 pi U), Count must be a multiple of 4
+	template <typename T>
+	struct compute_random_array_sincos
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * U, T * S, T * C, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const Angle = U[i] * static_cast<T>(6.283185307179586476925286766559);
+				S[i] = sin(Angle);
+				C[i] = cos(Angle);
+			}
+		}
+	};
+
+	// Natural logarithm of U, U > 0, Count must be a multiple of 4
+	template <typename T>
+	struct compute_random_array_log
+	{
+		GLM_FUNC_QUALIFIER static void call(T const * U, T * L, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				L[i] = log(U[i]);
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// sin(2 pi u) and cos(2 pi u) for u in [0, 1]. Reduced to [-pi/4, pi/4] then Taylor polynomials, error below 2e-7.
+	GLM_FUNC_QUALIFIER void sse_sincos_2pi_ps(__m128 u, __m128 & s, __m128 & c)
+	{
+		__m128i const Quadrant = _mm_cvtps_epi32(_mm_mul_ps(u, _mm_set1_ps(4.0f)));
+		__m128 const r = _mm_sub_ps(u, _mm_mul_ps(_mm_cvtepi32_ps(Quadrant), _mm_set1_ps(0.25f)));
+		__m128 const x = _mm_mul_ps(r, _mm_set1_ps(6.283185307179586476925286766559f));
+		__m128 const x2 = _mm_mul_ps(x, x);
+
+		__m128 Sin = _mm_set1_ps(1.0f / 362880.0f);
+		Sin = _mm_add_ps(_mm_mul_ps(Sin, x2), _mm_set1_ps(-1.0f / 5040.0f));
+		Sin = _mm_add_ps(_mm_mul_ps(Sin, x2), _mm_set1_ps(1.0f / 120.0f));
+		Sin = _mm_add_ps(_mm_mul_ps(Sin, x2), _mm_set1_ps(-1.0f / 6.0f));
+		Sin = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(Sin, x2), x), x);
+
+		__m128 Cos = _mm_set1_ps(-1.0f / 3628800.0f);
+		Cos = _mm_add_ps(_mm_mul_ps(Cos, x2), _mm_set1_ps(1.0f / 40320.0f));
+		Cos = _mm_add_ps(_mm_mul_ps(Cos, x2), _mm_set1_ps(-1.0f / 720.0f));
+		Cos = _mm_add_ps(_mm_mul_ps(Cos, x2), _mm_set1_ps(1.0f / 24.0f));
+		Cos = _mm_add_ps(_mm_mul_ps(Cos, x2), _mm_set1_ps(-0.5f));
+		Cos = _mm_add_ps(_mm_mul_ps(Cos, x2), _mm_set1_ps(1.0f));
+
+		// Odd quadrants swap sin and cos, the signs follow the quadrant
+		__m128i const One = _mm_set1_epi32(1);
+		__m128i const Two = _mm_set1_epi32(2);
+		__m128 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Quadrant, One), One));
+		__m128 const SignSin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(Quadrant, Two), 30));
+		__m128 const SignCos = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(Quadrant, One), Two), 30));
+
+		s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, Cos), _mm_andnot_ps(Swap, Sin)), SignSin);
+		c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, Sin), _mm_andnot_ps(Swap, Cos)), SignCos);
+	}
+
+	// Natural logarithm of normalized positive numbers. log(m * 2^e) = log(m) + e * log(2)
+	// with m in [sqrt(0.5), sqrt(2)] and log(m) = 2 atanh((m - 1) / (m + 1)), error below 2e-7.
+	GLM_FUNC_QUALIFIER __m128 sse_log_ps(__m128 x)
+	{
+		__m128i const Bits = _mm_castps_si128(x);
+		__m128i Exponent = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127));
+		__m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+
+		__m128 const Greater = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356237f));
+		m = _mm_mul_ps(m, _mm_or_ps(_mm_and_ps(Greater, _mm_set1_ps(0.5f)), _mm_andnot_ps(Greater, _mm_set1_ps(1.0f))));
+		Exponent = _mm_sub_epi32(Exponent, _mm_castps_si128(Greater));
+
+		__m128 const s = _mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_add_ps(m, _mm_set1_ps(1.0f)));
+		__m128 const s2 = _mm_mul_ps(s, s);
+
+		__m128 Log = _mm_set1_ps(2.0f / 9.0f);
+		Log = _mm_add_ps(_mm_mul_ps(Log, s2), _mm_set1_ps(2.0f / 7.0f));
+		Log = _mm_add_ps(_mm_mul_ps(Log, s2), _mm_set1_ps(2.0f / 5.0f));
+		Log = _mm_add_ps(_mm_mul_ps(Log, s2), _mm_set1_ps(2.0f / 3.0f));
+		Log = _mm_add_ps(_mm_mul_ps(Log, s2), _mm_set1_ps(2.0f));
+		Log = _mm_mul_ps(Log, s);
+
+		return _mm_add_ps(Log, _mm_mul_ps(_mm_cvtepi32_ps(Exponent), _mm_set1_ps(0.69314718056f)));
+	}
+
+	template <>
+	struct compute_random_array_sincos<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * U, float * S, float * C, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; i += 4)
+			{
+				__m128 s, c;
+				sse_sincos_2pi_ps(_mm_loadu_ps(U + i), s, c);
+				_mm_storeu_ps(S + i, s);
+				_mm_storeu_ps(C + i, c);
+			}
+		}
+	};
+
+	template <>
+	struct compute_random_array_log<float>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const * U, float * L, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; i += 4)
+				_mm_storeu_ps(L + i, sse_log_ps(_mm_loadu_ps(U + i)));
+		}
+	};
+#endif//GLM_ARCH
+
+	// Fill Out with random_array_chunk standard normal numbers using the Box-Muller transform
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER void random_array_normal(engineType & Engine, T Out[random_array_chunk])
+	{
+		std::size_t const Half = random_array_chunk / 2;
+
+		T U[random_array_chunk];
+		compute_random_array_uniform<engineType>::call(Engine, U, random_array_chunk);
+
+		// Map the first half on [2^-24, 1] to avoid log(0)
+		for(std::size_t i = 0; i < Half; ++i)
+			U[i] = U[i] * static_cast<T>(1.0 - 1.0 / 16777216.0) + static_cast<T>(1.0 / 16777216.0);
+
+		T L[random_array_chunk / 2];
+		T S[random_array_chunk / 2];
+		T C[random_array_chunk / 2];
+		compute_random_array_log<T>::call(U, L, Half);
+		compute_random_array_sincos<T>::call(U + Half, S, C, Half);
+
+		for(std::size_t i = 0; i < Half; ++i)
+		{
+			T const Radius = sqrt(static_cast<T>(-2) * L[i]);
+			Out[i * 2 + 0] = Radius * C[i];
+			Out[i * 2 + 1] = Radius * S[i];
+		}
+	}
+}//namespace detail
+
+	// xoshiro128plus_x8
+	GLM_FUNC_QUALIFIER xoshiro128plus_x8::xoshiro128plus_x8(uint64 Seed)
+	{
+		this->seed(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128plus_x8::seed(uint64 Seed)
+	{
+		for(length_t i = 0; i < 8; ++i)
+		{
+			uint64 const A = detail::splitmix64(Seed);
+			uint64 const B = detail::splitmix64(Seed);
+			this->State[0][i] = static_cast<uint32>(A);
+			this->State[1][i] = static_cast<uint32>(A >> 32);
+			this->State[2][i] = static_cast<uint32>(B);
+			this->State[3][i] = static_cast<uint32>(B >> 32);
+		}
+		this->Index = 8;
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128plus_x8::generate(uint32 Out[8])
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+			__m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(this->State[0]));
+			__m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(this->State[1]));
+			__m256i s2 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(this->State[2]));
+			__m256i s3 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(this->State[3]));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out), _mm256_add_epi32(s0, s3));
+
+			__m256i const t = _mm256_slli_epi32(s1, 9);
+			s2 = _mm256_xor_si256(s2, s0);
+			s3 = _mm256_xor_si256(s3, s1);
+			s1 = _mm256_xor_si256(s1, s2);
+			s0 = _mm256_xor_si256(s0, s3);
+			s2 = _mm256_xor_si256(s2, t);
+			s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(this->State[0]), s0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(this->State[1]), s1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(this->State[2]), s2);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(this->State[3]), s3);
+#		elif(GLM_ARCH & GLM_ARCH_SSE2)
+			for(length_t i = 0; i < 8; i += 4)
+			{
+				__m128i s0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&this->State[0][i]));
+				__m128i s1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&this->State[1][i]));
+				__m128i s2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&this->State[2][i]));
+				__m128i s3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&this->State[3][i]));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&Out[i]), _mm_add_epi32(s0, s3));
+
+				__m128i const t = _mm_slli_epi32(s1, 9);
+				s2 = _mm_xor_si128(s2, s0);
+				s3 = _mm_xor_si128(s3, s1);
+				s1 = _mm_xor_si128(s1, s2);
+				s0 = _mm_xor_si128(s0, s3);
+				s2 = _mm_xor_si128(s2, t);
+				s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&this->State[0][i]), s0);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&this->State[1][i]), s1);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&this->State[2][i]), s2);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&this->State[3][i]), s3);
+			}
+#		else
+			for(length_t i = 0; i < 8; ++i)
+			{
+				uint32 & s0 = this->State[0][i];
+				uint32 & s1 = this->State[1][i];
+				uint32 & s2 = this->State[2][i];
+				uint32 & s3 = this->State[3][i];
+
+				Out[i] = s0 + s3;
+
+				uint32 const t = s1 << 9;
+				s2 ^= s0;
+				s3 ^= s1;
+				s1 ^= s2;
+				s0 ^= s3;
+				s2 ^= t;
+				s3 = (s3 << 11) | (s3 >> 21);
+			}
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128plus_x8::result_type xoshiro128plus_x8::operator()()
+	{
+		if(this->Index == 8)
+		{
+			this->generate(this->Buffer);
+			this->Index = 0;
+		}
+		return this->Buffer[this->Index++];
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR xoshiro128plus_x8::result_type (xoshiro128plus_x8::min)()
+	{
+		return 0;
+	}
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR xoshiro128plus_x8::result_type (xoshiro128plus_x8::max)()
+	{
+		return 0xFFFFFFFF;
+	}
+
+	// linearRand
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER void linearRand
+	(
+		T * Out,
+		std::size_t Count,
+		T const & Min,
+		T const & Max,
+		engineType & Engine
+	)
+	{
+		T U[detail::random_array_chunk];
+		for(std::size_t i = 0; i < Count; i += detail::random_array_chunk)
+		{
+			std::size_t const Size = glm::min(detail::random_array_chunk, Count - i);
+			detail::compute_random_array_uniform<engineType>::call(Engine, U, detail::random_array_chunk);
+
+			for(std::size_t j = 0; j < Size; ++j)
+				Out[i + j] = U[j] * (Max - Min) + Min;
+		}
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_QUALIFIER void linearRand
+	(
+		vecType<T, P> * Out,
+		std::size_t Count,
+		vecType<T, P> const & Min,
+		vecType<T, P> const & Max,
+		engineType & Engine
+	)
+	{
+		std::size_t const Length = static_cast<std::size_t>(Min.length());
+		std::size_t const ChunkCount = detail::random_array_chunk / 4;
+		vecType<T, P> const Range(Max - Min);
+
+		T U[detail::random_array_chunk];
+		for(std::size_t i = 0; i < Count; i += ChunkCount)
+		{
+			std::size_t const Size = glm::min(ChunkCount, Count - i);
+			detail::compute_random_array_uniform<engineType>::call(Engine, U, detail::random_array_chunk);
+
+			for(std::size_t j = 0; j < Size; ++j)
+			for(length_t k = 0; k < Min.length(); ++k)
+				Out[i + j][k] = U[j * Length + k] * Range[k] + Min[k];
+		}
+	}
+
+	// gaussRand
+	template <typename T, typename engineType>
+	GLM_FUNC_QUALIFIER void gaussRand
+	(
+		T * Out,
+		std::size_t Count,
+		T const & Mean,
+		T const & Deviation,
+		engineType & Engine
+	)
+	{
+		T Normal[detail::random_array_chunk];
+		for(std::size_t i = 0; i < Count; i += detail::random_array_chunk)
+		{
+			std::size_t const Size = glm::min(detail::random_array_chunk, Count - i);
+			detail::random_array_normal(Engine, Normal);
+
+			for(std::size_t j = 0; j < Size; ++j)
+				Out[i + j] = Normal[j] * Deviation + Mean;
+		}
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType, typename engineType>
+	GLM_FUNC_QUALIFIER void gaussRand
+	(
+		vecType<T, P> * Out,
+		std::size_t Count,
+		vecType<T, P> const & Mean,
+		vecType<T, P> const & Deviation,
+		engineType & Engine
+	)
+	{
+		std::size_t const Length = static_cast<std::size_t>(Mean.length());
+		std::size_t const ChunkCount = detail::random_array_chunk / 4;
+
+		T Normal[detail::random_array_chunk];
+		for(std::size_t i = 0; i < Count; i += ChunkCount)
+		{
+			std::size_t const Size = glm::min(ChunkCount, Count - i);
+			detail::random_array_normal(Engine, Normal);
+
+			for(std::size_t j = 0; j < Size; ++j)
+			for(length_t k = 0; k < Mean.length(); ++k)
+				Out[i + j][k] = Normal[j * Length + k] * Deviation[k] + Mean[k];
+		}
+	}
+
+	// circularRand
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_QUALIFIER void circularRand
+	(
+		detail::tvec2<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine
+	)
+	{
+		std::size_t const Chunk = detail::random_array_chunk;
+
+		T U[Chunk], S[Chunk], C[Chunk];
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			std::size_t const Size = glm::min(Chunk, Count - i);
+			detail::compute_random_array_uniform<engineType>::call(Engine, U, Chunk);
+			detail::compute_random_array_sincos<T>::call(U, S, C, Chunk);
+
+			for(std::size_t j = 0; j < Size; ++j)
+				Out[i + j] = detail::tvec2<T, P>(C[j] * Radius, S[j] * Radius);
+		}
+	}
+
+	// sphericalRand
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_QUALIFIER void sphericalRand
+	(
+		detail::tvec3<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine
+	)
+	{
+		std::size_t const Chunk = detail::random_array_chunk;
+
+		T U[Chunk * 2], S[Chunk], C[Chunk];
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			std::size_t const Size = glm::min(Chunk, Count - i);
+			detail::compute_random_array_uniform<engineType>::call(Engine, U, Chunk * 2);
+			detail::compute_random_array_sincos<T>::call(U + Chunk, S, C, Chunk);
+
+			for(std::size_t j = 0; j < Size; ++j)
+			{
+				T const z = U[j] * static_cast<T>(2) - static_cast<T>(1);
+				T const r = sqrt(max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+				Out[i + j] = detail::tvec3<T, P>(r * C[j], r * S[j], z) * Radius;
+			}
+		}
+	}
+
+	// diskRand
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_QUALIFIER void diskRand
+	(
+		detail::tvec2<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine
+	)
+	{
+		std::size_t const Chunk = detail::random_array_chunk;
+
+		// The maximum of 2 uniform numbers has the density 2r of the distance to the center of a disk
+		T U[Chunk * 3], S[Chunk], C[Chunk];
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			std::size_t const Size = glm::min(Chunk, Count - i);
+			detail::compute_random_array_uniform<engineType>::call(Engine, U, Chunk * 3);
+			detail::compute_random_array_sincos<T>::call(U + Chunk * 2, S, C, Chunk);
+
+			for(std::size_t j = 0; j < Size; ++j)
+			{
+				T const r = max(U[j], U[Chunk + j]) * Radius;
+				Out[i + j] = detail::tvec2<T, P>(r * C[j], r * S[j]);
+			}
+		}
+	}
+
+	// ballRand
+	template <typename T, precision P, typename engineType>
+	GLM_FUNC_QUALIFIER void ballRand
+	(
+		detail::tvec3<T, P> * Out,
+		std::size_t Count,
+		T const & Radius,
+		engineType & Engine
+	)
+	{
+		std::size_t const Chunk = detail::random_array_chunk;
+
+		// The maximum of 3 uniform numbers has the density 3r^2 of the distance to the center of a ball
+		T U[Chunk * 5], S[Chunk], C[Chunk];
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			std::size_t const Size = glm::min(Chunk, Count - i);
+			detail::compute_random_array_uniform<engineType>::call(Engine, U, Chunk * 5);
+			detail::compute_random_array_sincos<T>::call(U + Chunk * 4, S, C, Chunk);
+
+			for(std::size_t j = 0; j < Size; ++j)
+			{
+				T const z = U[Chunk * 3 + j] * static_cast<T>(2) - static_cast<T>(1);
+				T const r = sqrt(max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+				T const Distance = max(max(U[j], U[Chunk + j]), U[Chunk * 2 + j]) * Radius;
+				Out[i + j] = detail::tvec3<T, P>(r * C[j], r * S[j], z) * Distance;
+			}
+		}
+	}
+}//namespace glm
@@ -194,6 +194,15 @@ namespace detail
 	detail::fmat4x4SIMD inverse(
 		detail::fmat4x4SIMD const & m);
 
+	//! Multiply count pairs of matrices, out[i] = a[i] * b[i].
+	//! out may alias a or b. Two columns are computed at once when AVX is enabled.
+	//! (From GLM_GTX_simd_mat4 extension).
+	void matrixMultiply(
+		detail::fmat4x4SIMD const * a,
+		detail::fmat4x4SIMD const * b,
+		detail::fmat4x4SIMD * out,
+		std::size_t count);
+
 	/// @}
 }// namespace glm
 
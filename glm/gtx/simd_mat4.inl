@@ -129,10 +129,14 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator+=
 	fmat4x4SIMD const & m
 )
 {
-	this->Data[0].Data = _mm_add_ps(this->Data[0].Data, m[0].Data);
-	this->Data[1].Data = _mm_add_ps(this->Data[1].Data, m[1].Data);
-	this->Data[2].Data = _mm_add_ps(this->Data[2].Data, m[2].Data);
-	this->Data[3].Data = _mm_add_ps(this->Data[3].Data, m[3].Data);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		avx_add_ps(&this->Data[0].Data, &m.Data[0].Data, &this->Data[0].Data);
+#	else
+		this->Data[0].Data = _mm_add_ps(this->Data[0].Data, m[0].Data);
+		this->Data[1].Data = _mm_add_ps(this->Data[1].Data, m[1].Data);
+		this->Data[2].Data = _mm_add_ps(this->Data[2].Data, m[2].Data);
+		this->Data[3].Data = _mm_add_ps(this->Data[3].Data, m[3].Data);
+#	endif
 	return *this;
 }
 
@@ -141,10 +145,14 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator-=
 	fmat4x4SIMD const & m
 )
 {
-	this->Data[0].Data = _mm_sub_ps(this->Data[0].Data, m[0].Data);
-	this->Data[1].Data = _mm_sub_ps(this->Data[1].Data, m[1].Data);
-	this->Data[2].Data = _mm_sub_ps(this->Data[2].Data, m[2].Data);
-	this->Data[3].Data = _mm_sub_ps(this->Data[3].Data, m[3].Data);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		avx_sub_ps(&this->Data[0].Data, &m.Data[0].Data, &this->Data[0].Data);
+#	else
+		this->Data[0].Data = _mm_sub_ps(this->Data[0].Data, m[0].Data);
+		this->Data[1].Data = _mm_sub_ps(this->Data[1].Data, m[1].Data);
+		this->Data[2].Data = _mm_sub_ps(this->Data[2].Data, m[2].Data);
+		this->Data[3].Data = _mm_sub_ps(this->Data[3].Data, m[3].Data);
+#	endif
 
 	return *this;
 }
@@ -154,7 +162,17 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator*=
 	fmat4x4SIMD const & m
 )
 {
-	sse_mul_ps(&this->Data[0].Data, &m.Data[0].Data, &this->Data[0].Data);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		avx_mul_ps(&this->Data[0].Data, &m.Data[0].Data, &this->Data[0].Data);
+#	else
+		// sse_mul_ps writes out while it still reads in1
+		__m128 Result[4];
+		sse_mul_ps(&this->Data[0].Data, &m.Data[0].Data, Result);
+		this->Data[0].Data = Result[0];
+		this->Data[1].Data = Result[1];
+		this->Data[2].Data = Result[2];
+		this->Data[3].Data = Result[3];
+#	endif
 	return *this;
 }
 
@@ -165,8 +183,7 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator/=
 {
 	__m128 Inv[4];
 	sse_inverse_ps(&m.Data[0].Data, Inv);
-	sse_mul_ps(&this->Data[0].Data, Inv, &this->Data[0].Data);
-	return *this;
+	return *this *= fmat4x4SIMD(Inv);
 }
 
 GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator+= 
@@ -390,7 +407,11 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD operator*
 )
 {
     fmat4x4SIMD result;
-    sse_mul_ps(&m1.Data[0].Data, &m2.Data[0].Data, &result.Data[0].Data);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		avx_mul_ps(&m1.Data[0].Data, &m2.Data[0].Data, &result.Data[0].Data);
+#	else
+		sse_mul_ps(&m1.Data[0].Data, &m2.Data[0].Data, &result.Data[0].Data);
+#	endif
     
     return result;
 }
@@ -462,7 +483,11 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD operator/
 	__m128 inv[4];
 
 	sse_inverse_ps(&m2.Data[0].Data, inv);
-	sse_mul_ps(&m1.Data[0].Data, inv, result);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		avx_mul_ps(&m1.Data[0].Data, inv, result);
+#	else
+		sse_mul_ps(&m1.Data[0].Data, inv, result);
+#	endif
 
 	return fmat4x4SIMD(result);
 }
@@ -536,10 +561,14 @@ GLM_FUNC_QUALIFIER detail::fmat4x4SIMD matrixCompMult
 )
 {
 	detail::fmat4x4SIMD result;
-	result[0] = x[0] * y[0];
-	result[1] = x[1] * y[1];
-	result[2] = x[2] * y[2];
-	result[3] = x[3] * y[3];
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+		detail::avx_comp_mul_ps(&x.Data[0].Data, &y.Data[0].Data, &result.Data[0].Data);
+#	else
+		result[0] = x[0] * y[0];
+		result[1] = x[1] * y[1];
+		result[2] = x[2] * y[2];
+		result[3] = x[3] * y[3];
+#	endif
 	return result;
 }
 
@@ -576,4 +605,27 @@ GLM_FUNC_QUALIFIER float determinant(detail::fmat4x4SIMD const & m)
 	return Result;
 }
 
+GLM_FUNC_QUALIFIER void matrixMultiply
+(
+	detail::fmat4x4SIMD const * a,
+	detail::fmat4x4SIMD const * b,
+	detail::fmat4x4SIMD * out,
+	std::size_t count
+)
+{
+	for(std::size_t i = 0; i < count; ++i)
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX)
+			detail::avx_mul_ps(&a[i].Data[0].Data, &b[i].Data[0].Data, &out[i].Data[0].Data);
+#		else
+			__m128 Result[4];
+			detail::sse_mul_ps(&a[i].Data[0].Data, &b[i].Data[0].Data, Result);
+			out[i].Data[0].Data = Result[0];
+			out[i].Data[1].Data = Result[1];
+			out[i].Data[2].Data = Result[2];
+			out[i].Data[3].Data = Result[3];
+#		endif
+	}
+}
+
 }//namespace glm
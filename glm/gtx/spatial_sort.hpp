@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_spatial_sort
+/// @file glm/gtx/spatial_sort.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_morton (dependence)
+///
+/// @defgroup gtx_spatial_sort GLM_GTX_spatial_sort
+/// @ingroup gtx
+/// 
+/// @brief Sort positions along the Morton curve so that close positions are close in memory.
+/// 
+/// The keys are sorted with a least significant digit radix sort of 8 bits
+/// digits, which is stable. The keys are split in blocks of 64K keys whose
+/// histograms are computed and scattered in parallel with OpenMP when it is
+/// enabled. The passes of the digits that every key shares are skipped.
+/// 
+/// <glm/gtx/spatial_sort.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/morton.hpp"
+#include <cstddef>
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_spatial_sort extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spatial_sort
+	/// @{
+
+	/// Sort the Count keys of Keys in increasing order and write in Permutation
+	/// the index the sorted keys had in Keys. Equal keys keep their order.
+	/// @tparam genUType uint32 or uint64
+	/// @see gtx_spatial_sort
+	template <typename genUType>
+	GLM_FUNC_DECL void spatialSort(
+		genUType * Keys,
+		std::size_t * Permutation,
+		std::size_t Count);
+
+	/// Write in Keys the Morton codes of the Count positions of In, quantized in
+	/// the box between Min and Max like the array version of mortonEncode, sorted
+	/// in increasing order. Permutation[i] is the index in In of the i-th key.
+	/// In is not modified, use spatialReorder to sort it and the associated data.
+	/// @tparam genUType uint32 or uint64, 10 or 21 bits per axis
+	/// @see gtx_spatial_sort
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_DECL void spatialSort(
+		detail::tvec3<T, P> const * In,
+		genUType * Keys,
+		std::size_t * Permutation,
+		std::size_t Count,
+		detail::tvec3<T, P> const & Min,
+		detail::tvec3<T, P> const & Max);
+
+	/// Reorder in place the Count elements of Data so that Data[i] becomes the
+	/// element at Permutation[i], following the cycles of the permutation.
+	/// @see gtx_spatial_sort
+	template <typename genType>
+	GLM_FUNC_DECL void spatialReorder(
+		std::size_t const * Permutation,
+		genType * Data,
+		std::size_t Count);
+
+	/// @}
+}//namespace glm
+
+#include "spatial_sort.inl"
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/spatial_sort.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace glm{
+namespace detail
+{
+	template <typename genUType>
+	struct compute_radix_sort
+	{
+		static std::size_t const Radix = 256;
+		static std::size_t const BlockSize = 1 << 16;
+
+		GLM_FUNC_QUALIFIER static void call(genUType * Keys, std::size_t * Values, std::size_t Count)
+		{
+			if(Count < 2)
+				return;
+
+			std::size_t const BlockCount = (Count + BlockSize - 1) / BlockSize;
+			int const Blocks = static_cast<int>(BlockCount);
+
+			std::vector<genUType> KeysTemp(Count);
+			std::vector<std::size_t> ValuesTemp(Count);
+			std::vector<std::size_t> Offsets(BlockCount * Radix);
+
+			genUType * SrcKeys = Keys;
+			genUType * DstKeys = &KeysTemp[0];
+			std::size_t * SrcValues = Values;
+			std::size_t * DstValues = &ValuesTemp[0];
+
+			for(std::size_t Shift = 0; Shift < sizeof(genUType) * 8; Shift += 8)
+			{
+				// Histogram of the digits of each block
+#				if GLM_HAS_OPENMP
+#					pragma omp parallel for
+#				endif
+				for(int b = 0; b < Blocks; ++b)
+				{
+					std::size_t * Histogram = &Offsets[static_cast<std::size_t>(b) * Radix];
+					std::fill(Histogram, Histogram + Radix, std::size_t(0));
+
+					std::size_t const Begin = static_cast<std::size_t>(b) * BlockSize;
+					std::size_t const End = Count - Begin > BlockSize ? Begin + BlockSize : Count;
+					for(std::size_t i = Begin; i < End; ++i)
+						++Histogram[(SrcKeys[i] >> Shift) & 0xFF];
+				}
+
+				// First position of each digit of each block, the blocks of a digit are consecutive
+				// to keep the sort stable. When a digit holds every key, the pass doesn't move them.
+				bool Skip = false;
+				std::size_t Offset = 0;
+				for(std::size_t Digit = 0; Digit < Radix && !Skip; ++Digit)
+				{
+					std::size_t const First = Offset;
+					for(std::size_t b = 0; b < BlockCount; ++b)
+					{
+						std::size_t const DigitCount = Offsets[b * Radix + Digit];
+						Offsets[b * Radix + Digit] = Offset;
+						Offset += DigitCount;
+					}
+					Skip = Offset - First == Count;
+				}
+				if(Skip)
+					continue;
+
+#				if GLM_HAS_OPENMP
+#					pragma omp parallel for
+#				endif
+				for(int b = 0; b < Blocks; ++b)
+				{
+					std::size_t * Position = &Offsets[static_cast<std::size_t>(b) * Radix];
+
+					std::size_t const Begin = static_cast<std::size_t>(b) * BlockSize;
+					std::size_t const End = Count - Begin > BlockSize ? Begin + BlockSize : Count;
+					for(std::size_t i = Begin; i < End; ++i)
+					{
+						std::size_t const Destination = Position[(SrcKeys[i] >> Shift) & 0xFF]++;
+						DstKeys[Destination] = SrcKeys[i];
+						DstValues[Destination] = SrcValues[i];
+					}
+				}
+
+				std::swap(SrcKeys, DstKeys);
+				std::swap(SrcValues, DstValues);
+			}
+
+			if(SrcKeys != Keys)
+			{
+				std::copy(SrcKeys, SrcKeys + Count, Keys);
+				std::copy(SrcValues, SrcValues + Count, Values);
+			}
+		}
+	};
+}//namespace detail
+
+	template <typename genUType>
+	GLM_FUNC_QUALIFIER void spatialSort
+	(
+		genUType * Keys,
+		std::size_t * Permutation,
+		std::size_t Count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genUType>::is_integer && !std::numeric_limits<genUType>::is_signed, "'spatialSort' only accept unsigned integer keys");
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Permutation[i] = i;
+		detail::compute_radix_sort<genUType>::call(Keys, Permutation, Count);
+	}
+
+	template <typename genUType, typename T, precision P>
+	GLM_FUNC_QUALIFIER void spatialSort
+	(
+		detail::tvec3<T, P> const * In,
+		genUType * Keys,
+		std::size_t * Permutation,
+		std::size_t Count,
+		detail::tvec3<T, P> const & Min,
+		detail::tvec3<T, P> const & Max
+	)
+	{
+		mortonEncode(In, Keys, Count, Min, Max);
+		spatialSort(Keys, Permutation, Count);
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void spatialReorder
+	(
+		std::size_t const * Permutation,
+		genType * Data,
+		std::size_t Count
+	)
+	{
+		std::vector<bool> Placed(Count, false);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			if(Placed[i])
+				continue;
+
+			// Move each element of the cycle of i to its place, the first one last
+			genType const First(Data[i]);
+			std::size_t j = i;
+			for(std::size_t k = Permutation[j]; k != i; j = k, k = Permutation[j])
+			{
+				Data[j] = Data[k];
+				Placed[j] = true;
+			}
+			Data[j] = First;
+			Placed[j] = true;
+		}
+	}
+}//namespace glm
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array.hpp
+/// @date 2014-10-16 / 2014-10-16
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_array GLM_GTX_transform_array
+/// @ingroup gtx
+///
+/// @brief Transform arrays of vectors by a single 4 * 4 matrix.
+///
+/// Float arrays are processed 4 (SSE2) or 8 (AVX) vectors at a time,
+/// the remaining vectors are processed one by one.
+/// Inputs don't need to be aligned. The output may alias the input
+/// but the arrays must not partially overlap.
+///
+/// <glm/gtx/transform_array.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../detail/intrinsic_matrix.hpp"
+#	include "../detail/_lane.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(GLM_EXT_INCLUDED))
+#	pragma message("GLM: GLM_GTX_transform_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_array
+	/// @{
+
+	/// Transform count points by m, w is assumed to be 1.
+	/// No perspective division is performed.
+	/// @see gtx_transform_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transform(
+		detail::tmat4x4<T, P> const & m,
+		detail::tvec3<T, P> const * in,
+		detail::tvec3<T, P> * out,
+		std::size_t count);
+
+	/// Transform count vectors by m.
+	/// @see gtx_transform_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transform(
+		detail::tmat4x4<T, P> const & m,
+		detail::tvec4<T, P> const * in,
+		detail::tvec4<T, P> * out,
+		std::size_t count);
+
+	/// Transform count points stored as a structure of arrays by m, w is assumed to be 1.
+	/// No perspective division is performed.
+	/// @see gtx_transform_array
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transform(
+		detail::tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "transform_array.inl"
@@ -0,0 +1,251 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : glm/gtx/transform_array.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P>
+	struct compute_transform_array
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec3<T, P> const * in, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = tvec3<T, P>(m * tvec4<T, P>(in[i], static_cast<T>(1)));
+		}
+
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec4<T, P> const * in, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m,
+			T const * inX, T const * inY, T const * inZ,
+			T * outX, T * outY, T * outZ,
+			std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tvec4<T, P> const Result(m * tvec4<T, P>(inX[i], inY[i], inZ[i], static_cast<T>(1)));
+				outX[i] = Result.x;
+				outY[i] = Result.y;
+				outZ[i] = Result.z;
+			}
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Transform 4 points stored in SoA form. c holds the 12 used matrix components, c[Column * 3 + Row].
+	GLM_FUNC_QUALIFIER void sse_transform_soa_ps(__m128 const c[12], __m128 x, __m128 y, __m128 z, __m128 & ox, __m128 & oy, __m128 & oz)
+	{
+		ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c[0], x), _mm_mul_ps(c[3], y)), _mm_add_ps(_mm_mul_ps(c[6], z), c[9]));
+		oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c[1], x), _mm_mul_ps(c[4], y)), _mm_add_ps(_mm_mul_ps(c[7], z), c[10]));
+		oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c[2], x), _mm_mul_ps(c[5], y)), _mm_add_ps(_mm_mul_ps(c[8], z), c[11]));
+	}
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	GLM_FUNC_QUALIFIER void avx_transform_soa_ps(__m256 const c[12], __m256 x, __m256 y, __m256 z, __m256 & ox, __m256 & oy, __m256 & oz)
+	{
+		ox = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c[0], x), _mm256_mul_ps(c[3], y)), _mm256_add_ps(_mm256_mul_ps(c[6], z), c[9]));
+		oy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c[1], x), _mm256_mul_ps(c[4], y)), _mm256_add_ps(_mm256_mul_ps(c[7], z), c[10]));
+		oz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c[2], x), _mm256_mul_ps(c[5], y)), _mm256_add_ps(_mm256_mul_ps(c[8], z), c[11]));
+	}
+#	endif//GLM_ARCH
+
+	template <precision P>
+	struct compute_transform_array<float, P>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec3<float, P> const * in, tvec3<float, P> * out, std::size_t count)
+		{
+			__m128 Mat[4];
+			__m128 Col[12];
+			for(length_t k = 0; k < 4; ++k)
+			{
+				Mat[k] = _mm_loadu_ps(&m[k].x);
+				Col[k * 3 + 0] = _mm_set1_ps(m[k].x);
+				Col[k * 3 + 1] = _mm_set1_ps(m[k].y);
+				Col[k * 3 + 2] = _mm_set1_ps(m[k].z);
+			}
+
+			float const * Src = &in[0].x;
+			float * Dst = &out[0].x;
+			std::size_t i = 0;
+
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+			{
+				__m256 Col8[12];
+				for(length_t k = 0; k < 12; ++k)
+					Col8[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(Col[k]), Col[k], 1);
+
+				std::size_t const End8 = count - count % 8;
+				for(; i < End8; i += 8, Src += 24, Dst += 24)
+				{
+					__m256 x, y, z, a, b, c;
+					avx_aos3_to_soa_ps(avx_loadu2_ps(Src + 0, Src + 12), avx_loadu2_ps(Src + 4, Src + 16), avx_loadu2_ps(Src + 8, Src + 20), x, y, z);
+					avx_transform_soa_ps(Col8, x, y, z, x, y, z);
+					avx_soa_to_aos3_ps(x, y, z, a, b, c);
+					avx_storeu2_ps(Dst + 0, Dst + 12, a);
+					avx_storeu2_ps(Dst + 4, Dst + 16, b);
+					avx_storeu2_ps(Dst + 8, Dst + 20, c);
+				}
+			}
+#			endif//GLM_ARCH
+
+			std::size_t const End = count - count % 4;
+			for(; i < End; i += 4, Src += 12, Dst += 12)
+			{
+				__m128 x, y, z, a, b, c;
+				sse_aos3_to_soa_ps(_mm_loadu_ps(Src + 0), _mm_loadu_ps(Src + 4), _mm_loadu_ps(Src + 8), x, y, z);
+				sse_transform_soa_ps(Col, x, y, z, x, y, z);
+				sse_soa_to_aos3_ps(x, y, z, a, b, c);
+				_mm_storeu_ps(Dst + 0, a);
+				_mm_storeu_ps(Dst + 4, b);
+				_mm_storeu_ps(Dst + 8, c);
+			}
+
+			// Tail, a 16 bytes load would read past the end of the array
+			for(; i < count; ++i, Src += 3, Dst += 3)
+			{
+				GLM_ALIGN(16) float Result[4];
+				_mm_store_ps(Result, sse_mul_ps(Mat, _mm_set_ps(1.0f, Src[2], Src[1], Src[0])));
+				Dst[0] = Result[0];
+				Dst[1] = Result[1];
+				Dst[2] = Result[2];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec4<float, P> const * in, tvec4<float, P> * out, std::size_t count)
+		{
+			__m128 Mat[4];
+			for(length_t k = 0; k < 4; ++k)
+				Mat[k] = _mm_loadu_ps(&m[k].x);
+
+			float const * Src = &in[0].x;
+			float * Dst = &out[0].x;
+			std::size_t i = 0;
+
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+			{
+				__m256 Mat8[4];
+				for(length_t k = 0; k < 4; ++k)
+					Mat8[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(Mat[k]), Mat[k], 1);
+
+				// Two vectors per iteration, _mm256_shuffle_ps broadcasts within each 128 bits lane
+				std::size_t const End = count - count % 2;
+				for(; i < End; i += 2, Src += 8, Dst += 8)
+				{
+					__m256 v = _mm256_loadu_ps(Src);
+					__m256 m0 = _mm256_mul_ps(Mat8[0], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+					__m256 m1 = _mm256_mul_ps(Mat8[1], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+					__m256 m2 = _mm256_mul_ps(Mat8[2], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+					__m256 m3 = _mm256_mul_ps(Mat8[3], _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+					_mm256_storeu_ps(Dst, _mm256_add_ps(_mm256_add_ps(m0, m1), _mm256_add_ps(m2, m3)));
+				}
+			}
+#			endif//GLM_ARCH
+
+			for(; i < count; ++i, Src += 4, Dst += 4)
+				_mm_storeu_ps(Dst, sse_mul_ps(Mat, _mm_loadu_ps(Src)));
+		}
+
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m,
+			float const * inX, float const * inY, float const * inZ,
+			float * outX, float * outY, float * outZ,
+			std::size_t count)
+		{
+			__m128 Col[12];
+			for(length_t k = 0; k < 4; ++k)
+			{
+				Col[k * 3 + 0] = _mm_set1_ps(m[k].x);
+				Col[k * 3 + 1] = _mm_set1_ps(m[k].y);
+				Col[k * 3 + 2] = _mm_set1_ps(m[k].z);
+			}
+
+			std::size_t i = 0;
+
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+			{
+				__m256 Col8[12];
+				for(length_t k = 0; k < 12; ++k)
+					Col8[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(Col[k]), Col[k], 1);
+
+				std::size_t const End8 = count - count % 8;
+				for(; i < End8; i += 8)
+				{
+					__m256 x, y, z;
+					avx_transform_soa_ps(Col8, _mm256_loadu_ps(inX + i), _mm256_loadu_ps(inY + i), _mm256_loadu_ps(inZ + i), x, y, z);
+					_mm256_storeu_ps(outX + i, x);
+					_mm256_storeu_ps(outY + i, y);
+					_mm256_storeu_ps(outZ + i, z);
+				}
+			}
+#			endif//GLM_ARCH
+
+			std::size_t const End = count - count % 4;
+			for(; i < End; i += 4)
+			{
+				__m128 x, y, z;
+				sse_transform_soa_ps(Col, _mm_loadu_ps(inX + i), _mm_loadu_ps(inY + i), _mm_loadu_ps(inZ + i), x, y, z);
+				_mm_storeu_ps(outX + i, x);
+				_mm_storeu_ps(outY + i, y);
+				_mm_storeu_ps(outZ + i, z);
+			}
+
+			for(; i < count; ++i)
+			{
+				__m128 x, y, z;
+				sse_transform_soa_ps(Col, _mm_set_ss(inX[i]), _mm_set_ss(inY[i]), _mm_set_ss(inZ[i]), x, y, z);
+				outX[i] = _mm_cvtss_f32(x);
+				outY[i] = _mm_cvtss_f32(y);
+				outZ[i] = _mm_cvtss_f32(z);
+			}
+		}
+	};
+#endif//GLM_ARCH
+}//namespace detail
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform
+	(
+		detail::tmat4x4<T, P> const & m,
+		detail::tvec3<T, P> const * in,
+		detail::tvec3<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transform' only accept floating-point inputs");
+		detail::compute_transform_array<T, P>::call(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform
+	(
+		detail::tmat4x4<T, P> const & m,
+		detail::tvec4<T, P> const * in,
+		detail::tvec4<T, P> * out,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transform' only accept floating-point inputs");
+		detail::compute_transform_array<T, P>::call(m, in, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform
+	(
+		detail::tmat4x4<T, P> const & m,
+		T const * inX, T const * inY, T const * inZ,
+		T * outX, T * outY, T * outZ,
+		std::size_t count
+	)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'transform' only accept floating-point inputs");
+		detail::compute_transform_array<T, P>::call(m, inX, inY, inZ, outX, outY, outZ, count);
+	}
+}//namespace glm
@@ -130,6 +130,13 @@ int test_transpose()
 		Error += t == mat4(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15) ? 0 : 1;
 	}
 
+	{
+		dmat4 m(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+		dmat4 t = transpose(m);
+		Error += t == dmat4(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15) ? 0 : 1;
+		Error += transpose(t) == m ? 0 : 1;
+	}
+
 	{
 		mat4x2 m(0, 1, 2, 3, 4, 5, 6, 7);
 		mat2x4 t = transpose(m);
@@ -147,9 +154,32 @@ int test_transpose()
 
 int test_determinant()
 {
+	int Error(0);
+
+	{
+		glm::mat4 const A(
+			glm::vec4(2, 1, 0, 3),
+			glm::vec4(1, 3, 2, 0),
+			glm::vec4(0, 2, 4, 1),
+			glm::vec4(3, 0, 1, 5));
+		Error += glm::determinant(A) == -29.0f ? 0 : 1;
+	}
 
+	{
+		glm::dmat4 const A(
+			glm::dvec4(2, 1, 0, 3),
+			glm::dvec4(1, 3, 2, 0),
+			glm::dvec4(0, 2, 4, 1),
+			glm::dvec4(3, 0, 1, 5));
+		Error += glm::determinant(A) == -29.0 ? 0 : 1;
+		Error += glm::determinant(glm::transpose(A)) == -29.0 ? 0 : 1;
+		Error += glm::determinant(glm::dmat4(1.0)) == 1.0 ? 0 : 1;
+
+		glm::dmat4 const B = glm::rotate(glm::dmat4(1.0), 0.5, glm::dvec3(0.0, 0.0, 1.0));
+		Error += glm::abs(glm::determinant(B) - 1.0) < 1e-12 ? 0 : 1;
+	}
 
-	return 0;
+	return Error;
 }
 
 int test_inverse()
@@ -180,6 +210,15 @@ int test_inverse()
 	glm::mat2x2 I2x2 = A2x2 * B2x2;
 	Failed += I2x2 == glm::mat2x2(1) ? 0 : 1;
 
+	glm::dmat4x4 A4x4d(
+		glm::dvec4(1, 0, 1, 0), 
+		glm::dvec4(0, 1, 0, 0), 
+		glm::dvec4(0, 0, 1, 0), 
+		glm::dvec4(0, 0, 0, 1));
+	glm::dmat4x4 B4x4d = inverse(A4x4d);
+	glm::dmat4x4 I4x4d = A4x4d * B4x4d;
+	Failed += I4x4d == glm::dmat4x4(1) ? 0 : 1;
+
 
 
 	return Failed;
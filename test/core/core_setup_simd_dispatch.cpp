@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT License
+// File    : test/core/core_setup_simd_dispatch.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define GLM_FORCE_SIMD_DISPATCH
+#include <glm/glm.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	glm::mat4 const A(
+		 2.0f, 1.0f, 0.5f, 0.0f,
+		-1.0f, 3.0f, 0.0f, 0.0f,
+		 0.5f, 0.0f, 4.0f, 0.0f,
+		 1.0f,-2.0f, 3.0f, 1.0f);
+
+	glm::mat4 const B(
+		 1.0f, 0.0f, 2.0f, 0.5f,
+		 0.0f, 1.5f, 0.0f,-1.0f,
+		 3.0f, 0.0f, 1.0f, 0.0f,
+		-1.0f, 2.0f, 0.0f, 2.0f);
+
+	bool equal(glm::vec4 const & a, glm::vec4 const & b)
+	{
+		return glm::all(glm::epsilonEqual(a, b, 0.0001f));
+	}
+
+	bool equal(glm::mat4 const & a, glm::mat4 const & b)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(!equal(a[i], b[i]))
+				return false;
+		return true;
+	}
+}//namespace
+
+int test_vec4()
+{
+	int Error(0);
+
+	glm::vec4 const U(1.0f, -2.0f, 3.0f, 0.5f);
+	glm::vec4 const V(-4.0f, 0.25f, 2.0f, 8.0f);
+
+	Error += equal(U * V, glm::vec4(U.x * V.x, U.y * V.y, U.z * V.z, U.w * V.w)) ? 0 : 1;
+	Error += equal(U * 2.0f, glm::vec4(2.0f, -4.0f, 6.0f, 1.0f)) ? 0 : 1;
+	Error += equal(2.0f * U, glm::vec4(2.0f, -4.0f, 6.0f, 1.0f)) ? 0 : 1;
+
+	float const Dot = U.x * V.x + U.y * V.y + U.z * V.z + U.w * V.w;
+	Error += glm::epsilonEqual(glm::dot(U, V), Dot, 0.0001f) ? 0 : 1;
+
+	float const Length = std::sqrt(glm::dot(U, U));
+	Error += equal(glm::normalize(U), U / Length) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::length(glm::normalize(V)), 1.0f, 0.0001f) ? 0 : 1;
+
+	// Lower precisions go through the same kernels
+	glm::lowp_vec4 const L(1.0f, 2.0f, 3.0f, 4.0f);
+	Error += glm::all(glm::epsilonEqual(L * L, glm::lowp_vec4(1.0f, 4.0f, 9.0f, 16.0f), 0.0001f)) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::dot(L, L), 30.0f, 0.0001f) ? 0 : 1;
+
+	return Error;
+}
+
+int test_mat4()
+{
+	int Error(0);
+
+	glm::vec4 const V(1.0f, -2.0f, 3.0f, 0.5f);
+
+	glm::vec4 MulMV;
+	glm::vec4 MulVM;
+	glm::mat4 MulMM;
+	glm::mat4 Transpose;
+	glm::mat4 CompMult;
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		MulMV[i] = A[0][i] * V[0] + A[1][i] * V[1] + A[2][i] * V[2] + A[3][i] * V[3];
+		MulVM[i] = A[i][0] * V[0] + A[i][1] * V[1] + A[i][2] * V[2] + A[i][3] * V[3];
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			MulMM[i][j] = A[0][j] * B[i][0] + A[1][j] * B[i][1] + A[2][j] * B[i][2] + A[3][j] * B[i][3];
+			Transpose[i][j] = A[j][i];
+			CompMult[i][j] = A[i][j] * B[i][j];
+		}
+	}
+
+	Error += equal(A * V, MulMV) ? 0 : 1;
+	Error += equal(V * A, MulVM) ? 0 : 1;
+	Error += equal(A * B, MulMM) ? 0 : 1;
+	Error += equal(glm::transpose(A), Transpose) ? 0 : 1;
+	Error += equal(glm::matrixCompMult(A, B), CompMult) ? 0 : 1;
+
+	// The result may alias an operand
+	glm::mat4 C(A);
+	C *= B;
+	Error += equal(C, MulMM) ? 0 : 1;
+
+	glm::mat4 const Inverse = glm::inverse(A);
+	Error += equal(A * Inverse, glm::mat4(1.0f)) ? 0 : 1;
+	Error += equal(Inverse * A, glm::mat4(1.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_mat4()
+{
+	int Error(0);
+
+	std::size_t const Count = 1 << 20;
+
+	glm::vec4 V(1.0f);
+	std::clock_t TimeStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat4 M(A);
+		M[3] = glm::vec4(V.x, V.y, V.z, 1.0f);
+		V = glm::normalize(glm::transpose(glm::inverse(M * B)) * V);
+	}
+	std::clock_t TimeEnd = std::clock();
+
+	Error += glm::any(glm::isnan(V)) ? 1 : 0;
+
+	printf("mat4 dispatch: %ld clocks\n", static_cast<long>(TimeEnd - TimeStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_vec4();
+	Error += test_mat4();
+	Error += perf_mat4();
+
+	return Error;
+}
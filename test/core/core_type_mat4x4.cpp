@@ -65,6 +65,58 @@ int test_inverse_dmat4x4()
 	return 0;
 }
 
+// Reference product computed one component at a time, independently of GLM_ARCH
+glm::dmat4 mulReference(glm::dmat4 const & a, glm::dmat4 const & b)
+{
+	glm::dmat4 Result(0.0);
+	for(glm::length_t i = 0; i < 4; ++i)
+	for(glm::length_t j = 0; j < 4; ++j)
+		Result[i][j] = ((a[0][j] * b[i][0] + a[1][j] * b[i][1]) + a[2][j] * b[i][2]) + a[3][j] * b[i][3];
+	return Result;
+}
+
+int test_dmat4_arch()
+{
+	int Error(0);
+
+	glm::dmat4 const A(
+		glm::dvec4(0.6, 0.2, 0.3, 0.4),
+		glm::dvec4(0.2, 0.7, 0.5, 0.3),
+		glm::dvec4(0.3, 0.5, 0.7, 0.2),
+		glm::dvec4(0.4, 0.3, 0.2, 0.6));
+	glm::dmat4 const B(
+		glm::dvec4(1.0, 2.0,-3.0, 4.0),
+		glm::dvec4(5.0,-6.0, 7.0, 8.0),
+		glm::dvec4(9.0, 1.5, 2.5,-3.5),
+		glm::dvec4(0.5, 4.5,-5.5, 6.5));
+	glm::dvec4 const V(1.0,-2.0, 3.0, 0.5);
+
+	glm::dmat4 const Product = A * B;
+	glm::dmat4 const Reference = mulReference(A, B);
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(Product[i], Reference[i], 1e-12)) ? 0 : 1;
+
+	glm::dvec4 const Transformed = A * V;
+	glm::dvec4 const TransformedReference = A[0] * V.x + A[1] * V.y + A[2] * V.z + A[3] * V.w;
+	Error += glm::all(glm::epsilonEqual(Transformed, TransformedReference, 1e-12)) ? 0 : 1;
+
+	glm::dmat4 const Inverse = glm::inverse(B);
+	glm::dmat4 const Identity = mulReference(B, Inverse);
+	for(glm::length_t i = 0; i < 4; ++i)
+	{
+		glm::dvec4 Column(0.0);
+		Column[i] = 1.0;
+		Error += glm::all(glm::epsilonEqual(Identity[i], Column, 1e-12)) ? 0 : 1;
+	}
+
+	glm::lowp_dmat4 const LowpA(A);
+	glm::lowp_dmat4 const LowpProduct = LowpA * glm::lowp_dmat4(B);
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(glm::dvec4(LowpProduct[i]), Reference[i], 1e-12)) ? 0 : 1;
+
+	return Error;
+}
+
 static bool test_operators()
 {
 	glm::mat4x4 l(1.0f);
@@ -251,6 +303,7 @@ int main()
 	Error += test_inverse_mat4x4();
 	Error += test_operators();
 	Error += test_inverse();
+	Error += test_dmat4_arch();
 
 	return Error;
 }
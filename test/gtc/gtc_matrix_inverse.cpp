@@ -2,16 +2,195 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2010-09-16
-// Updated : 2010-09-16
+// Updated : 2014-10-16
 // Licence : This source is under MIT licence
 // File    : test/gtc/matrix_inverse.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_rigid(std::size_t i)
+	{
+		glm::detail::tvec3<T, glm::defaultp> const Axis = glm::normalize(glm::detail::tvec3<T, glm::defaultp>(
+			static_cast<T>(std::sin(double(i) * 1.3) + 0.1),
+			static_cast<T>(std::cos(double(i) * 0.7)),
+			static_cast<T>(std::sin(double(i) * 2.9 + 1.0))));
+		glm::detail::tmat4x4<T, glm::defaultp> const Translate = glm::translate(
+			glm::detail::tmat4x4<T, glm::defaultp>(1),
+			glm::detail::tvec3<T, glm::defaultp>(T(i), T(2) - T(i), T(3)));
+		return glm::rotate(Translate, static_cast<T>(double(i) * 0.37), Axis);
+	}
+
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_affine(std::size_t i)
+	{
+		return glm::scale(make_rigid<T>(i), glm::detail::tvec3<T, glm::defaultp>(T(1) + T(i % 3), T(0.5), T(2)));
+	}
+
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_projective(std::size_t i)
+	{
+		glm::detail::tmat4x4<T, glm::defaultp> Result = make_affine<T>(i);
+		Result[0][3] = T(0.25);
+		Result[2][3] = T(-0.5) + T(i % 2);
+		return Result;
+	}
+
+	template <typename T>
+	bool mat_equal(glm::detail::tmat4x4<T, glm::defaultp> const & a, glm::detail::tmat4x4<T, glm::defaultp> const & b, T Epsilon)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+				return false;
+		return true;
+	}
+}//namespace
+
+template <typename T>
+int test_affineInverse()
+{
+	typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+	typedef glm::detail::tmat3x3<T, glm::defaultp> mat3Type;
+
+	int Error(0);
+
+	for(std::size_t i = 0; i < 16; ++i)
+	{
+		mat4Type const Rigid = make_rigid<T>(i);
+		mat4Type const Affine = make_affine<T>(i);
+
+		Error += mat_equal(glm::rigidInverse(Rigid), glm::inverse(Rigid), T(1e-4)) ? 0 : 1;
+		Error += mat_equal(glm::affineInverse(Rigid), glm::inverse(Rigid), T(1e-4)) ? 0 : 1;
+		Error += mat_equal(glm::affineInverse(Affine), glm::inverse(Affine), T(1e-4)) ? 0 : 1;
+	}
+
+	{
+		mat3Type const Affine(T(2), T(1), T(0), T(-1), T(3), T(0), T(4), T(5), T(1));
+		mat3Type const Inverse = glm::affineInverse(Affine);
+		mat3Type const Identity = Inverse * Affine;
+		for(glm::length_t i = 0; i < 3; ++i)
+			Error += glm::all(glm::epsilonEqual(Identity[i], mat3Type(1)[i], T(1e-5))) ? 0 : 1;
+
+		T const c = std::cos(T(0.5)), s = std::sin(T(0.5));
+		mat3Type const Rigid(c, s, T(0), -s, c, T(0), T(4), T(5), T(1));
+		mat3Type const Identity2 = glm::rigidInverse(Rigid) * Rigid;
+		for(glm::length_t i = 0; i < 3; ++i)
+			Error += glm::all(glm::epsilonEqual(Identity2[i], mat3Type(1)[i], T(1e-5))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_inverse_array()
+{
+	typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+
+	int Error(0);
+
+	// Cover the tails of the blocks
+	for(std::size_t Count = 0; Count < 21; ++Count)
+	{
+		// Automatic storage, std::vector doesn't align dmat4 to 32 bytes with AVX
+		mat4Type Rigid[21], Affine[21], Mixed[21];
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Rigid[i] = make_rigid<T>(i);
+			Affine[i] = make_affine<T>(i);
+			Mixed[i] = i % 5 == 3 ? make_projective<T>(i) : make_affine<T>(i);
+		}
+
+		mat4Type OutRigid[22], OutAffine[22], OutMixed[22];
+		OutRigid[Count] = OutAffine[Count] = OutMixed[Count] = mat4Type(42);
+		glm::rigidInverse(&Rigid[0], &OutRigid[0], Count);
+		glm::affineInverse(&Affine[0], &OutAffine[0], Count);
+		glm::inverse(&Mixed[0], &OutMixed[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += mat_equal(OutRigid[i], glm::inverse(Rigid[i]), T(1e-4)) ? 0 : 1;
+			Error += mat_equal(OutAffine[i], glm::inverse(Affine[i]), T(1e-4)) ? 0 : 1;
+			Error += mat_equal(OutMixed[i], glm::inverse(Mixed[i]), T(1e-4)) ? 0 : 1;
+		}
+		Error += OutRigid[Count] == mat4Type(42) ? 0 : 1;
+		Error += OutAffine[Count] == mat4Type(42) ? 0 : 1;
+		Error += OutMixed[Count] == mat4Type(42) ? 0 : 1;
+	}
+
+	// The output may alias the input
+	{
+		std::size_t const Count(13);
+		mat4Type M[Count], Expected[Count];
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			M[i] = make_projective<T>(i);
+			Expected[i] = glm::inverse(M[i]);
+		}
+		glm::inverse(&M[0], &M[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += mat_equal(M[i], Expected[i], T(1e-4)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_inverse_array()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 18);
+
+	std::vector<glm::mat4> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = make_affine<float>(i % 64);
+
+	std::clock_t const TimeLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::inverse(In[i]);
+	std::clock_t const TimeLoopEnd = std::clock();
+
+	std::clock_t const TimeGeneralStart = std::clock();
+	glm::inverse(&In[0], &Out[0], Count);
+	std::clock_t const TimeGeneralEnd = std::clock();
+
+	std::clock_t const TimeAffineStart = std::clock();
+	glm::affineInverse(&In[0], &Out[0], Count);
+	std::clock_t const TimeAffineEnd = std::clock();
+
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = make_rigid<float>(i % 64);
+
+	std::clock_t const TimeRigidStart = std::clock();
+	glm::rigidInverse(&In[0], &Out[0], Count);
+	std::clock_t const TimeRigidEnd = std::clock();
+
+	Error += mat_equal(Out[Count - 1] * In[Count - 1], glm::mat4(1), 0.001f) ? 0 : 1;
+
+	printf("inverse loop: %ld clocks\n", static_cast<long>(TimeLoopEnd - TimeLoopStart));
+	printf("inverse array: %ld clocks\n", static_cast<long>(TimeGeneralEnd - TimeGeneralStart));
+	printf("affineInverse array: %ld clocks\n", static_cast<long>(TimeAffineEnd - TimeAffineStart));
+	printf("rigidInverse array: %ld clocks\n", static_cast<long>(TimeRigidEnd - TimeRigidStart));
+
+	return Error;
+}
 
 int main()
 {
-	int Error = 0;
+	int Error(0);
+
+	Error += test_affineInverse<float>();
+	Error += test_affineInverse<double>();
+	Error += test_inverse_array<float>();
+	Error += test_inverse_array<double>();
+	Error += perf_inverse_array();
 
 	return Error;
 }
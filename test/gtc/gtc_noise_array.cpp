@@ -0,0 +1,198 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtc/gtc_noise_array.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/noise.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	struct perlin
+	{
+		template <typename genType>
+		static typename genType::value_type call(genType const & Position){return glm::perlin(Position);}
+		template <typename vecType>
+		static void call(typename vecType::value_type * Out, vecType const * Positions, std::size_t Count){glm::perlin(Out, Positions, Count);}
+		template <typename vecType, typename ivecType>
+		static void call(typename vecType::value_type * Out, vecType const & Origin, vecType const & Step, ivecType const & Dims){glm::perlin(Out, Origin, Step, Dims);}
+	};
+
+	struct simplex
+	{
+		template <typename genType>
+		static typename genType::value_type call(genType const & Position){return glm::simplex(Position);}
+		template <typename vecType>
+		static void call(typename vecType::value_type * Out, vecType const * Positions, std::size_t Count){glm::simplex(Out, Positions, Count);}
+		template <typename vecType, typename ivecType>
+		static void call(typename vecType::value_type * Out, vecType const & Origin, vecType const & Step, ivecType const & Dims){glm::simplex(Out, Origin, Step, Dims);}
+	};
+
+	template <typename T>
+	T makeCoord(std::size_t i, std::size_t c)
+	{
+		return static_cast<T>(i) * static_cast<T>(0.37 + 0.11 * c) - static_cast<T>(20.0 - 3.0 * c);
+	}
+}//namespace
+
+template <typename noise, typename vecType>
+int test_noise_points()
+{
+	typedef typename vecType::value_type T;
+	int Error = 0;
+
+	// Cover every tail length of the 4 and 8 wide loops
+	for(std::size_t Count = 0; Count < 37; ++Count)
+	{
+		std::vector<vecType> Positions(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < Positions[i].length(); ++c)
+			Positions[i][c] = makeCoord<T>(i, c);
+
+		std::vector<T> Out(Count + 1, T(42));
+		noise::call(Count ? &Out[0] : 0, Count ? &Positions[0] : 0, Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::epsilonEqual(Out[i], noise::call(Positions[i]), T(0.0001)) ? 0 : 1;
+		Error += Out[Count] == T(42) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename noise, typename vecType, typename ivecType>
+int test_noise_grid(ivecType const & Dims)
+{
+	typedef typename vecType::value_type T;
+	int Error = 0;
+
+	std::size_t Size = 1;
+	for(glm::length_t c = 0; c < Dims.length(); ++c)
+		Size *= static_cast<std::size_t>(Dims[c]);
+
+	vecType const Origin(T(-3.1));
+	vecType Step;
+	for(glm::length_t c = 0; c < Step.length(); ++c)
+		Step[c] = T(0.13) + T(0.05) * static_cast<T>(c);
+
+	std::vector<T> Out(Size + 1, T(42));
+	noise::call(&Out[0], Origin, Step, Dims);
+
+	for(std::size_t i = 0; i < Size; ++i)
+	{
+		vecType Position;
+		std::size_t Index = i;
+		for(glm::length_t c = 0; c < Dims.length(); ++c)
+		{
+			Position[c] = Origin[c] + Step[c] * static_cast<T>(Index % static_cast<std::size_t>(Dims[c]));
+			Index /= static_cast<std::size_t>(Dims[c]);
+		}
+		Error += glm::epsilonEqual(Out[i], noise::call(Position), T(0.0001)) ? 0 : 1;
+	}
+	Error += Out[Size] == T(42) ? 0 : 1;
+
+	return Error;
+}
+
+int test_noise_array()
+{
+	int Error = 0;
+
+	Error += test_noise_points<perlin, glm::vec2>();
+	Error += test_noise_points<perlin, glm::vec3>();
+	Error += test_noise_points<perlin, glm::vec4>();
+	Error += test_noise_points<perlin, glm::dvec3>();
+	Error += test_noise_points<simplex, glm::vec2>();
+	Error += test_noise_points<simplex, glm::vec3>();
+	Error += test_noise_points<simplex, glm::vec4>();
+	Error += test_noise_points<simplex, glm::dvec2>();
+
+	Error += test_noise_grid<perlin, glm::vec2>(glm::ivec2(19, 7));
+	Error += test_noise_grid<perlin, glm::vec3>(glm::ivec3(13, 5, 3));
+	Error += test_noise_grid<perlin, glm::vec4>(glm::ivec4(3, 2, 4, 2));
+	Error += test_noise_grid<simplex, glm::vec2>(glm::ivec2(16, 9));
+	Error += test_noise_grid<simplex, glm::vec3>(glm::ivec3(11, 4, 6));
+	Error += test_noise_grid<simplex, glm::dvec3>(glm::ivec3(5, 3, 2));
+
+	// Empty grid
+	{
+		float Out = 42.0f;
+		glm::simplex(&Out, glm::vec2(0.0f), glm::vec2(1.0f), glm::ivec2(0, 4));
+		Error += Out == 42.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename noise, typename vecType, typename ivecType>
+int perf_noise(char const * Name, ivecType const & Dims)
+{
+	typedef typename vecType::value_type T;
+	int Error = 0;
+
+	std::size_t Size = 1;
+	for(glm::length_t c = 0; c < Dims.length(); ++c)
+		Size *= static_cast<std::size_t>(Dims[c]);
+
+	vecType const Origin(T(0.5));
+	vecType const Step(T(1.0 / 32.0));
+
+	std::vector<vecType> Positions(Size);
+	for(std::size_t i = 0; i < Size; ++i)
+	{
+		std::size_t Index = i;
+		for(glm::length_t c = 0; c < Dims.length(); ++c)
+		{
+			Positions[i][c] = Origin[c] + Step[c] * static_cast<T>(Index % static_cast<std::size_t>(Dims[c]));
+			Index /= static_cast<std::size_t>(Dims[c]);
+		}
+	}
+
+	std::vector<T> Scalar(Size), Points(Size), Grid(Size);
+
+	std::clock_t TimeScalarStart = std::clock();
+	for(std::size_t i = 0; i < Size; ++i)
+		Scalar[i] = noise::call(Positions[i]);
+	std::clock_t TimeScalarEnd = std::clock();
+
+	std::clock_t TimePointsStart = std::clock();
+	noise::call(&Points[0], &Positions[0], Size);
+	std::clock_t TimePointsEnd = std::clock();
+
+	std::clock_t TimeGridStart = std::clock();
+	noise::call(&Grid[0], Origin, Step, Dims);
+	std::clock_t TimeGridEnd = std::clock();
+
+	for(std::size_t i = 0; i < Size; i += 97)
+	{
+		Error += glm::epsilonEqual(Scalar[i], Points[i], T(0.0001)) ? 0 : 1;
+		Error += glm::epsilonEqual(Scalar[i], Grid[i], T(0.0001)) ? 0 : 1;
+	}
+
+	double const Scale = 1e9 / double(CLOCKS_PER_SEC) / double(Size);
+	printf("%s scalar: %f ns/sample\n", Name, double(TimeScalarEnd - TimeScalarStart) * Scale);
+	printf("%s points: %f ns/sample\n", Name, double(TimePointsEnd - TimePointsStart) * Scale);
+	printf("%s grid: %f ns/sample\n", Name, double(TimeGridEnd - TimeGridStart) * Scale);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_noise_array();
+	Error += perf_noise<perlin, glm::vec2>("perlin vec2", glm::ivec2(1024, 1024));
+	Error += perf_noise<perlin, glm::vec3>("perlin vec3", glm::ivec3(128, 128, 64));
+	Error += perf_noise<simplex, glm::vec2>("simplex vec2", glm::ivec2(1024, 1024));
+	Error += perf_noise<simplex, glm::vec3>("simplex vec3", glm::ivec3(128, 128, 64));
+
+	return Error;
+}
@@ -28,6 +28,9 @@
 
 #include <glm/gtc/packing.hpp>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
 #include <vector>
 
 void print_bits(float const & s)
@@ -250,6 +253,380 @@ int test_F2x11_1x10()
 	return Error;
 }
 
+namespace
+{
+	glm::uint32 floatBits(float f)
+	{
+		glm::uint32 Bits;
+		std::memcpy(&Bits, &f, sizeof(Bits));
+		return Bits;
+	}
+
+	float bitsFloat(glm::uint32 Bits)
+	{
+		float f;
+		std::memcpy(&f, &Bits, sizeof(f));
+		return f;
+	}
+}//namespace
+
+int test_Half_array()
+{
+	int Error = 0;
+
+	// Every half value, unpacked from every offset to cover the tails
+	{
+		std::vector<glm::uint16> Halves(65536 + 8);
+		for(std::size_t i = 0; i < Halves.size(); ++i)
+			Halves[i] = static_cast<glm::uint16>(i);
+
+		for(std::size_t Offset = 0; Offset < 8; ++Offset)
+		{
+			std::vector<float> Out(65536 + 1, 42.0f);
+			glm::unpackHalf(&Halves[Offset], &Out[0], 65536);
+			for(std::size_t i = 0; i < 65536; ++i)
+				Error += floatBits(Out[i]) == floatBits(glm::unpackHalf1x16(Halves[Offset + i])) ? 0 : 1;
+			Error += Out[65536] == 42.0f ? 0 : 1;
+		}
+	}
+
+	// Rounding ties, denormals, overflows, infinities and NaNs
+	std::vector<float> Floats;
+	for(glm::uint32 Half = 0; Half < 0x7c00; ++Half)
+	{
+		glm::uint32 const Exponent = Half >> 10;
+		if(Exponent == 0)
+			Floats.push_back((static_cast<float>(Half) + 0.5f) * 5.9604644775390625e-8f);
+		else
+			Floats.push_back(bitsFloat(((Half + ((127 - 15) << 10)) << 13) | 0x1000));
+		Floats.push_back(glm::unpackHalf1x16(static_cast<glm::uint16>(Half)));
+	}
+	glm::uint32 const Specials[] = {
+		0x00000000, 0x00000001, 0x007fffff, 0x00800000, 0x33000000, 0x33000001, 0x32ffffff,
+		0x387fffff, 0x38800000, 0x477fe000, 0x477fefff, 0x477ff000, 0x47800000, 0x7f7fffff,
+		0x7f800000, 0x7f800001, 0x7f802000, 0x7fc00000, 0x7fffffff};
+	for(std::size_t i = 0; i < sizeof(Specials) / sizeof(Specials[0]); ++i)
+		Floats.push_back(bitsFloat(Specials[i]));
+	for(glm::uint64 Bits = 0; Bits < 0x100000000ull; Bits += 4099)
+		Floats.push_back(bitsFloat(static_cast<glm::uint32>(Bits)));
+
+	std::size_t const Count = Floats.size();
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats.push_back(-Floats[i]);
+
+	for(std::size_t Offset = 0; Offset < 8; Offset += 3)
+	{
+		std::size_t const Size = Floats.size() - Offset;
+		std::vector<glm::uint16> Out(Size + 1, 42);
+		glm::packHalf(&Floats[Offset], &Out[0], Size);
+		for(std::size_t i = 0; i < Size; ++i)
+			Error += Out[i] == glm::packHalf1x16(Floats[Offset + i]) ? 0 : 1;
+		Error += Out[Size] == 42 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_Half_array()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1 << 22;
+	std::vector<float> Floats(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats[i] = static_cast<float>(i) * 0.001f - 2000.0f;
+	std::vector<glm::uint16> Halves(Count);
+
+	std::clock_t TimePackScalarStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Halves[i] = glm::packHalf1x16(Floats[i]);
+	std::clock_t TimePackScalarEnd = std::clock();
+
+	glm::uint16 const Check = Halves[Count - 1];
+
+	std::clock_t TimePackArrayStart = std::clock();
+	glm::packHalf(&Floats[0], &Halves[0], Count);
+	std::clock_t TimePackArrayEnd = std::clock();
+
+	Error += Check == Halves[Count - 1] ? 0 : 1;
+
+	std::clock_t TimeUnpackScalarStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats[i] = glm::unpackHalf1x16(Halves[i]);
+	std::clock_t TimeUnpackScalarEnd = std::clock();
+
+	std::clock_t TimeUnpackArrayStart = std::clock();
+	glm::unpackHalf(&Halves[0], &Floats[0], Count);
+	std::clock_t TimeUnpackArrayEnd = std::clock();
+
+	printf("packHalf1x16 loop: %ld clocks\n", static_cast<long>(TimePackScalarEnd - TimePackScalarStart));
+	printf("packHalf array: %ld clocks\n", static_cast<long>(TimePackArrayEnd - TimePackArrayStart));
+	printf("unpackHalf1x16 loop: %ld clocks\n", static_cast<long>(TimeUnpackScalarEnd - TimeUnpackScalarStart));
+	printf("unpackHalf array: %ld clocks\n", static_cast<long>(TimeUnpackArrayEnd - TimeUnpackArrayStart));
+
+	return Error;
+}
+
+int test_unpack_range()
+{
+	int Error = 0;
+
+	Error += glm::unpackSnorm1x8(glm::packSnorm1x8(-1.0f)) == -1.0f ? 0 : 1;
+	Error += glm::unpackSnorm1x16(glm::packSnorm1x16(-1.0f)) == -1.0f ? 0 : 1;
+	Error += glm::all(glm::equal(glm::unpackUnorm3x10_1x2(glm::packUnorm3x10_1x2(glm::vec4(1.0f))), glm::vec4(1.0f))) ? 0 : 1;
+
+	float const Infinity = std::numeric_limits<float>::infinity();
+	glm::vec3 const Special = glm::unpackF2x11_1x10(glm::packF2x11_1x10(glm::vec3(Infinity, std::numeric_limits<float>::quiet_NaN(), Infinity)));
+	Error += Special.x == Infinity ? 0 : 1;
+	Error += Special.y != Special.y ? 0 : 1;
+	Error += Special.z == Infinity ? 0 : 1;
+
+	return Error;
+}
+
+namespace
+{
+	// Single element and stream functions of a packing format
+#	define GLM_PACKING_FORMAT(vecType, packType, Name) \
+	struct format##Name \
+	{ \
+		typedef vecType vec_type; \
+		typedef packType pack_type; \
+		static char const * name(){return #Name;} \
+		static packType pack(vecType const & v){return glm::pack##Name(v);} \
+		static vecType unpack(packType p){return glm::unpack##Name(p);} \
+		static void pack(vecType const * In, std::size_t InStride, packType * Out, std::size_t OutStride, std::size_t Count){glm::pack##Name(In, InStride, Out, OutStride, Count);} \
+		static void unpack(packType const * In, std::size_t InStride, vecType * Out, std::size_t OutStride, std::size_t Count){glm::unpack##Name(In, InStride, Out, OutStride, Count);} \
+	};
+
+	GLM_PACKING_FORMAT(float, glm::uint8, Unorm1x8)
+	GLM_PACKING_FORMAT(float, glm::uint8, Snorm1x8)
+	GLM_PACKING_FORMAT(glm::vec2, glm::uint16, Unorm2x8)
+	GLM_PACKING_FORMAT(glm::vec2, glm::uint16, Snorm2x8)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint32, Unorm4x8)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint32, Snorm4x8)
+	GLM_PACKING_FORMAT(float, glm::uint16, Unorm1x16)
+	GLM_PACKING_FORMAT(float, glm::uint16, Snorm1x16)
+	GLM_PACKING_FORMAT(glm::vec2, glm::uint32, Unorm2x16)
+	GLM_PACKING_FORMAT(glm::vec2, glm::uint32, Snorm2x16)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint64, Unorm4x16)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint64, Snorm4x16)
+	GLM_PACKING_FORMAT(float, glm::uint16, Half1x16)
+	GLM_PACKING_FORMAT(glm::vec2, glm::uint32, Half2x16)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint64, Half4x16)
+	GLM_PACKING_FORMAT(glm::ivec4, glm::uint32, I3x10_1x2)
+	GLM_PACKING_FORMAT(glm::uvec4, glm::uint32, U3x10_1x2)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint32, Snorm3x10_1x2)
+	GLM_PACKING_FORMAT(glm::vec4, glm::uint32, Unorm3x10_1x2)
+	GLM_PACKING_FORMAT(glm::vec3, glm::uint32, F2x11_1x10)
+
+#	undef GLM_PACKING_FORMAT
+
+	glm::uint32 random(glm::uint32 & Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed;
+	}
+
+	// Ties, out of range values, infinities and denormals but no NaN
+	float randomFloat(glm::uint32 & Seed)
+	{
+		glm::uint32 const Bits = random(Seed);
+		switch(Bits & 3)
+		{
+		case 0:
+			return static_cast<float>(static_cast<int>(Bits >> 8) % 8192) / 2048.0f - 2.0f;
+		case 1:
+			return static_cast<float>(static_cast<int>(Bits >> 8) % 2048 - 1024) / 1023.0f;
+		case 2:
+			return static_cast<float>(static_cast<int>(Bits >> 8) % 131072 - 65536) / 65535.0f;
+		default:
+			return (Bits & 0x7f800000) == 0x7f800000 ? bitsFloat(Bits & 0xff800000) : bitsFloat(Bits);
+		}
+	}
+
+	void randomValue(glm::uint32 & Seed, float & Value)
+	{
+		Value = randomFloat(Seed);
+	}
+
+	template <typename T, glm::precision P, template <typename, glm::precision> class vecType>
+	void randomValue(glm::uint32 & Seed, vecType<T, P> & Value)
+	{
+		for(glm::length_t i = 0; i < Value.length(); ++i)
+			Value[i] = randomFloat(Seed);
+	}
+
+	void randomValue(glm::uint32 & Seed, glm::ivec4 & Value)
+	{
+		for(glm::length_t i = 0; i < Value.length(); ++i)
+			Value[i] = static_cast<int>(random(Seed) >> 20) - 2048;
+	}
+
+	void randomValue(glm::uint32 & Seed, glm::uvec4 & Value)
+	{
+		for(glm::length_t i = 0; i < Value.length(); ++i)
+			Value[i] = random(Seed) >> 20;
+	}
+
+	template <typename packType>
+	void randomPack(glm::uint32 & Seed, packType & Value)
+	{
+		glm::uint64 const High = random(Seed);
+		Value = static_cast<packType>((High << 32) | random(Seed));
+	}
+}//namespace
+
+template <typename format>
+int test_stream()
+{
+	typedef typename format::vec_type vec_type;
+	typedef typename format::pack_type pack_type;
+
+	int Error = 0;
+	glm::uint32 Seed = 1;
+
+	// Cover every tail length and interleaved unaligned buffers
+	for(std::size_t Count = 0; Count < 1024; Count = Count < 40 ? Count + 1 : Count * 3)
+	{
+		std::vector<vec_type> Values(Count + 1);
+		std::vector<pack_type> Packs(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			randomValue(Seed, Values[i]);
+			randomPack(Seed, Packs[i]);
+		}
+
+		std::vector<pack_type> Packed(Count + 1, pack_type(42));
+		format::pack(&Values[0], 0, &Packed[0], 0, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Packed[i] == format::pack(Values[i]) ? 0 : 1;
+		Error += Packed[Count] == pack_type(42) ? 0 : 1;
+
+		std::vector<vec_type> Unpacked(Count + 1);
+		format::unpack(&Packs[0], 0, &Unpacked[0], 0, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec_type const Expected = format::unpack(Packs[i]);
+			Error += std::memcmp(&Unpacked[i], &Expected, sizeof(vec_type)) == 0 ? 0 : 1;
+		}
+
+		std::size_t const VecStride = sizeof(vec_type) + 3;
+		std::size_t const PackStride = sizeof(pack_type) + 5;
+		std::vector<char> VecBuffer(1 + Count * VecStride, 0x5a);
+		std::vector<char> PackBuffer(1 + Count * PackStride, 0x5a);
+		for(std::size_t i = 0; i < Count; ++i)
+			std::memcpy(&VecBuffer[1 + i * VecStride], &Values[i], sizeof(vec_type));
+
+		format::pack(reinterpret_cast<vec_type const *>(&VecBuffer[1]), VecStride, reinterpret_cast<pack_type *>(&PackBuffer[1]), PackStride, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			pack_type const Expected = format::pack(Values[i]);
+			Error += std::memcmp(&PackBuffer[1 + i * PackStride], &Expected, sizeof(pack_type)) == 0 ? 0 : 1;
+			for(std::size_t j = sizeof(pack_type); j < PackStride; ++j)
+				Error += PackBuffer[1 + i * PackStride + j] == 0x5a ? 0 : 1;
+		}
+		Error += PackBuffer[0] == 0x5a ? 0 : 1;
+
+		for(std::size_t i = 0; i < Count; ++i)
+			std::memcpy(&PackBuffer[1 + i * PackStride], &Packs[i], sizeof(pack_type));
+		format::unpack(reinterpret_cast<pack_type const *>(&PackBuffer[1]), PackStride, reinterpret_cast<vec_type *>(&VecBuffer[1]), VecStride, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec_type const Expected = format::unpack(Packs[i]);
+			Error += std::memcmp(&VecBuffer[1 + i * VecStride], &Expected, sizeof(vec_type)) == 0 ? 0 : 1;
+			for(std::size_t j = sizeof(vec_type); j < VecStride; ++j)
+				Error += VecBuffer[1 + i * VecStride + j] == 0x5a ? 0 : 1;
+		}
+		Error += VecBuffer[0] == 0x5a ? 0 : 1;
+	}
+
+	if(Error)
+		printf("%s stream: %d errors\n", format::name(), Error);
+
+	return Error;
+}
+
+int test_F2x11_1x10_stream()
+{
+	int Error = 0;
+
+	float const Infinity = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	glm::vec3 const Values[] = {
+		glm::vec3(0.0f, -0.0f, Infinity), glm::vec3(-Infinity, NaN, -NaN),
+		glm::vec3(1e-30f, 65000.0f, 1e30f), glm::vec3(bitsFloat(0x7f800001), 1.0f, 0.5f)};
+	glm::uint32 Packed[4];
+	glm::packF2x11_1x10(Values, 0, Packed, 0, 4);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += Packed[i] == glm::packF2x11_1x10(Values[i]) ? 0 : 1;
+
+	glm::uint32 const Packs[] = {0x00000000, 0x000007ff, 0x003ff800, 0xffc00000, 0x000007c0, 0x003e0000, 0xf8000000, 0x12345678};
+	glm::vec3 Unpacked[8];
+	glm::unpackF2x11_1x10(Packs, 0, Unpacked, 0, 8);
+	for(std::size_t i = 0; i < 8; ++i)
+	{
+		glm::vec3 const Expected = glm::unpackF2x11_1x10(Packs[i]);
+		Error += std::memcmp(&Unpacked[i], &Expected, sizeof(glm::vec3)) == 0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename format>
+int perf_stream()
+{
+	typedef typename format::vec_type vec_type;
+	typedef typename format::pack_type pack_type;
+
+	int Error = 0;
+
+	std::size_t const Count = 1 << 20;
+	std::size_t const Iterations = 8;
+	std::vector<vec_type> Values(Count);
+	std::vector<pack_type> Packs(Count);
+	glm::uint32 Seed = 1;
+	for(std::size_t i = 0; i < Count; ++i)
+		randomValue(Seed, Values[i]);
+
+	std::clock_t TimePackLoopStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Packs[i] = format::pack(Values[i]);
+	std::clock_t TimePackLoopEnd = std::clock();
+
+	pack_type const Check = Packs[Count - 1];
+
+	std::clock_t TimePackStreamStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		format::pack(&Values[0], 0, &Packs[0], 0, Count);
+	std::clock_t TimePackStreamEnd = std::clock();
+
+	Error += Check == Packs[Count - 1] ? 0 : 1;
+
+	std::clock_t TimeUnpackLoopStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = format::unpack(Packs[i]);
+	std::clock_t TimeUnpackLoopEnd = std::clock();
+
+	std::clock_t TimeUnpackStreamStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		format::unpack(&Packs[0], 0, &Values[0], 0, Count);
+	std::clock_t TimeUnpackStreamEnd = std::clock();
+
+	// Throughput of the unpacked data
+	double const Bytes = static_cast<double>(Count * Iterations * sizeof(vec_type)) * CLOCKS_PER_SEC / (1024.0 * 1024.0);
+	printf("%-14s pack: %7.0f MB/s stream, %7.0f MB/s loop; unpack: %7.0f MB/s stream, %7.0f MB/s loop\n",
+		format::name(),
+		Bytes / static_cast<double>(glm::max<std::clock_t>(TimePackStreamEnd - TimePackStreamStart, 1)),
+		Bytes / static_cast<double>(glm::max<std::clock_t>(TimePackLoopEnd - TimePackLoopStart, 1)),
+		Bytes / static_cast<double>(glm::max<std::clock_t>(TimeUnpackStreamEnd - TimeUnpackStreamStart, 1)),
+		Bytes / static_cast<double>(glm::max<std::clock_t>(TimeUnpackLoopEnd - TimeUnpackLoopStart, 1)));
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
@@ -261,6 +638,50 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_U3x10_1x2();
+	Error += test_Half_array();
+	Error += test_unpack_range();
+	Error += test_stream<formatUnorm1x8>();
+	Error += test_stream<formatSnorm1x8>();
+	Error += test_stream<formatUnorm2x8>();
+	Error += test_stream<formatSnorm2x8>();
+	Error += test_stream<formatUnorm4x8>();
+	Error += test_stream<formatSnorm4x8>();
+	Error += test_stream<formatUnorm1x16>();
+	Error += test_stream<formatSnorm1x16>();
+	Error += test_stream<formatUnorm2x16>();
+	Error += test_stream<formatSnorm2x16>();
+	Error += test_stream<formatUnorm4x16>();
+	Error += test_stream<formatSnorm4x16>();
+	Error += test_stream<formatHalf1x16>();
+	Error += test_stream<formatHalf2x16>();
+	Error += test_stream<formatHalf4x16>();
+	Error += test_stream<formatI3x10_1x2>();
+	Error += test_stream<formatU3x10_1x2>();
+	Error += test_stream<formatSnorm3x10_1x2>();
+	Error += test_stream<formatUnorm3x10_1x2>();
+	Error += test_stream<formatF2x11_1x10>();
+	Error += test_F2x11_1x10_stream();
+	Error += perf_Half_array();
+	Error += perf_stream<formatUnorm1x8>();
+	Error += perf_stream<formatSnorm1x8>();
+	Error += perf_stream<formatUnorm2x8>();
+	Error += perf_stream<formatSnorm2x8>();
+	Error += perf_stream<formatUnorm4x8>();
+	Error += perf_stream<formatSnorm4x8>();
+	Error += perf_stream<formatUnorm1x16>();
+	Error += perf_stream<formatSnorm1x16>();
+	Error += perf_stream<formatUnorm2x16>();
+	Error += perf_stream<formatSnorm2x16>();
+	Error += perf_stream<formatUnorm4x16>();
+	Error += perf_stream<formatSnorm4x16>();
+	Error += perf_stream<formatHalf1x16>();
+	Error += perf_stream<formatHalf2x16>();
+	Error += perf_stream<formatHalf4x16>();
+	Error += perf_stream<formatI3x10_1x2>();
+	Error += perf_stream<formatU3x10_1x2>();
+	Error += perf_stream<formatSnorm3x10_1x2>();
+	Error += perf_stream<formatUnorm3x10_1x2>();
+	Error += perf_stream<formatF2x11_1x10>();
 
 	return Error;
 }
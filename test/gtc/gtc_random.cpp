@@ -10,9 +10,17 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 #	include <array>
 #endif
+#if(GLM_HAS_THREAD_LOCAL)
+#	include <thread>
+#	include <chrono>
+#	include <random>
+#endif
 
 int test_linearRand()
 {
@@ -35,6 +43,30 @@ int test_linearRand()
 	return Error;
 }
 
+int test_gaussRand()
+{
+	int Error = 0;
+
+	// Deviation is the standard deviation, like the array versions of GTX_random_array
+	{
+		glm::pcg32 Engine(7);
+		std::size_t const Count = 100000;
+		double Sum = 0.0, SumSquare = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const Value = glm::gaussRand(3.0, 2.0, Engine);
+			Sum += Value;
+			SumSquare += Value * Value;
+		}
+		double const Mean = Sum / double(Count);
+		double const Variance = SumSquare / double(Count) - Mean * Mean;
+		Error += glm::epsilonEqual(Mean, 3.0, 0.05) ? 0 : 1;
+		Error += glm::epsilonEqual(Variance, 4.0, 0.1) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int test_circularRand()
 {
 	int Error = 0;
@@ -137,6 +169,185 @@ int test_ballRand()
 
 	return Error;
 }
+int test_engine()
+{
+	int Error = 0;
+
+	// Reference sequence of pcg32_srandom_r(42, 54)
+	{
+		glm::uint32 const Expected[] = {0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e};
+
+		glm::pcg32 Engine(42, 54);
+		for(std::size_t i = 0; i < sizeof(Expected) / sizeof(Expected[0]); ++i)
+			Error += Engine() == Expected[i] ? 0 : 1;
+	}
+
+	// Same seed, same sequence. Different seeds or streams, different sequences.
+	{
+		glm::xoshiro128plus A(7), B(7), C(8);
+		glm::pcg32 D(7, 0), E(7, 1);
+		int Same = 0;
+		for(std::size_t i = 0; i < 1000; ++i)
+		{
+			glm::uint32 const a = A();
+			Error += a == B() ? 0 : 1;
+			Same += a == C() ? 1 : 0;
+			Same += D() == E() ? 1 : 0;
+		}
+		Error += Same < 4 ? 0 : 1;
+
+		A.seed(7);
+		glm::xoshiro128plus F(7);
+		Error += A() == F() ? 0 : 1;
+	}
+
+	// All the bits are used and linearRand covers the whole interval
+	{
+		glm::xoshiro128plus Engine(1);
+		glm::uint32 Or = 0, And = 0xFFFFFFFF;
+		float MinFloat = 1.0f, MaxFloat = 0.0f;
+		double MinDouble = 1.0, MaxDouble = 0.0;
+		for(std::size_t i = 0; i < 100000; ++i)
+		{
+			glm::uint32 const Bits = Engine();
+			Or |= Bits;
+			And &= Bits;
+
+			float const f = glm::linearRand(0.0f, 1.0f, Engine);
+			double const d = glm::linearRand(0.0, 1.0, Engine);
+			MinFloat = glm::min(MinFloat, f);
+			MaxFloat = glm::max(MaxFloat, f);
+			MinDouble = glm::min(MinDouble, d);
+			MaxDouble = glm::max(MaxDouble, d);
+		}
+		Error += Or == 0xFFFFFFFF && And == 0 ? 0 : 1;
+		Error += MinFloat >= 0.0f && MinFloat < 0.001f ? 0 : 1;
+		Error += MaxFloat <= 1.0f && MaxFloat > 0.999f ? 0 : 1;
+		Error += MinDouble >= 0.0 && MinDouble < 0.001 ? 0 : 1;
+		Error += MaxDouble <= 1.0 && MaxDouble > 0.999 ? 0 : 1;
+	}
+
+	// Engine overloads reproduce the same values from the same seed
+	{
+		glm::pcg32 A(3), B(3);
+		Error += glm::linearRand(glm::vec4(-1), glm::vec4(1), A) == glm::linearRand(glm::vec4(-1), glm::vec4(1), B) ? 0 : 1;
+		Error += glm::gaussRand(glm::dvec3(0), glm::dvec3(1), A) == glm::gaussRand(glm::dvec3(0), glm::dvec3(1), B) ? 0 : 1;
+		Error += glm::circularRand(2.0f, A) == glm::circularRand(2.0f, B) ? 0 : 1;
+		Error += glm::sphericalRand(2.0f, A) == glm::sphericalRand(2.0f, B) ? 0 : 1;
+		Error += glm::diskRand(2.0, A) == glm::diskRand(2.0, B) ? 0 : 1;
+		Error += glm::ballRand(2.0, A) == glm::ballRand(2.0, B) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::length(glm::sphericalRand(2.0f, A)), 2.0f, 0.0001f) ? 0 : 1;
+		Error += glm::length(glm::ballRand(2.0, A)) <= 2.0 ? 0 : 1;
+	}
+
+	// Reseeding the default engine of the calling thread
+	{
+		glm::defaultRandomEngine().seed(11);
+		float const A = glm::linearRand(0.0f, 1.0f);
+		glm::defaultRandomEngine().seed(11);
+		float const B = glm::linearRand(0.0f, 1.0f);
+		Error += A == B ? 0 : 1;
+	}
+
+#	if(GLM_HAS_THREAD_LOCAL)
+		// Usable with the C++11 distributions
+		{
+			glm::xoshiro128plus Engine(5);
+			std::uniform_int_distribution<int> Distribution(0, 9);
+			int const Value = Distribution(Engine);
+			Error += Value >= 0 && Value <= 9 ? 0 : 1;
+		}
+
+		// Each thread has its own engine
+		{
+			glm::uint32 const Main = glm::defaultRandomEngine()();
+			glm::uint32 Other = Main;
+			std::thread Thread([&Other]()
+			{
+				glm::defaultRandomEngine().seed(11);
+				Other = glm::defaultRandomEngine()();
+			});
+			Thread.join();
+
+			glm::defaultRandomEngine().seed(11);
+			Error += glm::defaultRandomEngine()() == Other ? 0 : 1;
+			Error += &glm::defaultRandomEngine() == &glm::defaultRandomEngine() ? 0 : 1;
+		}
+#	endif
+
+	return Error;
+}
+
+#if(GLM_HAS_THREAD_LOCAL)
+namespace rand_perf
+{
+	std::size_t const Count = 1 << 22;
+
+	void stdRand(float * Result)
+	{
+		float Sum = 0.0f;
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += float(std::rand()) / float(RAND_MAX);
+		*Result = Sum;
+	}
+
+	void defaultEngine(float * Result)
+	{
+		float Sum = 0.0f;
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += glm::linearRand(0.0f, 1.0f);
+		*Result = Sum;
+	}
+
+	void localEngine(float * Result)
+	{
+		glm::xoshiro128plus Engine(static_cast<glm::uint64>(reinterpret_cast<std::size_t>(Result)));
+		float Sum = 0.0f;
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += glm::linearRand(0.0f, 1.0f, Engine);
+		*Result = Sum;
+	}
+
+	// Each thread draws Count numbers, returns the wall clock time in milliseconds
+	long run(void (*Function)(float*), std::size_t ThreadCount, int & Error)
+	{
+		std::vector<float> Results(ThreadCount, 0.0f);
+		std::vector<std::thread> Threads;
+
+		std::chrono::high_resolution_clock::time_point const Start = std::chrono::high_resolution_clock::now();
+		for(std::size_t i = 0; i < ThreadCount; ++i)
+			Threads.push_back(std::thread(Function, &Results[i]));
+		for(std::size_t i = 0; i < ThreadCount; ++i)
+			Threads[i].join();
+		std::chrono::high_resolution_clock::time_point const End = std::chrono::high_resolution_clock::now();
+
+		// The mean of Count uniform numbers in [0, 1]
+		for(std::size_t i = 0; i < ThreadCount; ++i)
+			Error += glm::abs(Results[i] / float(Count) - 0.5f) < 0.01f ? 0 : 1;
+
+		return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(End - Start).count());
+	}
+}//namespace rand_perf
+
+int perf_threads()
+{
+	int Error = 0;
+
+	std::size_t const MaxThreads = glm::max(std::thread::hardware_concurrency(), 4u);
+	for(std::size_t ThreadCount = 1; ThreadCount <= MaxThreads; ThreadCount *= 2)
+	{
+		long const TimeStdRand = rand_perf::run(rand_perf::stdRand, ThreadCount, Error);
+		long const TimeDefault = rand_perf::run(rand_perf::defaultEngine, ThreadCount, Error);
+		long const TimeLocal = rand_perf::run(rand_perf::localEngine, ThreadCount, Error);
+
+		printf("%d threads, %d numbers per thread: std::rand %ld ms, defaultRandomEngine %ld ms, local engine %ld ms\n",
+			int(ThreadCount), int(rand_perf::Count), TimeStdRand, TimeDefault, TimeLocal);
+	}
+
+	return Error;
+}
+#endif//GLM_HAS_THREAD_LOCAL
+
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -183,10 +394,15 @@ int main()
 	int Error = 0;
 
 	Error += test_linearRand();
+	Error += test_gaussRand();
 	Error += test_circularRand();
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_engine();
+#	if(GLM_HAS_THREAD_LOCAL)
+		Error += perf_threads();
+#	endif
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_affine_matrix.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/affine_matrix.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_transform(std::size_t i)
+	{
+		typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+		vec3Type const Axis = glm::normalize(vec3Type(
+			static_cast<T>(std::sin(double(i) * 1.3) + 0.1),
+			static_cast<T>(std::cos(double(i) * 0.7)),
+			static_cast<T>(std::sin(double(i) * 2.9 + 1.0))));
+		glm::detail::tmat4x4<T, glm::defaultp> Result(1);
+		Result = glm::translate(Result, vec3Type(T(i % 5), T(1), T(-0.5)));
+		Result = glm::rotate(Result, static_cast<T>(double(i) * 0.37), Axis);
+		Result = glm::scale(Result, vec3Type(T(1) + T(i % 3), T(0.5), i % 2 ? T(-2) : T(2)));
+		return Result;
+	}
+
+	template <typename T>
+	bool mat_equal(glm::detail::tmat4x4<T, glm::defaultp> const & a, glm::detail::tmat4x4<T, glm::defaultp> const & b, T Epsilon)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+				return false;
+		return true;
+	}
+}//namespace
+
+template <typename T>
+int test_affine_matrix()
+{
+	typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+	typedef glm::detail::tmat3x4<T, glm::defaultp> mat3x4Type;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+	typedef glm::detail::tvec4<T, glm::defaultp> vec4Type;
+
+	int Error(0);
+
+	Error += sizeof(mat3x4Type) == sizeof(T) * 12 ? 0 : 1;
+
+	for(std::size_t i = 0; i < 16; ++i)
+	{
+		mat4Type const A = make_transform<T>(i);
+		mat4Type const B = make_transform<T>(i * 3 + 1);
+		mat3x4Type const AffineA = glm::mat3x4_cast(A);
+		mat3x4Type const AffineB = glm::mat3x4_cast(B);
+
+		Error += glm::mat4_cast(AffineA) == A ? 0 : 1;
+		Error += mat_equal(glm::mat4_cast(glm::affineCompose(AffineA, AffineB)), A * B, T(1e-4)) ? 0 : 1;
+		Error += mat_equal(glm::mat4_cast(glm::affineInverse(AffineA)), glm::inverse(A), T(1e-4)) ? 0 : 1;
+
+		vec3Type const v(T(1), T(-2), T(0.5) + T(i));
+		Error += glm::all(glm::epsilonEqual(glm::affineTransformPoint(AffineA, v), vec3Type(A * vec4Type(v, 1)), T(1e-4))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(glm::affineTransformVector(AffineA, v), vec3Type(A * vec4Type(v, 0)), T(1e-4))) ? 0 : 1;
+
+		vec3Type const Normal = glm::inverseTranspose(glm::detail::tmat3x3<T, glm::defaultp>(A)) * v;
+		Error += glm::all(glm::epsilonEqual(glm::affineTransformNormal(AffineA, v), Normal, T(1e-4))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_affine_matrix()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 16);
+
+	std::vector<glm::mat4> Matrices(Count), OutMatrices(Count);
+	std::vector<glm::mat3x4> Affines(Count), OutAffines(Count);
+	std::vector<glm::vec3> Points(Count), OutPoints(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Matrices[i] = make_transform<float>(i % 64);
+		Affines[i] = glm::mat3x4_cast(Matrices[i]);
+		Points[i] = glm::vec3(float(i % 7), 1.0f, -2.0f);
+	}
+
+	std::clock_t const TimeMat4ComposeStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutMatrices[i] = Matrices[i] * Matrices[Count - 1 - i];
+	std::clock_t const TimeMat4ComposeEnd = std::clock();
+
+	std::clock_t const TimeAffineComposeStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutAffines[i] = glm::affineCompose(Affines[i], Affines[Count - 1 - i]);
+	std::clock_t const TimeAffineComposeEnd = std::clock();
+
+	Error += mat_equal(glm::mat4_cast(OutAffines[7]), OutMatrices[7], 1e-4f) ? 0 : 1;
+
+	std::clock_t const TimeMat4InverseStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutMatrices[i] = glm::inverse(Matrices[i]);
+	std::clock_t const TimeMat4InverseEnd = std::clock();
+
+	std::clock_t const TimeAffineInverseStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutAffines[i] = glm::affineInverse(Affines[i]);
+	std::clock_t const TimeAffineInverseEnd = std::clock();
+
+	Error += mat_equal(glm::mat4_cast(OutAffines[7]), OutMatrices[7], 1e-4f) ? 0 : 1;
+
+	std::clock_t const TimeMat4TransformStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutPoints[i] = glm::vec3(Matrices[i] * glm::vec4(Points[i], 1.0f));
+	std::clock_t const TimeMat4TransformEnd = std::clock();
+
+	glm::vec3 const Expected = OutPoints[7];
+
+	std::clock_t const TimeAffineTransformStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutPoints[i] = glm::affineTransformPoint(Affines[i], Points[i]);
+	std::clock_t const TimeAffineTransformEnd = std::clock();
+
+	Error += glm::all(glm::epsilonEqual(OutPoints[7], Expected, 1e-4f)) ? 0 : 1;
+
+	printf("mat4 compose: %ld clocks\n", static_cast<long>(TimeMat4ComposeEnd - TimeMat4ComposeStart));
+	printf("affineCompose: %ld clocks\n", static_cast<long>(TimeAffineComposeEnd - TimeAffineComposeStart));
+	printf("mat4 inverse: %ld clocks\n", static_cast<long>(TimeMat4InverseEnd - TimeMat4InverseStart));
+	printf("affineInverse: %ld clocks\n", static_cast<long>(TimeAffineInverseEnd - TimeAffineInverseStart));
+	printf("mat4 transform: %ld clocks\n", static_cast<long>(TimeMat4TransformEnd - TimeMat4TransformStart));
+	printf("affineTransformPoint: %ld clocks\n", static_cast<long>(TimeAffineTransformEnd - TimeAffineTransformStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_affine_matrix<float>();
+	Error += test_affine_matrix<double>();
+	Error += perf_affine_matrix();
+
+	return Error;
+}
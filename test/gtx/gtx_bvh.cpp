@@ -0,0 +1,347 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_bvh.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tvec3<T, glm::defaultp> make_point(std::size_t i, T Scale)
+	{
+		return glm::detail::tvec3<T, glm::defaultp>(
+			static_cast<T>(std::sin(double(i) * 1.37 + 0.3)),
+			static_cast<T>(std::sin(double(i) * 2.11 + 1.1)),
+			static_cast<T>(std::sin(double(i) * 0.73 + 2.7))) * Scale;
+	}
+
+	// Triangles of Size scattered in a box of Extent, both facing and back facing
+	template <typename T>
+	void make_triangle(std::size_t i, T Extent, T Size, glm::detail::tvec3<T, glm::defaultp> & v0, glm::detail::tvec3<T, glm::defaultp> & v1, glm::detail::tvec3<T, glm::defaultp> & v2)
+	{
+		v0 = make_point<T>(i, Extent);
+		v1 = v0 + make_point<T>(i * 3 + 1, Size);
+		v2 = v0 + make_point<T>(i * 5 + 2, Size);
+	}
+
+	template <typename T>
+	void make_ray(std::size_t i, T Extent, glm::detail::tvec3<T, glm::defaultp> & orig, glm::detail::tvec3<T, glm::defaultp> & dir)
+	{
+		orig = make_point<T>(i * 7 + 3, Extent * T(1.2));
+		dir = glm::normalize(make_point<T>(i * 11 + 5, Extent * T(0.9)) - orig);
+	}
+
+	// Every node contains its children or its primitives and every primitive is referenced once
+	template <typename T>
+	int check_bvh(glm::detail::tbvh<T, glm::defaultp> const & Bvh, std::vector<glm::detail::tvec3<T, glm::defaultp> > const & Mins, std::vector<glm::detail::tvec3<T, glm::defaultp> > const & Maxs)
+	{
+		typedef typename glm::detail::tbvh<T, glm::defaultp>::node node;
+
+		int Error(0);
+
+		Error += Bvh.Indices.size() == Mins.size() ? 0 : 1;
+		Error += Mins.empty() == Bvh.Nodes.empty() ? 0 : 1;
+
+		std::vector<int> References(Mins.size(), 0);
+		for(std::size_t n = 0; n < Bvh.Nodes.size(); ++n)
+		{
+			node const & Node = Bvh.Nodes[n];
+			glm::uint32 const Count = Node.Data >> 2;
+			if(Count == 0)
+			{
+				Error += Node.Offset > n + 1 && Node.Offset < Bvh.Nodes.size() && (Node.Data & 3) < 3 ? 0 : 1;
+				if(Node.Offset >= Bvh.Nodes.size())
+					continue;
+
+				node const & Left = Bvh.Nodes[n + 1];
+				node const & Right = Bvh.Nodes[Node.Offset];
+				Error += glm::all(glm::lessThanEqual(Node.Min, glm::min(Left.Min, Right.Min))) ? 0 : 1;
+				Error += glm::all(glm::greaterThanEqual(Node.Max, glm::max(Left.Max, Right.Max))) ? 0 : 1;
+			}
+			else for(glm::uint32 i = Node.Offset; i < Node.Offset + Count; ++i)
+			{
+				Error += i < Bvh.Indices.size() ? 0 : 1;
+				if(i >= Bvh.Indices.size() || Bvh.Indices[i] >= Mins.size())
+					continue;
+
+				++References[Bvh.Indices[i]];
+				Error += glm::all(glm::lessThanEqual(Node.Min, Mins[Bvh.Indices[i]])) ? 0 : 1;
+				Error += glm::all(glm::greaterThanEqual(Node.Max, Maxs[Bvh.Indices[i]])) ? 0 : 1;
+			}
+		}
+
+		for(std::size_t i = 0; i < References.size(); ++i)
+			Error += References[i] == 1 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+template <typename T>
+int test_triangles()
+{
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	std::size_t const Counts[] = {0, 1, 2, 3, 7, 9, 33, 100, 1000, 5000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<vec3Type> Vert0(Count + 1), Vert1(Count + 1), Vert2(Count + 1), Mins(Count), Maxs(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			make_triangle<T>(i, T(20), T(2), Vert0[i], Vert1[i], Vert2[i]);
+			Mins[i] = glm::min(glm::min(Vert0[i], Vert1[i]), Vert2[i]);
+			Maxs[i] = glm::max(glm::max(Vert0[i], Vert1[i]), Vert2[i]);
+		}
+
+		glm::detail::tbvh<T, glm::defaultp> Bvh;
+		Bvh.build(&Vert0[0], &Vert1[0], &Vert2[0], Count);
+		Error += check_bvh(Bvh, Mins, Maxs);
+
+		std::size_t Hits(0);
+		for(std::size_t r = 0; r < 256; ++r)
+		{
+			vec3Type Orig, Dir;
+			make_ray<T>(r, T(20), Orig, Dir);
+
+			vec3Type Expected;
+			std::size_t ExpectedIndex(0);
+			bool const ExpectedHit = glm::intersectRayTriangles(Orig, Dir, &Vert0[0], &Vert1[0], &Vert2[0], Count, Expected, ExpectedIndex);
+
+			vec3Type Bary(T(42));
+			std::size_t Index(Count + 1);
+			bool const Hit = glm::intersectRayTriangles(Bvh, Orig, Dir, &Vert0[0], &Vert1[0], &Vert2[0], Bary, Index);
+			Error += Hit == ExpectedHit ? 0 : 1;
+			if(Hit && ExpectedHit)
+			{
+				// Triangles hit at the same distance may be found in another order
+				Error += Index == ExpectedIndex || Bary.z == Expected.z ? 0 : 1;
+				Error += glm::abs(Bary.z - Expected.z) < T(1e-5) ? 0 : 1;
+			}
+			else if(!Hit)
+				Error += Bary == vec3Type(T(42)) && Index == Count + 1 ? 0 : 1;
+			Hits += Hit ? 1 : 0;
+
+			// Shortly before and after the nearest hit
+			T const Nearest = ExpectedHit ? Expected.z : T(1000);
+			Error += glm::intersectRayTrianglesAny(Bvh, Orig, Dir, &Vert0[0], &Vert1[0], &Vert2[0], Nearest * T(0.999)) ? 1 : 0;
+			Error += glm::intersectRayTrianglesAny(Bvh, Orig, Dir, &Vert0[0], &Vert1[0], &Vert2[0], Nearest * T(1.001)) == ExpectedHit ? 0 : 1;
+		}
+
+		// The test data has rays hitting and missing the larger meshes
+		if(Count >= 1000)
+			Error += Hits > 0 && Hits < 256 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_rays()
+{
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	std::size_t const Count(2000);
+	std::size_t const RayCount(1000);
+
+	std::vector<vec3Type> Vert0(Count), Vert1(Count), Vert2(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		make_triangle<T>(i, T(20), T(2), Vert0[i], Vert1[i], Vert2[i]);
+
+	glm::detail::tbvh<T, glm::defaultp> Bvh;
+	Bvh.build(&Vert0[0], &Vert1[0], &Vert2[0], Count);
+
+	std::vector<vec3Type> Orig(RayCount), Dir(RayCount), Bary(RayCount, vec3Type(T(42)));
+	std::vector<std::size_t> Indices(RayCount, Count);
+	for(std::size_t i = 0; i < RayCount; ++i)
+		make_ray<T>(i, T(20), Orig[i], Dir[i]);
+
+	std::size_t const Hits = glm::intersectRaysTriangles(Bvh, &Orig[0], &Dir[0], RayCount, &Vert0[0], &Vert1[0], &Vert2[0], &Bary[0], &Indices[0]);
+
+	std::size_t ExpectedHits(0);
+	for(std::size_t i = 0; i < RayCount; ++i)
+	{
+		vec3Type Expected(T(42));
+		std::size_t ExpectedIndex(Count);
+		ExpectedHits += glm::intersectRayTriangles(Bvh, Orig[i], Dir[i], &Vert0[0], &Vert1[0], &Vert2[0], Expected, ExpectedIndex) ? 1 : 0;
+		Error += Bary[i] == Expected && Indices[i] == ExpectedIndex ? 0 : 1;
+	}
+	Error += Hits == ExpectedHits ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+int test_spheres()
+{
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	std::size_t const Counts[] = {0, 1, 5, 17, 500, 3000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<vec3Type> Centers(Count + 1), Mins(Count), Maxs(Count);
+		std::vector<T> Radii(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Centers[i] = make_point<T>(i, T(20));
+			Radii[i] = static_cast<T>(double(i % 7) * 0.1 + 0.05);
+			Mins[i] = Centers[i] - Radii[i];
+			Maxs[i] = Centers[i] + Radii[i];
+		}
+
+		glm::detail::tbvh<T, glm::defaultp> Bvh;
+		Bvh.build(&Centers[0], &Radii[0], Count);
+		Error += check_bvh(Bvh, Mins, Maxs);
+
+		for(std::size_t r = 0; r < 256; ++r)
+		{
+			vec3Type Orig, Dir;
+			make_ray<T>(r, T(20), Orig, Dir);
+
+			bool ExpectedHit = false;
+			T Expected = std::numeric_limits<T>::max();
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T Distance;
+				if(glm::intersectRaySphere(Orig, Dir, Centers[i], Radii[i] * Radii[i], Distance) && Distance < Expected)
+				{
+					Expected = Distance;
+					ExpectedHit = true;
+				}
+			}
+
+			T Distance(42);
+			std::size_t Index(Count + 1);
+			bool const Hit = glm::intersectRaySpheres(Bvh, Orig, Dir, &Centers[0], &Radii[0], Distance, Index);
+			Error += Hit == ExpectedHit ? 0 : 1;
+			if(Hit && ExpectedHit)
+			{
+				Error += glm::abs(Distance - Expected) < T(1e-5) ? 0 : 1;
+				Error += Index < Count ? 0 : 1;
+			}
+			else if(!Hit)
+				Error += Distance == T(42) && Index == Count + 1 ? 0 : 1;
+
+			T const Nearest = ExpectedHit ? Expected : T(1000);
+			Error += glm::intersectRaySpheresAny(Bvh, Orig, Dir, &Centers[0], &Radii[0], Nearest * T(0.999)) ? 1 : 0;
+			Error += glm::intersectRaySpheresAny(Bvh, Orig, Dir, &Centers[0], &Radii[0], Nearest * T(1.001)) == ExpectedHit ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Identical primitives can't be split by their centers, the leaves are split arbitrarily
+int test_degenerate()
+{
+	int Error(0);
+
+	std::size_t const Count(1000);
+	std::vector<glm::vec3> Vert0(Count, glm::vec3(0, 0, 0)), Vert1(Count, glm::vec3(1, 0, 0)), Vert2(Count, glm::vec3(0, 1, 0));
+	std::vector<glm::vec3> Mins(Count, glm::vec3(0)), Maxs(Count, glm::vec3(1, 1, 0));
+
+	glm::bvh Bvh;
+	Bvh.build(&Mins[0], &Maxs[0], Count);
+	Error += check_bvh(Bvh, Mins, Maxs);
+
+	glm::vec3 Bary;
+	std::size_t Index(Count);
+	Error += glm::intersectRayTriangles(Bvh, glm::vec3(0.25f, 0.25f, 1), glm::vec3(0, 0, -1), &Vert0[0], &Vert1[0], &Vert2[0], Bary, Index) ? 0 : 1;
+	Error += Index < Count && glm::all(glm::epsilonEqual(Bary, glm::vec3(0.25f, 0.25f, 1), 1e-6f)) ? 0 : 1;
+	Error += glm::intersectRayTriangles(Bvh, glm::vec3(0.75f, 0.75f, 1), glm::vec3(0, 0, -1), &Vert0[0], &Vert1[0], &Vert2[0], Bary, Index) ? 1 : 0;
+
+	return Error;
+}
+
+int perf_bvh()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 18);
+	std::size_t const RayCount(1 << 16);
+	std::size_t const LoopRayCount(16);
+
+	// Small triangles scattered in a large box, like a mesh
+	std::vector<glm::vec3> Vert0(Count), Vert1(Count), Vert2(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		make_triangle<float>(i, 100.0f, 1.0f, Vert0[i], Vert1[i], Vert2[i]);
+	std::vector<glm::vec3> Orig(RayCount), Dir(RayCount), Bary(RayCount);
+	std::vector<std::size_t> Indices(RayCount, Count);
+	for(std::size_t i = 0; i < RayCount; ++i)
+		make_ray<float>(i, 100.0f, Orig[i], Dir[i]);
+
+	glm::bvh Bvh;
+	std::clock_t const TimeBuildStart = std::clock();
+	Bvh.build(&Vert0[0], &Vert1[0], &Vert2[0], Count);
+	std::clock_t const TimeBuildEnd = std::clock();
+
+	std::clock_t const TimeLoopStart = std::clock();
+	std::size_t LoopHits(0);
+	for(std::size_t i = 0; i < LoopRayCount; ++i)
+	{
+		glm::vec3 LoopBary;
+		std::size_t LoopIndex;
+		LoopHits += glm::intersectRayTriangles(Orig[i], Dir[i], &Vert0[0], &Vert1[0], &Vert2[0], Count, LoopBary, LoopIndex) ? 1 : 0;
+	}
+	std::clock_t const TimeLoopEnd = std::clock();
+
+	std::clock_t const TimeClosestStart = std::clock();
+	std::size_t const Hits = glm::intersectRaysTriangles(Bvh, &Orig[0], &Dir[0], RayCount, &Vert0[0], &Vert1[0], &Vert2[0], &Bary[0], &Indices[0]);
+	std::clock_t const TimeClosestEnd = std::clock();
+
+	std::clock_t const TimeAnyStart = std::clock();
+	std::size_t AnyHits(0);
+	for(std::size_t i = 0; i < RayCount; ++i)
+		AnyHits += glm::intersectRayTrianglesAny(Bvh, Orig[i], Dir[i], &Vert0[0], &Vert1[0], &Vert2[0], std::numeric_limits<float>::max()) ? 1 : 0;
+	std::clock_t const TimeAnyEnd = std::clock();
+
+	std::size_t BvhLoopHits(0);
+	for(std::size_t i = 0; i < LoopRayCount; ++i)
+		BvhLoopHits += Indices[i] < Count ? 1 : 0;
+	Error += Hits > 0 && Hits == AnyHits && BvhLoopHits == LoopHits ? 0 : 1;
+
+	double const ClosestSeconds = double(TimeClosestEnd - TimeClosestStart) / double(CLOCKS_PER_SEC);
+	double const AnySeconds = double(TimeAnyEnd - TimeAnyStart) / double(CLOCKS_PER_SEC);
+	double const LoopSeconds = double(TimeLoopEnd - TimeLoopStart) / double(CLOCKS_PER_SEC);
+
+	printf("bvh build of %d triangles: %ld clocks\n", static_cast<int>(Count), static_cast<long>(TimeBuildEnd - TimeBuildStart));
+	printf("bvh memory: %d nodes, %.1f bytes per triangle\n", static_cast<int>(Bvh.Nodes.size()), double(Bvh.memory()) / double(Count));
+	printf("intersectRayTriangles loop: %.0f rays/s\n", LoopSeconds > 0.0 ? double(LoopRayCount) / LoopSeconds : 0.0);
+	printf("intersectRaysTriangles bvh: %.0f rays/s\n", ClosestSeconds > 0.0 ? double(RayCount) / ClosestSeconds : 0.0);
+	printf("intersectRayTrianglesAny bvh: %.0f rays/s\n", AnySeconds > 0.0 ? double(RayCount) / AnySeconds : 0.0);
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_triangles<float>();
+	Error += test_triangles<double>();
+	Error += test_rays<float>();
+	Error += test_spheres<float>();
+	Error += test_spheres<double>();
+	Error += test_degenerate();
+	Error += perf_bvh();
+
+	return Error;
+}
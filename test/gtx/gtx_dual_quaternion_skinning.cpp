@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_dual_quaternion_skinning.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/dual_quaternion_skinning.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/type_precision.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	std::size_t const BoneCount = 64;
+
+	glm::dualquat make_bone(std::size_t i)
+	{
+		glm::vec3 const Axis = glm::normalize(glm::vec3(std::sin(float(i) * 1.7f) + 0.2f, std::cos(float(i) * 0.9f), 0.5f));
+		glm::quat const Orientation = glm::angleAxis(float(i) * 0.41f, Axis);
+		glm::vec3 const Translation(float(i % 7) - 3.0f, float(i % 5) * 0.5f, -float(i % 3));
+		return glm::dualquat(Orientation, Translation);
+	}
+
+	struct mesh
+	{
+		std::vector<glm::vec3> Positions;
+		std::vector<glm::vec3> Normals;
+		std::vector<glm::u8vec4> Indices;
+		std::vector<glm::vec4> Weights;
+	};
+
+	// Vertices influenced by 1 to 4 bones
+	mesh make_mesh(std::size_t Count)
+	{
+		mesh Mesh;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Mesh.Positions.push_back(glm::vec3(float(i % 13) * 0.3f, float(i % 11) - 5.0f, float(i % 17) * 0.1f));
+			Mesh.Normals.push_back(glm::normalize(glm::vec3(float(i % 3) - 1.0f, 1.0f, float(i % 5) * 0.2f)));
+
+			std::size_t const Influences = i % 4 + 1;
+			glm::vec4 Weights(0);
+			glm::u8vec4 Indices(0);
+			float Sum(0);
+			for(std::size_t k = 0; k < Influences; ++k)
+			{
+				Indices[k] = glm::uint8((i * 7 + k * 13) % BoneCount);
+				Weights[k] = float(k + 1 + i % 3);
+				Sum += Weights[k];
+			}
+			Mesh.Indices.push_back(Indices);
+			Mesh.Weights.push_back(Weights / Sum);
+		}
+		return Mesh;
+	}
+
+	// Dual quaternion linear blending in double precision
+	void reference(std::vector<glm::dualquat> const & Palette, mesh const & Mesh, std::size_t i, glm::dvec3 & Position, glm::dvec3 & Normal)
+	{
+		glm::ddualquat Bones[4];
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			glm::dualquat const & Bone = Palette[Mesh.Indices[i][k]];
+			Bones[k] = glm::ddualquat(glm::dquat(Bone.real.w, Bone.real.x, Bone.real.y, Bone.real.z), glm::dquat(Bone.dual.w, Bone.dual.x, Bone.dual.y, Bone.dual.z));
+		}
+
+		glm::ddualquat Blend = Bones[0] * double(Mesh.Weights[i][0]);
+		for(glm::length_t k = 1; k < 4; ++k)
+			Blend = Blend + Bones[k] * (glm::dot(Bones[0].real, Bones[k].real) < 0.0 ? -double(Mesh.Weights[i][k]) : double(Mesh.Weights[i][k]));
+		Blend = glm::normalize(Blend);
+
+		Position = Blend * glm::dvec3(Mesh.Positions[i]);
+		Normal = Blend.real * glm::dvec3(Mesh.Normals[i]);
+	}
+}//namespace
+
+int test_dualQuatSkinning()
+{
+	int Error(0);
+
+	std::vector<glm::dualquat> Palette;
+	for(std::size_t i = 0; i < BoneCount; ++i)
+		Palette.push_back(make_bone(i));
+
+	// Cover the tails of the blocks
+	for(std::size_t Count = 0; Count < 40; ++Count)
+	{
+		mesh const Mesh = make_mesh(Count + 1);
+		std::vector<glm::vec3> OutPositions(Count + 1, glm::vec3(42)), OutNormals(Count + 1, glm::vec3(42));
+
+		glm::dualQuatSkinning(&Palette[0], &Mesh.Positions[0], &Mesh.Normals[0], &Mesh.Indices[0], &Mesh.Weights[0], &OutPositions[0], &OutNormals[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::dvec3 Position, Normal;
+			reference(Palette, Mesh, i, Position, Normal);
+			Error += glm::all(glm::epsilonEqual(glm::dvec3(OutPositions[i]), Position, 1e-4)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(glm::dvec3(OutNormals[i]), Normal, 1e-5)) ? 0 : 1;
+		}
+		Error += OutPositions[Count] == glm::vec3(42) ? 0 : 1;
+		Error += OutNormals[Count] == glm::vec3(42) ? 0 : 1;
+	}
+
+	// A single bone is the rigid transformation of the bone
+	{
+		mesh Mesh = make_mesh(9);
+		for(std::size_t i = 0; i < Mesh.Weights.size(); ++i)
+			Mesh.Weights[i] = glm::vec4(1, 0, 0, 0);
+
+		std::vector<glm::vec3> OutPositions(Mesh.Positions.size()), OutNormals(Mesh.Positions.size());
+		glm::dualQuatSkinning(&Palette[0], &Mesh.Positions[0], &Mesh.Normals[0], &Mesh.Indices[0], &Mesh.Weights[0], &OutPositions[0], &OutNormals[0], Mesh.Positions.size());
+
+		for(std::size_t i = 0; i < Mesh.Positions.size(); ++i)
+		{
+			glm::mat3x4 const Matrix = glm::mat3x4_cast(Palette[Mesh.Indices[i].x]);
+			glm::vec3 const Position = glm::vec4(Mesh.Positions[i], 1.0f) * Matrix;
+			Error += glm::all(glm::epsilonEqual(OutPositions[i], Position, 1e-4f)) ? 0 : 1;
+		}
+	}
+
+	// The sign of the dual quaternions doesn't matter, the shortest path is used
+	{
+		mesh const Mesh = make_mesh(37);
+		std::vector<glm::dualquat> Negated(Palette);
+		for(std::size_t i = 0; i < Negated.size(); i += 2)
+			Negated[i] = Negated[i] * -1.0f;
+
+		std::vector<glm::vec3> A(Mesh.Positions.size()), B(Mesh.Positions.size());
+		glm::dualQuatSkinning(&Palette[0], &Mesh.Positions[0], static_cast<glm::vec3 const *>(0), &Mesh.Indices[0], &Mesh.Weights[0], &A[0], static_cast<glm::vec3 *>(0), A.size());
+		glm::dualQuatSkinning(&Negated[0], &Mesh.Positions[0], static_cast<glm::vec3 const *>(0), &Mesh.Indices[0], &Mesh.Weights[0], &B[0], static_cast<glm::vec3 *>(0), B.size());
+		for(std::size_t i = 0; i < A.size(); ++i)
+			Error += glm::all(glm::epsilonEqual(A[i], B[i], 1e-4f)) ? 0 : 1;
+	}
+
+	// In place skinning with 32 bits indices and double precision
+	{
+		std::size_t const Count = 23;
+		mesh const Mesh = make_mesh(Count);
+		glm::ddualquat DoublePalette[BoneCount];
+		for(std::size_t i = 0; i < BoneCount; ++i)
+			DoublePalette[i] = glm::ddualquat(glm::dquat(Palette[i].real.w, Palette[i].real.x, Palette[i].real.y, Palette[i].real.z), glm::dquat(Palette[i].dual.w, Palette[i].dual.x, Palette[i].dual.y, Palette[i].dual.z));
+
+		glm::dvec3 Positions[Count], Normals[Count];
+		glm::dvec4 Weights[Count];
+		glm::uvec4 Indices[Count];
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Positions[i] = glm::dvec3(Mesh.Positions[i]);
+			Normals[i] = glm::dvec3(Mesh.Normals[i]);
+			Weights[i] = glm::dvec4(Mesh.Weights[i]);
+			Indices[i] = glm::uvec4(Mesh.Indices[i]);
+		}
+
+		glm::dualQuatSkinning(DoublePalette, Positions, Normals, Indices, Weights, Positions, Normals, Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::dvec3 Position, Normal;
+			reference(Palette, Mesh, i, Position, Normal);
+			Error += glm::all(glm::epsilonEqual(Positions[i], Position, 1e-5)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Normals[i], Normal, 1e-5)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int perf_dualQuatSkinning()
+{
+	int Error(0);
+
+	std::size_t const Count = 1 << 20;
+	mesh const Mesh = make_mesh(Count);
+
+	std::vector<glm::dualquat> Palette;
+	std::vector<glm::mat4> Matrices;
+	for(std::size_t i = 0; i < BoneCount; ++i)
+	{
+		Palette.push_back(make_bone(i));
+		Matrices.push_back(glm::mat4(glm::transpose(glm::mat4x3(glm::transpose(glm::mat3x4_cast(Palette[i]))))));
+	}
+
+	std::vector<glm::vec3> OutPositions(Count), OutNormals(Count);
+
+	// Linear blend skinning through mat4
+	std::clock_t TimeLinearStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::u8vec4 const & Indices = Mesh.Indices[i];
+		glm::vec4 const & Weights = Mesh.Weights[i];
+		glm::mat4 const Matrix =
+			Matrices[Indices.x] * Weights.x +
+			Matrices[Indices.y] * Weights.y +
+			Matrices[Indices.z] * Weights.z +
+			Matrices[Indices.w] * Weights.w;
+		OutPositions[i] = glm::vec3(Matrix * glm::vec4(Mesh.Positions[i], 1.0f));
+		OutNormals[i] = glm::normalize(glm::vec3(Matrix * glm::vec4(Mesh.Normals[i], 0.0f)));
+	}
+	std::clock_t TimeLinearEnd = std::clock();
+
+	// Same blending one vertex at a time with tdualquat
+	std::clock_t TimeScalarStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::u8vec4 const & Indices = Mesh.Indices[i];
+		glm::vec4 const & Weights = Mesh.Weights[i];
+		glm::dualquat Blend = Palette[Indices.x] * Weights.x;
+		for(glm::length_t k = 1; k < 4; ++k)
+			Blend = Blend + Palette[Indices[k]] * (glm::dot(Palette[Indices.x].real, Palette[Indices[k]].real) < 0.0f ? -Weights[k] : Weights[k]);
+		Blend = glm::normalize(Blend);
+		OutPositions[i] = Blend * Mesh.Positions[i];
+		OutNormals[i] = Blend.real * Mesh.Normals[i];
+	}
+	std::clock_t TimeScalarEnd = std::clock();
+
+	std::clock_t TimeArrayStart = std::clock();
+	glm::dualQuatSkinning(&Palette[0], &Mesh.Positions[0], &Mesh.Normals[0], &Mesh.Indices[0], &Mesh.Weights[0], &OutPositions[0], &OutNormals[0], Count);
+	std::clock_t TimeArrayEnd = std::clock();
+
+	Error += glm::epsilonEqual(glm::length(OutNormals[Count - 1]), 1.0f, 0.001f) ? 0 : 1;
+
+	printf("linear blend skinning mat4 loop: %ld clocks\n", static_cast<long>(TimeLinearEnd - TimeLinearStart));
+	printf("dual quaternion skinning loop: %ld clocks\n", static_cast<long>(TimeScalarEnd - TimeScalarStart));
+	printf("dualQuatSkinning: %ld clocks\n", static_cast<long>(TimeArrayEnd - TimeArrayStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_dualQuatSkinning();
+	Error += perf_dualQuatSkinning();
+
+	return Error;
+}
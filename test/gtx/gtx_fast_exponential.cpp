@@ -2,17 +2,420 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2013-10-25
-// Updated : 2013-10-25
+// Updated : 2014-10-16
 // Licence : This source is under MIT licence
-// File    : test/gtx/associated_min_max.cpp
+// File    : test/gtx/fast_exponential.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/fast_exponential.hpp>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <ctime>
+
+// Define to 1 to test every float of the ranges, which takes minutes
+#ifndef GLM_TEST_FAST_EXPONENTIAL_STRIDE
+#	define GLM_TEST_FAST_EXPONENTIAL_STRIDE 101
+#endif
+
+namespace
+{
+	// Distance between the float nearest to Reference and the next float
+	double ulp(double Reference)
+	{
+		float const Abs = glm::max(glm::abs(static_cast<float>(Reference)), std::numeric_limits<float>::min());
+		return double(std::nextafter(Abs, std::numeric_limits<float>::max())) - double(Abs);
+	}
+
+	struct errors
+	{
+		errors() : Relative(0), Ulp(0) {}
+
+		double Relative, Ulp;
+
+		void add(double Value, double Reference, double Scale)
+		{
+			double const Error = glm::abs(Value - Reference);
+			Relative = glm::max(Relative, Error / Scale);
+			Ulp = glm::max(Ulp, Error / ulp(Reference));
+		}
+	};
+
+	struct tier
+	{
+		errors Exp, Exp2, Log, Log2;
+	};
+
+	// Test the floats between Min and Max, every Stride floats, with the array or the scalar versions
+	template <glm::precision Q>
+	void measure(float Min, float Max, glm::uint32 Stride, bool Exponential, bool Scalar, tier & Errors)
+	{
+		glm::uint32 First, Last;
+		std::memcpy(&First, &Min, sizeof(float));
+		std::memcpy(&Last, &Max, sizeof(float));
+
+		std::size_t const BlockSize(1 << 14);
+		std::vector<float> In(BlockSize), Out(BlockSize), Out2(BlockSize);
+
+		for(glm::uint64 Bits = First; Bits <= Last;)
+		{
+			std::size_t Count = 0;
+			for(; Count < BlockSize && Bits <= Last; Count += 2, Bits += Stride)
+			{
+				glm::uint32 const Value = static_cast<glm::uint32>(Bits);
+				std::memcpy(&In[Count], &Value, sizeof(float));
+				In[Count + 1] = Exponential ? -In[Count] : 1.0f / In[Count];
+			}
+
+			if(Exponential)
+			{
+				if(Scalar)
+				{
+					for(std::size_t i = 0; i < Count; ++i)
+					{
+						Out[i] = glm::fastExp<Q>(In[i]);
+						Out2[i] = glm::fastExp2<Q>(In[i]);
+					}
+				}
+				else
+				{
+					glm::fastExp<Q>(&In[0], &Out[0], Count);
+					glm::fastExp2<Q>(&In[0], &Out2[0], Count);
+				}
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					double const Exp = std::exp(double(In[i]));
+					double const Exp2 = std::pow(2.0, double(In[i]));
+					if(Exp >= std::numeric_limits<float>::min() && Exp <= std::numeric_limits<float>::max())
+						Errors.Exp.add(Out[i], Exp, Exp);
+					if(Exp2 >= std::numeric_limits<float>::min() && Exp2 <= std::numeric_limits<float>::max())
+						Errors.Exp2.add(Out2[i], Exp2, Exp2);
+				}
+			}
+			else
+			{
+				if(Scalar)
+				{
+					for(std::size_t i = 0; i < Count; ++i)
+					{
+						Out[i] = glm::fastLog<Q>(In[i]);
+						Out2[i] = glm::fastLog2<Q>(In[i]);
+					}
+				}
+				else
+				{
+					glm::fastLog<Q>(&In[0], &Out[0], Count);
+					glm::fastLog2<Q>(&In[0], &Out2[0], Count);
+				}
+				for(std::size_t i = 0; i < Count; ++i)
+				{
+					if(In[i] < std::numeric_limits<float>::min())
+						continue;
+					double const Log = std::log(double(In[i]));
+					double const Log2 = Log / std::log(2.0);
+					Errors.Log.add(Out[i], Log, glm::max(1.0, glm::abs(Log)));
+					Errors.Log2.add(Out2[i], Log2, glm::max(1.0, glm::abs(Log2)));
+				}
+			}
+		}
+	}
+
+	template <glm::precision Q>
+	tier measure(glm::uint32 Stride, bool Scalar)
+	{
+		tier Errors;
+		measure<Q>(0.0f, 128.0f, Stride, true, Scalar, Errors);
+		measure<Q>(1.0f, std::numeric_limits<float>::max(), Stride, false, Scalar, Errors);
+		return Errors;
+	}
+}//namespace
+
+// The bounds published in fast_exponential.hpp
+int test_accuracy()
+{
+	int Error(0);
+
+	for(int Scalar = 0; Scalar < 2; ++Scalar)
+	{
+		tier const Low = measure<glm::lowp>(GLM_TEST_FAST_EXPONENTIAL_STRIDE, Scalar != 0);
+		tier const Medium = measure<glm::mediump>(GLM_TEST_FAST_EXPONENTIAL_STRIDE, Scalar != 0);
+		tier const High = measure<glm::highp>(GLM_TEST_FAST_EXPONENTIAL_STRIDE, Scalar != 0);
+
+		Error += Low.Exp.Relative < 1e-3 && Low.Exp2.Relative < 1e-3 && Low.Log.Relative < 1e-3 && Low.Log2.Relative < 1e-3 ? 0 : 1;
+		Error += Medium.Exp.Relative < 1e-5 && Medium.Exp2.Relative < 1e-5 && Medium.Log.Relative < 1e-5 && Medium.Log2.Relative < 1e-5 ? 0 : 1;
+		Error += High.Exp.Ulp <= 2.0 && High.Exp2.Ulp <= 2.0 && High.Log.Ulp <= 2.0 && High.Log2.Ulp <= 2.0 ? 0 : 1;
+
+		tier const * Tiers[] = {&Low, &Medium, &High};
+		char const * Names[] = {"lowp", "mediump", "highp"};
+		for(std::size_t i = 0; i < 3; ++i)
+			printf("%s %s: exp %.3g (%.3g ULP), exp2 %.3g (%.3g ULP), log %.3g (%.3g ULP), log2 %.3g (%.3g ULP)\n", Names[i], Scalar ? "scalar" : "array",
+				Tiers[i]->Exp.Relative, Tiers[i]->Exp.Ulp, Tiers[i]->Exp2.Relative, Tiers[i]->Exp2.Ulp,
+				Tiers[i]->Log.Relative, Tiers[i]->Log.Ulp, Tiers[i]->Log2.Relative, Tiers[i]->Log2.Ulp);
+	}
+
+	return Error;
+}
+
+int test_pow()
+{
+	int Error(0);
+
+	// The error grows with |y * log2(x)|
+	double MaxError(0);
+	for(std::size_t i = 0; i < 10000; ++i)
+	{
+		float const x = static_cast<float>(std::exp(std::sin(double(i) * 0.37) * 4.0));
+		float const y = static_cast<float>(std::sin(double(i) * 0.71) * 8.0);
+		double const Reference = std::pow(double(x), double(y));
+		double const Scale = glm::max(1.0, glm::abs(double(y) * std::log(double(x)) / std::log(2.0)));
+		MaxError = glm::max(MaxError, glm::abs(glm::fastPow<glm::highp>(x, y) - Reference) / Reference / Scale);
+		Error += glm::abs(glm::fastPow(x, y) - Reference) / Reference <= 2e-5 * Scale ? 0 : 1;
+		Error += glm::abs(glm::fastPow<glm::lowp>(x, y) - Reference) / Reference <= 2e-3 * Scale ? 0 : 1;
+	}
+	Error += MaxError < 1e-6 ? 0 : 1;
+
+	std::vector<float> x(100), y(100), Out(101, 42.0f);
+	for(std::size_t i = 0; i < x.size(); ++i)
+	{
+		x[i] = float(i) * 0.25f;
+		y[i] = float(i % 7) - 3.0f;
+	}
+	for(std::size_t n = 0; n < x.size(); n += 13)
+	{
+		glm::fastPow<glm::highp>(&x[0], &y[0], &Out[0], n);
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Out[i] == glm::fastPow<glm::highp>(x[i], y[i]) || glm::abs(Out[i] - glm::fastPow<glm::highp>(x[i], y[i])) <= 1e-6f * Out[i] ? 0 : 1;
+		Error += Out[n] == 42.0f ? 0 : 1;
+	}
+
+	Error += glm::fastPow(0.0f, 2.0f) == 0.0f ? 0 : 1;
+	Error += glm::fastPow(4.0f, 0.5f) == 2.0f ? 0 : 1;
+	Error += glm::all(glm::equal(glm::fastPow(glm::vec3(2.0f, 4.0f, 8.0f), glm::vec3(2.0f)), glm::vec3(4.0f, 16.0f, 64.0f))) ? 0 : 1;
+	Error += glm::fastPow(3.0f, 4) == 81.0f ? 0 : 1;
+
+	return Error;
+}
+
+// The vector and array versions compute the same polynomials, the scalar
+// versions use tables and have the same accuracy bounds
+int test_versions()
+{
+	int Error(0);
+
+	std::size_t const Count(1000);
+	std::vector<float> In(Count), Exp(Count), Log(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = static_cast<float>(std::sin(double(i) * 0.37) * 80.0);
+
+	// Cover the tails of the blocks
+	for(std::size_t n = 0; n < 20; ++n)
+	{
+		std::vector<float> Out(n + 1, 42.0f);
+		glm::fastExp(&In[0], &Out[0], n);
+		Error += Out[n] == 42.0f ? 0 : 1;
+		for(std::size_t i = 0; i < n; ++i)
+			Error += glm::abs(Out[i] - glm::fastExp(In[i])) <= 1e-5f * Out[i] ? 0 : 1;
+	}
+
+	glm::fastExp<glm::highp>(&In[0], &Exp[0], Count);
+	glm::fastLog<glm::highp>(&Exp[0], &Log[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::abs(Exp[i] - glm::fastExp<glm::highp>(In[i])) <= 1e-6f * Exp[i] ? 0 : 1;
+		Error += glm::abs(Log[i] - glm::fastLog<glm::highp>(Exp[i])) <= 1e-6f * glm::max(1.0f, glm::abs(Log[i])) ? 0 : 1;
+		Error += glm::abs(Log[i] - In[i]) <= 1e-6f * glm::max(1.0f, glm::abs(In[i])) ? 0 : 1;
+
+		// double values get the accuracy of highp float
+		double const Value(In[i] * 0.5f);
+		Error += glm::abs(glm::fastExp<glm::highp>(Value) - std::exp(Value)) <= 2.5e-7 * std::exp(Value) ? 0 : 1;
+		Error += glm::abs(glm::fastLog<glm::highp>(std::exp(Value)) - Value) <= 2.5e-7 * glm::max(1.0, glm::abs(Value)) ? 0 : 1;
+	}
+
+	for(std::size_t i = 0; i + 4 <= Count; i += 4)
+	{
+		glm::vec4 const Value(In[i + 0], In[i + 1], In[i + 2], In[i + 3]);
+		glm::vec4 const E = glm::fastExp<glm::highp>(Value);
+		glm::vec4 const L = glm::fastLog<glm::highp>(E);
+		glm::vec3 const E3 = glm::fastExp<glm::highp>(glm::vec3(Value));
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			Error += glm::abs(E[j] - Exp[i + j]) <= 1e-6f * E[j] ? 0 : 1;
+			Error += glm::abs(L[j] - Log[i + j]) <= 1e-6f * glm::max(1.0f, glm::abs(L[j])) ? 0 : 1;
+		}
+		for(glm::length_t j = 0; j < 3; ++j)
+			Error += glm::abs(E3[j] - Exp[i + j]) <= 1e-6f * E3[j] ? 0 : 1;
+	}
+
+	// Exact values
+	Error += glm::fastExp(0.0f) == 1.0f && glm::fastExp2(0.0f) == 1.0f && glm::fastExp2(-3.0f) == 0.125f ? 0 : 1;
+	Error += glm::fastLog(1.0f) == 0.0f && glm::fastLog2(1.0f) == 0.0f && glm::fastLog2(1024.0f) == 10.0f ? 0 : 1;
+	Error += glm::fastLn(1.0f) == 0.0f ? 0 : 1;
+
+	// double values get the range of double
+	double const Doubles[] = {1e-50, 1e-300, 1e300, 100.0, -100.0, 700.0, -700.0, 709.5, -720.0, 1000.0};
+	for(std::size_t i = 0; i < sizeof(Doubles) / sizeof(Doubles[0]); ++i)
+	{
+		double const x = Doubles[i];
+		if(x > 0)
+		{
+			Error += glm::abs(glm::fastLog<glm::highp>(x) - std::log(x)) <= 2.5e-7 * glm::abs(std::log(x)) ? 0 : 1;
+			Error += glm::abs(glm::fastLog2<glm::highp>(x) - std::log(x) / std::log(2.0)) <= 2.5e-7 * glm::abs(std::log(x)) ? 0 : 1;
+		}
+		double const Exp = std::exp(x);
+		Error += glm::fastExp<glm::highp>(x) == Exp || glm::abs(glm::fastExp<glm::highp>(x) - Exp) <= 2.5e-7 * Exp ? 0 : 1;
+		double const Exp2 = std::pow(2.0, x);
+		Error += glm::fastExp2<glm::highp>(x) == Exp2 || glm::abs(glm::fastExp2<glm::highp>(x) - Exp2) <= 2.5e-7 * Exp2 ? 0 : 1;
+	}
+	Error += glm::abs(glm::fastPow<glm::highp>(10.0, 200.0) / 1e200 - 1.0) <= 1e-6 && glm::abs(glm::fastPow<glm::highp>(10.0, -200.0) / 1e-200 - 1.0) <= 1e-6 ? 0 : 1;
+
+	return Error;
+}
+
+int test_special()
+{
+	int Error(0);
+
+	float const Infinity = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+
+	float const In[] = {0.0f, -1.0f, Infinity, -Infinity, NaN, 1e-40f, 100.0f, -100.0f, 128.0f, -126.0f};
+	std::size_t const Count = sizeof(In) / sizeof(In[0]);
+	float Exp[Count], Exp2[Count], Log[Count], Log2[Count];
+	glm::fastExp<glm::lowp>(In, Exp, Count);
+	glm::fastExp2<glm::lowp>(In, Exp2, Count);
+	glm::fastLog<glm::lowp>(In, Log, Count);
+	glm::fastLog2<glm::lowp>(In, Log2, Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const Scalar[] = {glm::fastExp<glm::lowp>(In[i]), glm::fastExp2<glm::lowp>(In[i]), glm::fastLog<glm::lowp>(In[i]), glm::fastLog2<glm::lowp>(In[i])};
+		float const Array[] = {Exp[i], Exp2[i], Log[i], Log2[i]};
+		for(std::size_t j = 0; j < 4; ++j)
+		{
+			// The special values are the same, the finite ones differ by the lowp accuracy
+			if(Array[j] == 0.0f || glm::abs(Array[j]) == Infinity || Array[j] != Array[j])
+				Error += Scalar[j] == Array[j] || (Scalar[j] != Scalar[j] && Array[j] != Array[j]) ? 0 : 1;
+			else
+				Error += glm::abs(Scalar[j] - Array[j]) <= 1e-3f * glm::max(1.0f, glm::abs(Array[j])) ? 0 : 1;
+		}
+	}
+
+	Error += Exp[0] == 1.0f && Exp[2] == Infinity && Exp[3] == 0.0f && Exp[4] != Exp[4] && Exp[6] == Infinity && Exp[7] == 0.0f ? 0 : 1;
+	Error += Exp2[8] == Infinity && Exp2[9] == std::numeric_limits<float>::min() ? 0 : 1;
+	Error += Log[0] == -Infinity && Log[1] != Log[1] && Log[2] == Infinity && Log[3] != Log[3] && Log[4] != Log[4] && Log[5] == -Infinity ? 0 : 1;
+	Error += Log2[0] == -Infinity && Log2[1] != Log2[1] && Log2[2] == Infinity ? 0 : 1;
+
+	return Error;
+}
+
+int perf_exponential()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 20);
+	std::vector<float> In(Count), Out(Count), Log(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = static_cast<float>(std::sin(double(i) * 0.37) * 40.0);
+
+	// Best of several runs to be less sensitive to the load of the machine
+	std::clock_t TimeExp(0), TimeLog(0), TimeScalarExp(0), TimeScalarLog(0);
+	float Sum(0);
+	for(int Run = 0; Run < 5; ++Run)
+	{
+		std::clock_t const TimeExpStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = std::exp(In[i]);
+		std::clock_t const TimeExpEnd = std::clock();
+
+		Sum = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += std::log(Out[i]);
+
+		std::clock_t const TimeLogStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Log[i] = std::log(Out[i]);
+		std::clock_t const TimeLogEnd = std::clock();
+
+		std::clock_t const TimeScalarExpStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = glm::fastExp(In[i]);
+		std::clock_t const TimeScalarExpEnd = std::clock();
+
+		std::clock_t const TimeScalarLogStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Log[i] = glm::fastLog(Out[i]);
+		std::clock_t const TimeScalarLogEnd = std::clock();
+
+		bool const First = Run == 0;
+		TimeExp = First ? TimeExpEnd - TimeExpStart : glm::min(TimeExp, TimeExpEnd - TimeExpStart);
+		TimeLog = First ? TimeLogEnd - TimeLogStart : glm::min(TimeLog, TimeLogEnd - TimeLogStart);
+		TimeScalarExp = First ? TimeScalarExpEnd - TimeScalarExpStart : glm::min(TimeScalarExp, TimeScalarExpEnd - TimeScalarExpStart);
+		TimeScalarLog = First ? TimeScalarLogEnd - TimeScalarLogStart : glm::min(TimeScalarLog, TimeScalarLogEnd - TimeScalarLogStart);
+	}
+
+	float ScalarSum(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		ScalarSum += Log[i];
+	Error += glm::abs(ScalarSum - Sum) < 1e-5f * Count ? 0 : 1;
+
+	printf("std::exp: %ld clocks\n", static_cast<long>(TimeExp));
+	printf("std::log: %ld clocks\n", static_cast<long>(TimeLog));
+	printf("fastExp: %ld clocks\n", static_cast<long>(TimeScalarExp));
+	printf("fastLog: %ld clocks\n", static_cast<long>(TimeScalarLog));
+
+	std::clock_t Times[3][2];
+	float Sums[3];
+	glm::precision const Tiers[] = {glm::lowp, glm::mediump, glm::highp};
+	for(std::size_t t = 0; t < 3; ++t)
+	{
+		std::clock_t const TimeStart = std::clock();
+		switch(Tiers[t])
+		{
+		case glm::lowp: glm::fastExp<glm::lowp>(&In[0], &Out[0], Count); break;
+		case glm::mediump: glm::fastExp<glm::mediump>(&In[0], &Out[0], Count); break;
+		default: glm::fastExp<glm::highp>(&In[0], &Out[0], Count); break;
+		}
+		std::clock_t const TimeMiddle = std::clock();
+		switch(Tiers[t])
+		{
+		case glm::lowp: glm::fastLog<glm::lowp>(&Out[0], &Out[0], Count); break;
+		case glm::mediump: glm::fastLog<glm::mediump>(&Out[0], &Out[0], Count); break;
+		default: glm::fastLog<glm::highp>(&Out[0], &Out[0], Count); break;
+		}
+		std::clock_t const TimeEnd = std::clock();
+
+		Times[t][0] = TimeMiddle - TimeStart;
+		Times[t][1] = TimeEnd - TimeMiddle;
+		Sums[t] = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			Sums[t] += Out[i];
+	}
+
+	Error += glm::abs(Sums[0] - Sum) < 1e-3f * Count ? 0 : 1;
+	Error += glm::abs(Sums[1] - Sum) < 1e-5f * Count ? 0 : 1;
+	Error += glm::abs(Sums[2] - Sum) < 1e-6f * Count ? 0 : 1;
+
+	char const * Names[] = {"lowp", "mediump", "highp"};
+	for(std::size_t t = 0; t < 3; ++t)
+	{
+		printf("fastExp<%s> array: %ld clocks\n", Names[t], static_cast<long>(Times[t][0]));
+		printf("fastLog<%s> array: %ld clocks\n", Names[t], static_cast<long>(Times[t][1]));
+	}
+
+	return Error;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_accuracy();
+	Error += test_pow();
+	Error += test_versions();
+	Error += test_special();
+	Error += perf_exponential();
+
 	return Error;
 }
@@ -2,7 +2,7 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2013-10-25
-// Updated : 2013-10-25
+// Updated : 2014-10-16
 // Licence : This source is under MIT licence
 // File    : test/gtx/fast_square_root.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,44 @@
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/vector_relational.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	// Deterministic vectors of lengths between 1e-3 and 1e3
+	glm::vec4 make_vector(std::size_t i)
+	{
+		double const t = double(i);
+		glm::vec4 const Direction(
+			static_cast<float>(std::sin(t * 0.37)),
+			static_cast<float>(std::cos(t * 0.71)),
+			static_cast<float>(std::sin(t * 1.13 + 0.5)),
+			static_cast<float>(std::cos(t * 0.29 + 1.0)));
+		return Direction * static_cast<float>(std::pow(10.0, std::sin(t * 0.53) * 3.0));
+	}
+
+	// Largest error on the components and on the length of Count normalized vectors
+	template <typename vecType>
+	double normalize_error(vecType const * In, vecType const * Out, std::size_t Count)
+	{
+		double Error(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double Dot(0), Length(0);
+			for(glm::length_t j = 0; j < In[i].length(); ++j)
+			{
+				Dot += double(In[i][j]) * double(In[i][j]);
+				Length += double(Out[i][j]) * double(Out[i][j]);
+			}
+			for(glm::length_t j = 0; j < In[i].length(); ++j)
+				Error = glm::max(Error, glm::abs(double(Out[i][j]) - double(In[i][j]) / std::sqrt(Dot)));
+			Error = glm::max(Error, glm::abs(std::sqrt(Length) - 1.0));
+		}
+		return Error;
+	}
+}//namespace
 
 int test_fastInverseSqrt()
 {
@@ -43,12 +81,266 @@ int test_fastDistance()
 	return Error;
 }
 
+// The bounds published in fast_square_root.hpp
+int test_inverseSqrt_array()
+{
+	int Error(0);
+
+	std::size_t const Count(1000);
+	std::vector<float> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = static_cast<float>(std::pow(10.0, std::sin(double(i) * 0.53) * 30.0));
+
+	glm::precision const Tiers[] = {glm::lowp, glm::mediump, glm::highp};
+	double const Bounds[] = {2e-3, 5e-6, 1.2e-7};
+	for(std::size_t t = 0; t < 3; ++t)
+	{
+		if(Tiers[t] == glm::lowp)
+			glm::fastInverseSqrt<glm::lowp>(&In[0], &Out[0], Count);
+		else if(Tiers[t] == glm::mediump)
+			glm::fastInverseSqrt<glm::mediump>(&In[0], &Out[0], Count);
+		else
+			glm::fastInverseSqrt<glm::highp>(&In[0], &Out[0], Count);
+
+		double MaxError(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const Reference = 1.0 / std::sqrt(double(In[i]));
+			MaxError = glm::max(MaxError, glm::abs(double(Out[i]) - Reference) / Reference);
+		}
+		Error += MaxError <= Bounds[t] ? 0 : 1;
+	}
+
+	// The default is mediump and doubles use the float estimate
+	std::vector<float> Medium(Count);
+	glm::fastInverseSqrt<glm::mediump>(&In[0], &Medium[0], Count);
+	glm::fastInverseSqrt(&In[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Out[i] == Medium[i] ? 0 : 1;
+
+	std::vector<double> InDouble(In.begin(), In.end()), OutDouble(Count);
+	glm::fastInverseSqrt<glm::mediump>(&InDouble[0], &OutDouble[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::abs(OutDouble[i] * std::sqrt(InDouble[i]) - 1.0) <= 5e-6 ? 0 : 1;
+
+	return Error;
+}
+
+template <glm::precision Q>
+int test_normalize_tier(double Bound)
+{
+	int Error(0);
+
+	std::size_t const Count(1001);
+	std::vector<glm::vec3> In3(Count), Out3(Count);
+	std::vector<glm::vec4> In4(Count), Out4(Count);
+	std::vector<float> X(Count), Y(Count), Z(Count), W(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		In4[i] = make_vector(i);
+		In3[i] = glm::vec3(In4[i]);
+	}
+
+	glm::fastNormalize<Q>(&In3[0], &Out3[0], Count);
+	glm::fastNormalize<Q>(&In4[0], &Out4[0], Count);
+	Error += normalize_error(&In3[0], &Out3[0], Count) <= Bound ? 0 : 1;
+	Error += normalize_error(&In4[0], &Out4[0], Count) <= Bound ? 0 : 1;
+
+	// The SoA versions compute the same values
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		X[i] = In3[i].x;
+		Y[i] = In3[i].y;
+		Z[i] = In3[i].z;
+	}
+	glm::fastNormalize<Q>(&X[0], &Y[0], &Z[0], &X[0], &Y[0], &Z[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::vec3(X[i], Y[i], Z[i]) == Out3[i] ? 0 : 1;
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		X[i] = In4[i].x;
+		Y[i] = In4[i].y;
+		Z[i] = In4[i].z;
+		W[i] = In4[i].w;
+	}
+	glm::fastNormalize<Q>(&X[0], &Y[0], &Z[0], &W[0], &X[0], &Y[0], &Z[0], &W[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::vec4(X[i], Y[i], Z[i], W[i]) == Out4[i] ? 0 : 1;
+
+	return Error;
+}
+
+int test_normalize_array()
+{
+	int Error(0);
+
+	Error += test_normalize_tier<glm::lowp>(2e-3);
+	Error += test_normalize_tier<glm::mediump>(5e-6);
+	Error += test_normalize_tier<glm::highp>(3e-7);
+
+	std::size_t const Count(100);
+	std::vector<glm::vec3> In(Count), Out(Count), Default(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = glm::vec3(make_vector(i));
+
+	// highp matches normalize
+	glm::fastNormalize<glm::highp>(&In[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::epsilonEqual(Out[i], glm::normalize(In[i]), 1e-7f)) ? 0 : 1;
+
+	// The default is mediump
+	glm::fastNormalize<glm::mediump>(&In[0], &Out[0], Count);
+	glm::fastNormalize(&In[0], &Default[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Out[i] == Default[i] ? 0 : 1;
+
+	// In place
+	std::vector<glm::vec3> InPlace(In);
+	glm::fastNormalize(&InPlace[0], &InPlace[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += InPlace[i] == Out[i] ? 0 : 1;
+
+	// Cover the tails of the blocks
+	for(std::size_t n = 0; n < 20; ++n)
+	{
+		std::vector<glm::vec4> Tail(n + 1, glm::vec4(42.0f));
+		std::vector<float> X(n + 1, 42.0f), Y(n + 1, 42.0f), Z(n + 1, 42.0f);
+		std::vector<float> InX(n + 1), InY(n + 1), InZ(n + 1);
+		for(std::size_t i = 0; i < n; ++i)
+		{
+			InX[i] = In[i].x;
+			InY[i] = In[i].y;
+			InZ[i] = In[i].z;
+		}
+
+		std::vector<glm::vec4> In4(n + 1);
+		for(std::size_t i = 0; i < n; ++i)
+			In4[i] = make_vector(i);
+
+		glm::fastNormalize(&In4[0], &Tail[0], n);
+		glm::fastNormalize(&InX[0], &InY[0], &InZ[0], &X[0], &Y[0], &Z[0], n);
+
+		Error += Tail[n] == glm::vec4(42.0f) && X[n] == 42.0f && Y[n] == 42.0f && Z[n] == 42.0f ? 0 : 1;
+		for(std::size_t i = 0; i < n; ++i)
+		{
+			Error += glm::vec3(X[i], Y[i], Z[i]) == Out[i] ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Tail[i], glm::normalize(In4[i]), 5e-6f)) ? 0 : 1;
+		}
+	}
+
+	// Zero, denormal and overflowing lengths give zero vectors
+	float const Huge = std::numeric_limits<float>::max();
+	glm::vec3 const Degenerate[] = {
+		glm::vec3(0.0f), glm::vec3(1e-30f, 0.0f, -1e-30f), glm::vec3(Huge, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)};
+	glm::vec3 Normalized[4];
+	glm::fastNormalize<glm::lowp>(Degenerate, Normalized, 4);
+	Error += Normalized[0] == glm::vec3(0.0f) ? 0 : 1;
+	Error += Normalized[1] == glm::vec3(0.0f) ? 0 : 1;
+	Error += Normalized[2] == glm::vec3(0.0f) ? 0 : 1;
+	Error += glm::abs(Normalized[3].y - 1.0f) <= 2e-3f ? 0 : 1;
+
+	glm::fastNormalize<glm::highp>(Degenerate, Normalized, 4);
+	Error += Normalized[0] == glm::vec3(0.0f) && Normalized[1] == glm::vec3(0.0f) && Normalized[2] == glm::vec3(0.0f) ? 0 : 1;
+	Error += Normalized[3] == glm::vec3(0.0f, 1.0f, 0.0f) ? 0 : 1;
+
+	// Doubles
+	glm::dvec3 const InDouble(3.0, 0.0, 4.0);
+	glm::dvec3 OutDouble;
+	glm::fastNormalize<glm::highp>(&InDouble, &OutDouble, 1);
+	Error += glm::all(glm::epsilonEqual(OutDouble, glm::dvec3(0.6, 0.0, 0.8), 1e-15)) ? 0 : 1;
+
+	// Doubles keep the range of double, out of the range of float
+	glm::dvec3 const Wide[] = {
+		glm::dvec3(1e-20, 0.0, 0.0), glm::dvec3(1e20, 0.0, 0.0), glm::dvec3(0.0, -1e-150, 0.0), glm::dvec3(0.0, 0.0, 1e150)};
+	glm::dvec3 WideOut[4];
+	glm::fastNormalize<glm::highp>(Wide, WideOut, 4);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(WideOut[i], glm::normalize(Wide[i]), 1e-15)) ? 0 : 1;
+	glm::fastNormalize<glm::mediump>(Wide, WideOut, 4);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(WideOut[i], glm::normalize(Wide[i]), 5e-6)) ? 0 : 1;
+	glm::fastNormalize<glm::lowp>(Wide, WideOut, 4);
+	for(std::size_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(WideOut[i], glm::normalize(Wide[i]), 2e-3)) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_normalize()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 20);
+	std::vector<glm::vec3> In(Count), Out(Count);
+	std::vector<float> InX(Count), InY(Count), InZ(Count), X(Count), Y(Count), Z(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		In[i] = glm::vec3(make_vector(i));
+		InX[i] = In[i].x;
+		InY[i] = In[i].y;
+		InZ[i] = In[i].z;
+	}
+
+	std::clock_t const TimeNormalizeStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::normalize(In[i]);
+	std::clock_t const TimeNormalizeEnd = std::clock();
+
+	float Sum(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		Sum += Out[i].x + Out[i].y + Out[i].z;
+
+	std::clock_t const TimeScalarStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastNormalize(In[i]);
+	std::clock_t const TimeScalarEnd = std::clock();
+
+	std::clock_t const TimeLowStart = std::clock();
+	glm::fastNormalize<glm::lowp>(&In[0], &Out[0], Count);
+	std::clock_t const TimeLowEnd = std::clock();
+
+	std::clock_t const TimeHighStart = std::clock();
+	glm::fastNormalize<glm::highp>(&In[0], &Out[0], Count);
+	std::clock_t const TimeHighEnd = std::clock();
+
+	std::clock_t const TimeMediumStart = std::clock();
+	glm::fastNormalize<glm::mediump>(&In[0], &Out[0], Count);
+	std::clock_t const TimeMediumEnd = std::clock();
+
+	float FastSum(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		FastSum += Out[i].x + Out[i].y + Out[i].z;
+	Error += glm::abs(Sum - FastSum) < 1.0f ? 0 : 1;
+
+	std::clock_t const TimeSoAStart = std::clock();
+	glm::fastNormalize<glm::mediump>(&InX[0], &InY[0], &InZ[0], &X[0], &Y[0], &Z[0], Count);
+	std::clock_t const TimeSoAEnd = std::clock();
+
+	float SoASum(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		SoASum += X[i] + Y[i] + Z[i];
+	Error += SoASum == FastSum ? 0 : 1;
+
+	printf("normalize: %ld clocks\n", static_cast<long>(TimeNormalizeEnd - TimeNormalizeStart));
+	printf("fastNormalize: %ld clocks\n", static_cast<long>(TimeScalarEnd - TimeScalarStart));
+	printf("fastNormalize<lowp> array: %ld clocks\n", static_cast<long>(TimeLowEnd - TimeLowStart));
+	printf("fastNormalize<mediump> array: %ld clocks\n", static_cast<long>(TimeMediumEnd - TimeMediumStart));
+	printf("fastNormalize<highp> array: %ld clocks\n", static_cast<long>(TimeHighEnd - TimeHighStart));
+	printf("fastNormalize<mediump> SoA array: %ld clocks\n", static_cast<long>(TimeSoAEnd - TimeSoAStart));
+
+	return Error;
+}
+
 int main()
 {
 	int Error(0);
 
 	Error += test_fastInverseSqrt();
 	Error += test_fastDistance();
+	Error += test_inverseSqrt_array();
+	Error += test_normalize_array();
+	Error += perf_normalize();
 
 	return Error;
 }
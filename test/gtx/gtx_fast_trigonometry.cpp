@@ -2,17 +2,286 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2013-10-25
-// Updated : 2013-10-25
+// Updated : 2014-10-16
 // Licence : This source is under MIT licence
 // File    : test/gtx/fast_trigonometry.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/fast_trigonometry.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <ctime>
+
+// Define to 1 to test every float of the ranges, which takes minutes
+#ifndef GLM_TEST_FAST_TRIGONOMETRY_STRIDE
+#	define GLM_TEST_FAST_TRIGONOMETRY_STRIDE 101
+#endif
+
+namespace
+{
+	// Distance between the float nearest to Reference and the next float
+	double ulp(double Reference)
+	{
+		float const Abs = glm::max(glm::abs(static_cast<float>(Reference)), std::numeric_limits<float>::min());
+		return double(std::nextafter(Abs, std::numeric_limits<float>::max())) - double(Abs);
+	}
+
+	struct errors
+	{
+		errors() : SinAbs(0), CosAbs(0), SinUlp(0), CosUlp(0), TanUlp(0) {}
+
+		double SinAbs, CosAbs;
+		double SinUlp, CosUlp, TanUlp;
+	};
+
+	// Test the floats between Min and Max and their opposites, every Stride floats
+	errors measure(float Min, float Max, glm::uint32 Stride)
+	{
+		glm::uint32 First, Last;
+		std::memcpy(&First, &Min, sizeof(float));
+		std::memcpy(&Last, &Max, sizeof(float));
+
+		std::size_t const BlockSize(1 << 14);
+		std::vector<float> In(BlockSize), Sin(BlockSize), Cos(BlockSize), Tan(BlockSize);
+
+		errors Errors;
+		for(glm::uint64 Bits = First; Bits <= Last;)
+		{
+			std::size_t Count = 0;
+			for(; Count < BlockSize && Bits <= Last; Count += 2, Bits += Stride)
+			{
+				glm::uint32 const Value = static_cast<glm::uint32>(Bits);
+				std::memcpy(&In[Count], &Value, sizeof(float));
+				In[Count + 1] = -In[Count];
+			}
+
+			glm::fastSinCos(&In[0], &Sin[0], &Cos[0], Count);
+			glm::fastTan(&In[0], &Tan[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				double const Angle(In[i]);
+				double const SinError = glm::abs(double(Sin[i]) - std::sin(Angle));
+				double const CosError = glm::abs(double(Cos[i]) - std::cos(Angle));
+				Errors.SinAbs = glm::max(Errors.SinAbs, SinError);
+				Errors.CosAbs = glm::max(Errors.CosAbs, CosError);
+				Errors.SinUlp = glm::max(Errors.SinUlp, SinError / ulp(std::sin(Angle)));
+				Errors.CosUlp = glm::max(Errors.CosUlp, CosError / ulp(std::cos(Angle)));
+				Errors.TanUlp = glm::max(Errors.TanUlp, glm::abs(double(Tan[i]) - std::tan(Angle)) / ulp(std::tan(Angle)));
+			}
+		}
+
+		return Errors;
+	}
+}//namespace
+
+// The bounds published in fast_trigonometry.hpp
+int test_accuracy()
+{
+	int Error(0);
+
+	errors const Pi = measure(0.0f, glm::pi<float>(), GLM_TEST_FAST_TRIGONOMETRY_STRIDE);
+	Error += Pi.SinUlp <= 2.0 && Pi.CosUlp <= 2.0 ? 0 : 1;
+	Error += Pi.TanUlp <= 4.0 ? 0 : 1;
+
+	errors const Large = measure(glm::pi<float>(), 8192.0f, GLM_TEST_FAST_TRIGONOMETRY_STRIDE * 7);
+	Error += glm::max(Pi.SinAbs, Large.SinAbs) <= 1e-7 ? 0 : 1;
+	Error += glm::max(Pi.CosAbs, Large.CosAbs) <= 1e-7 ? 0 : 1;
+
+	printf("[-pi, pi]: sin %.3g ULP, cos %.3g ULP, tan %.3g ULP\n", Pi.SinUlp, Pi.CosUlp, Pi.TanUlp);
+	printf("[-8192, 8192]: sin %.3g, cos %.3g absolute\n", glm::max(Pi.SinAbs, Large.SinAbs), glm::max(Pi.CosAbs, Large.CosAbs));
+
+	return Error;
+}
+
+// The scalar, vector and array versions compute the same polynomials
+int test_versions()
+{
+	int Error(0);
+
+	std::size_t const Count(1000);
+	std::vector<float> In(Count), Sin(Count), Cos(Count), Tan(Count), SinCos(Count), CosSin(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = static_cast<float>(std::sin(double(i) * 0.37) * 20.0);
+
+	// Cover the tails of the blocks
+	for(std::size_t n = 0; n < 20; ++n)
+	{
+		std::vector<float> Out(n + 1, 42.0f);
+		glm::fastSin(&In[0], &Out[0], n);
+		Error += Out[n] == 42.0f ? 0 : 1;
+		for(std::size_t i = 0; i < n; ++i)
+			Error += glm::abs(Out[i] - glm::fastSin(In[i])) <= 1e-7f ? 0 : 1;
+	}
+
+	glm::fastSin(&In[0], &Sin[0], Count);
+	glm::fastCos(&In[0], &Cos[0], Count);
+	glm::fastTan(&In[0], &Tan[0], Count);
+	glm::fastSinCos(&In[0], &SinCos[0], &CosSin[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const Angle = In[i];
+		float S, C;
+		glm::fastSinCos(Angle, S, C);
+		Error += glm::abs(Sin[i] - glm::fastSin(Angle)) <= 1e-7f && Sin[i] == SinCos[i] && glm::abs(S - Sin[i]) <= 1e-7f ? 0 : 1;
+		Error += glm::abs(Cos[i] - glm::fastCos(Angle)) <= 1e-7f && Cos[i] == CosSin[i] && glm::abs(C - Cos[i]) <= 1e-7f ? 0 : 1;
+		Error += glm::abs(Tan[i] - glm::fastTan(Angle)) <= 4e-7f * glm::max(1.0f, glm::abs(Tan[i])) ? 0 : 1;
+
+		// double angles get the accuracy of float
+		Error += glm::abs(glm::fastSin(double(Angle)) - std::sin(double(Angle))) <= 1e-7 ? 0 : 1;
+		Error += glm::abs(glm::fastCos(double(Angle)) - std::cos(double(Angle))) <= 1e-7 ? 0 : 1;
+	}
+
+	for(std::size_t i = 0; i + 4 <= Count; i += 4)
+	{
+		glm::vec4 const Angle(In[i + 0], In[i + 1], In[i + 2], In[i + 3]);
+		glm::vec4 const S = glm::fastSin(Angle);
+		glm::vec4 const C = glm::fastCos(Angle);
+		glm::vec3 const T = glm::fastTan(glm::vec3(Angle));
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			Error += glm::abs(S[j] - Sin[i + j]) <= 1e-7f ? 0 : 1;
+			Error += glm::abs(C[j] - Cos[i + j]) <= 1e-7f ? 0 : 1;
+		}
+		for(glm::length_t j = 0; j < 3; ++j)
+			Error += glm::abs(T[j] - Tan[i + j]) <= 4e-7f * glm::max(1.0f, glm::abs(T[j])) ? 0 : 1;
+	}
+
+	// Exact values
+	Error += glm::fastSin(0.0f) == 0.0f && glm::fastCos(0.0f) == 1.0f && glm::fastTan(0.0f) == 0.0f ? 0 : 1;
+
+	return Error;
+}
+
+// Out of the domain of the range reduction the standard library is used
+int test_domain()
+{
+	int Error(0);
+
+	float const Inputs[] = {1e5f, -1e5f, 1.0001e5f, 1e6f, 1e7f, -1e8f, 3e9f, -1e10f, 1e30f};
+	std::size_t const Count(sizeof(Inputs) / sizeof(float));
+
+	std::vector<float> Sin(Count), Cos(Count), Tan(Count);
+	glm::fastSin(&Inputs[0], &Sin[0], Count);
+	glm::fastCos(&Inputs[0], &Cos[0], Count);
+	glm::fastTan(&Inputs[0], &Tan[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const Angle = Inputs[i];
+		float const StdSin = std::sin(Angle);
+		float const StdCos = std::cos(Angle);
+		float const StdTan = std::tan(Angle);
+		glm::vec4 const Vector(glm::fastSin(glm::vec4(Angle)));
+		float S, C;
+		glm::fastSinCos(Angle, S, C);
+
+		Error += glm::abs(glm::fastSin(Angle) - StdSin) <= 1e-6f && glm::abs(S - StdSin) <= 1e-6f ? 0 : 1;
+		Error += glm::abs(glm::fastCos(Angle) - StdCos) <= 1e-6f && glm::abs(C - StdCos) <= 1e-6f ? 0 : 1;
+		Error += glm::abs(glm::fastTan(Angle) - StdTan) <= 1e-5f * glm::max(1.0f, glm::abs(StdTan)) ? 0 : 1;
+		Error += glm::abs(Sin[i] - StdSin) <= 1e-6f && glm::abs(Cos[i] - StdCos) <= 1e-6f ? 0 : 1;
+		Error += glm::abs(Tan[i] - StdTan) <= 1e-5f * glm::max(1.0f, glm::abs(StdTan)) ? 0 : 1;
+		Error += glm::abs(Vector.x - StdSin) <= 1e-6f && glm::abs(Vector.w - StdSin) <= 1e-6f ? 0 : 1;
+		Error += glm::abs(glm::fastSin(double(Angle)) - std::sin(double(Angle))) <= 1e-6 ? 0 : 1;
+	}
+
+	// Infinities and NaNs give NaNs
+	float const Infinity = std::numeric_limits<float>::infinity();
+	float const Special[] = {Infinity, -Infinity, std::numeric_limits<float>::quiet_NaN(), 0.0f, 1.0f};
+	float Out[5];
+	glm::fastSin(&Special[0], &Out[0], 5);
+	for(std::size_t i = 0; i < 3; ++i)
+	{
+		Error += glm::isnan(glm::fastSin(Special[i])) && glm::isnan(glm::fastCos(Special[i])) && glm::isnan(glm::fastTan(Special[i])) ? 0 : 1;
+		Error += glm::isnan(Out[i]) && glm::isnan(glm::fastSin(glm::vec4(Special[i])).y) ? 0 : 1;
+	}
+	Error += Out[3] == 0.0f && glm::abs(Out[4] - std::sin(1.0f)) <= 1e-7f ? 0 : 1;
+
+	return Error;
+}
+
+int perf_trigonometry()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 20);
+	std::vector<float> In(Count), Sin(Count), Cos(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = static_cast<float>(std::sin(double(i) * 0.37) * 100.0);
+
+	// Best of several runs to be less sensitive to the load of the machine
+	std::clock_t TimeStd(0), TimeStdSin(0), TimeScalar(0), TimeScalarSin(0), TimeArray(0);
+	float Sum(0), FastSum(0);
+	for(int Run = 0; Run < 5; ++Run)
+	{
+		std::clock_t const TimeStdStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sin[i] = std::sin(In[i]);
+			Cos[i] = std::cos(In[i]);
+		}
+		std::clock_t const TimeStdEnd = std::clock();
+
+		Sum = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			Sum += Sin[i] + Cos[i];
+
+		std::clock_t const TimeStdSinStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Sin[i] = std::sin(In[i]);
+		std::clock_t const TimeStdSinEnd = std::clock();
+
+		std::clock_t const TimeScalarSinStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			Cos[i] = glm::fastSin(In[i]);
+		std::clock_t const TimeScalarSinEnd = std::clock();
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(Sin[i] - Cos[i]) <= 1e-6f ? 0 : 1;
+
+		std::clock_t const TimeScalarStart = std::clock();
+		for(std::size_t i = 0; i < Count; ++i)
+			glm::fastSinCos(In[i], Sin[i], Cos[i]);
+		std::clock_t const TimeScalarEnd = std::clock();
+
+		std::clock_t const TimeArrayStart = std::clock();
+		glm::fastSinCos(&In[0], &Sin[0], &Cos[0], Count);
+		std::clock_t const TimeArrayEnd = std::clock();
+
+		FastSum = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			FastSum += Sin[i] + Cos[i];
+
+		bool const First = Run == 0;
+		TimeStd = First ? TimeStdEnd - TimeStdStart : glm::min(TimeStd, TimeStdEnd - TimeStdStart);
+		TimeStdSin = First ? TimeStdSinEnd - TimeStdSinStart : glm::min(TimeStdSin, TimeStdSinEnd - TimeStdSinStart);
+		TimeScalar = First ? TimeScalarEnd - TimeScalarStart : glm::min(TimeScalar, TimeScalarEnd - TimeScalarStart);
+		TimeScalarSin = First ? TimeScalarSinEnd - TimeScalarSinStart : glm::min(TimeScalarSin, TimeScalarSinEnd - TimeScalarSinStart);
+		TimeArray = First ? TimeArrayEnd - TimeArrayStart : glm::min(TimeArray, TimeArrayEnd - TimeArrayStart);
+	}
+	Error += glm::abs(Sum - FastSum) < 1e-1f ? 0 : 1;
+
+	printf("std::sin: %ld clocks\n", static_cast<long>(TimeStdSin));
+	printf("fastSin: %ld clocks\n", static_cast<long>(TimeScalarSin));
+	printf("std::sin and std::cos: %ld clocks\n", static_cast<long>(TimeStd));
+	printf("fastSinCos: %ld clocks\n", static_cast<long>(TimeScalar));
+	printf("fastSinCos array: %ld clocks\n", static_cast<long>(TimeArray));
+
+	return Error;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_accuracy();
+	Error += test_versions();
+	Error += test_domain();
+	Error += perf_trigonometry();
+
 	return Error;
 }
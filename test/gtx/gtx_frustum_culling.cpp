@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_frustum_culling.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/frustum_culling.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_view_projection()
+	{
+		typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+		return glm::perspective(glm::radians(T(60)), T(16) / T(9), T(0.5), T(200)) *
+			glm::lookAt(vec3Type(T(10), T(5), T(-3)), vec3Type(T(0), T(2), T(40)), vec3Type(T(0), T(1), T(0)));
+	}
+
+	// Positions scattered around the camera, in and out of the frustum
+	template <typename T>
+	T make_coord(std::size_t i, std::size_t Component)
+	{
+		return static_cast<T>(std::sin(double(i) * (1.3 + double(Component) * 0.71) + double(Component)) * 150.0);
+	}
+
+	template <typename T>
+	T make_radius(std::size_t i)
+	{
+		return static_cast<T>(double(i % 13) * 0.5 + 0.1);
+	}
+
+	// -1: outside, 1: inside, 0: too close to a plane to tell with rounding
+	template <typename T>
+	int classify(glm::detail::tvec4<T, glm::defaultp> const Planes[6], glm::detail::tvec3<T, glm::defaultp> const & Min, glm::detail::tvec3<T, glm::defaultp> const & Max, T Radius, bool Sphere)
+	{
+		T Distance = std::numeric_limits<T>::max();
+		for(std::size_t k = 0; k < 6; ++k)
+		{
+			glm::detail::tvec3<T, glm::defaultp> const Normal(Planes[k]);
+			glm::detail::tvec3<T, glm::defaultp> const Corner(
+				Normal.x >= T(0) ? Max.x : Min.x,
+				Normal.y >= T(0) ? Max.y : Min.y,
+				Normal.z >= T(0) ? Max.z : Min.z);
+			T const d = Sphere ? glm::dot(Normal, Min) + Planes[k].w + Radius : glm::dot(Normal, Corner) + Planes[k].w;
+			Distance = glm::min(Distance, d);
+		}
+		return Distance > T(1e-3) ? 1 : (Distance < T(-1e-3) ? -1 : 0);
+	}
+
+	template <typename T, typename indexType>
+	int check_visible(std::vector<int> const & Expected, indexType const * Visible, std::size_t Count)
+	{
+		int Error(0);
+
+		std::vector<bool> Found(Expected.size(), false);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			std::size_t const Index = static_cast<std::size_t>(Visible[i]);
+			Error += Index < Expected.size() && Expected[Index] >= 0 ? 0 : 1;
+			Error += i == 0 || Visible[i - 1] < Visible[i] ? 0 : 1;
+			if(Index < Expected.size())
+				Found[Index] = true;
+		}
+		for(std::size_t i = 0; i < Expected.size(); ++i)
+			Error += Expected[i] <= 0 || Found[i] ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+template <typename T>
+int test_frustumPlanes()
+{
+	typedef glm::detail::tvec4<T, glm::defaultp> vec4Type;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	glm::detail::tmat4x4<T, glm::defaultp> const ViewProjection = make_view_projection<T>();
+	vec4Type Planes[6];
+	glm::frustumPlanes(ViewProjection, Planes);
+
+	for(std::size_t k = 0; k < 6; ++k)
+		Error += glm::abs(glm::length(vec3Type(Planes[k])) - T(1)) < T(1e-5) ? 0 : 1;
+
+	// A point is inside all the planes when its clip coordinates are in [-w, w]
+	for(std::size_t i = 0; i < 1024; ++i)
+	{
+		vec3Type const Point(make_coord<T>(i, 0) * T(0.2), make_coord<T>(i, 1) * T(0.2), make_coord<T>(i, 2) * T(0.2) + T(40));
+		vec4Type const Clip = ViewProjection * vec4Type(Point, T(1));
+
+		bool InsidePlanes = true;
+		for(std::size_t k = 0; k < 6; ++k)
+			InsidePlanes = InsidePlanes && glm::dot(vec3Type(Planes[k]), Point) + Planes[k].w >= T(0);
+		bool const InsideClip = Clip.w > T(0) && glm::all(glm::lessThanEqual(glm::abs(vec3Type(Clip)), vec3Type(Clip.w)));
+		Error += InsidePlanes == InsideClip ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T, typename indexType>
+int test_cull()
+{
+	typedef glm::detail::tvec4<T, glm::defaultp> vec4Type;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	vec4Type Planes[6];
+	glm::frustumPlanes(make_view_projection<T>(), Planes);
+
+	// Cover the tails of the blocks and several ranges
+	std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 21, 4096, 4097, 20000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+
+		std::vector<T> X(Count + 1), Y(Count + 1), Z(Count + 1), Radius(Count + 1);
+		std::vector<T> MaxX(Count + 1), MaxY(Count + 1), MaxZ(Count + 1);
+		std::vector<int> ExpectedSpheres(Count), ExpectedBoxes(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_coord<T>(i, 0);
+			Y[i] = make_coord<T>(i, 1);
+			Z[i] = make_coord<T>(i, 2);
+			Radius[i] = make_radius<T>(i);
+			MaxX[i] = X[i] + Radius[i];
+			MaxY[i] = Y[i] + Radius[i] * T(2);
+			MaxZ[i] = Z[i] + Radius[i] * T(0.5);
+
+			vec3Type const Min(X[i], Y[i], Z[i]);
+			vec3Type const Max(MaxX[i], MaxY[i], MaxZ[i]);
+			ExpectedSpheres[i] = classify(Planes, Min, Max, Radius[i], true);
+			ExpectedBoxes[i] = classify(Planes, Min, Max, Radius[i], false);
+		}
+
+		std::vector<indexType> Visible(Count + 1, indexType(42));
+
+		std::size_t const VisibleSpheres = glm::cullSpheres(Planes, &X[0], &Y[0], &Z[0], &Radius[0], &Visible[0], Count);
+		Error += check_visible<T>(ExpectedSpheres, &Visible[0], VisibleSpheres);
+		Error += Visible[Count] == indexType(42) ? 0 : 1;
+
+		std::size_t const VisibleBoxes = glm::cullBoxes(Planes, &X[0], &Y[0], &Z[0], &MaxX[0], &MaxY[0], &MaxZ[0], &Visible[0], Count);
+		Error += check_visible<T>(ExpectedBoxes, &Visible[0], VisibleBoxes);
+		Error += Visible[Count] == indexType(42) ? 0 : 1;
+
+		// The test data has objects on both sides
+		if(Count >= 4096)
+			Error += VisibleSpheres > 0 && VisibleSpheres < Count && VisibleBoxes > 0 && VisibleBoxes < Count ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_cull()
+{
+	int Error(0);
+
+	std::size_t const Count(500000);
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(make_view_projection<float>(), Planes);
+
+	std::vector<float> X(Count), Y(Count), Z(Count), Radius(Count), MaxX(Count), MaxY(Count), MaxZ(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		X[i] = make_coord<float>(i, 0);
+		Y[i] = make_coord<float>(i, 1);
+		Z[i] = make_coord<float>(i, 2);
+		Radius[i] = make_radius<float>(i);
+		MaxX[i] = X[i] + Radius[i];
+		MaxY[i] = Y[i] + Radius[i];
+		MaxZ[i] = Z[i] + Radius[i];
+	}
+	std::vector<glm::uint> Visible(Count);
+
+	std::clock_t const TimeLoopStart = std::clock();
+	std::size_t LoopCount = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		bool Inside = true;
+		for(std::size_t k = 0; k < 6 && Inside; ++k)
+			Inside = glm::dot(glm::vec3(Planes[k]), glm::vec3(X[i], Y[i], Z[i])) + Planes[k].w >= -Radius[i];
+		if(Inside)
+			Visible[LoopCount++] = static_cast<glm::uint>(i);
+	}
+	std::clock_t const TimeLoopEnd = std::clock();
+
+	std::clock_t const TimeSpheresStart = std::clock();
+	std::size_t const SphereCount = glm::cullSpheres(Planes, &X[0], &Y[0], &Z[0], &Radius[0], &Visible[0], Count);
+	std::clock_t const TimeSpheresEnd = std::clock();
+
+	std::clock_t const TimeBoxesStart = std::clock();
+	std::size_t const BoxCount = glm::cullBoxes(Planes, &X[0], &Y[0], &Z[0], &MaxX[0], &MaxY[0], &MaxZ[0], &Visible[0], Count);
+	std::clock_t const TimeBoxesEnd = std::clock();
+
+	// Bounding boxes of the spheres are a bit more conservative
+	Error += SphereCount > 0 && BoxCount >= SphereCount ? 0 : 1;
+	Error += LoopCount + 16 > SphereCount && SphereCount + 16 > LoopCount ? 0 : 1;
+
+	printf("cull spheres loop: %ld clocks\n", static_cast<long>(TimeLoopEnd - TimeLoopStart));
+	printf("cullSpheres: %ld clocks\n", static_cast<long>(TimeSpheresEnd - TimeSpheresStart));
+	printf("cullBoxes: %ld clocks\n", static_cast<long>(TimeBoxesEnd - TimeBoxesStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_frustumPlanes<float>();
+	Error += test_frustumPlanes<double>();
+	Error += test_cull<float, glm::uint>();
+	Error += test_cull<float, int>();
+	Error += test_cull<double, glm::uint>();
+	Error += perf_cull();
+
+	return Error;
+}
@@ -2,17 +2,207 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2013-10-25
-// Updated : 2013-10-25
+// Updated : 2014-10-16
 // Licence : This source is under MIT licence
 // File    : test/gtx/intersect.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/intersect.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tvec3<T, glm::defaultp> make_point(std::size_t i, T Scale)
+	{
+		return glm::detail::tvec3<T, glm::defaultp>(
+			static_cast<T>(std::sin(double(i) * 1.37 + 0.3)),
+			static_cast<T>(std::sin(double(i) * 2.11 + 1.1)),
+			static_cast<T>(std::sin(double(i) * 0.73 + 2.7))) * Scale;
+	}
+
+	// Small triangles scattered in a box, both facing and back facing
+	template <typename T>
+	void make_triangle(std::size_t i, glm::detail::tvec3<T, glm::defaultp> & v0, glm::detail::tvec3<T, glm::defaultp> & v1, glm::detail::tvec3<T, glm::defaultp> & v2)
+	{
+		v0 = make_point<T>(i, T(10));
+		v1 = v0 + make_point<T>(i * 3 + 1, T(2));
+		v2 = v0 + make_point<T>(i * 5 + 2, T(2));
+	}
+
+	template <typename T>
+	void make_ray(std::size_t i, glm::detail::tvec3<T, glm::defaultp> & orig, glm::detail::tvec3<T, glm::defaultp> & dir)
+	{
+		orig = make_point<T>(i * 7 + 3, T(12));
+		dir = glm::normalize(make_point<T>(i * 11 + 5, T(9)) - orig);
+	}
+}//namespace
+
+template <typename T>
+int test_intersectRayTriangles()
+{
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	// Cover the tails of the blocks
+	for(std::size_t Count = 0; Count < 300; Count += Count < 21 ? 1 : 37)
+	{
+		std::vector<vec3Type> Vert0(Count + 1), Vert1(Count + 1), Vert2(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+			make_triangle<T>(i, Vert0[i], Vert1[i], Vert2[i]);
+
+		for(std::size_t r = 0; r < 64; ++r)
+		{
+			vec3Type Orig, Dir;
+			make_ray<T>(r, Orig, Dir);
+
+			bool ExpectedHit = false;
+			vec3Type Expected(T(0), T(0), std::numeric_limits<T>::max());
+			std::size_t ExpectedIndex = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec3Type Bary;
+				if(glm::intersectRayTriangle(Orig, Dir, Vert0[i], Vert1[i], Vert2[i], Bary) && Bary.z < Expected.z)
+				{
+					ExpectedHit = true;
+					Expected = Bary;
+					ExpectedIndex = i;
+				}
+			}
+
+			vec3Type Bary(T(42));
+			std::size_t Index = Count + 1;
+			bool const Hit = glm::intersectRayTriangles(Orig, Dir, &Vert0[0], &Vert1[0], &Vert2[0], Count, Bary, Index);
+			Error += Hit == ExpectedHit ? 0 : 1;
+			if(Hit && ExpectedHit)
+			{
+				Error += Index == ExpectedIndex ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(Bary, Expected, T(1e-5))) ? 0 : 1;
+			}
+			else if(!Hit)
+				Error += Bary == vec3Type(T(42)) && Index == Count + 1 ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_intersectRaysTriangle()
+{
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	for(std::size_t Count = 0; Count < 300; Count += Count < 21 ? 1 : 37)
+	{
+		std::vector<vec3Type> Orig(Count + 1), Dir(Count + 1);
+		std::vector<vec3Type> Nearest(Count + 1, vec3Type(T(0), T(0), std::numeric_limits<T>::max()));
+		std::vector<vec3Type> Expected(Nearest);
+		for(std::size_t i = 0; i < Count; ++i)
+			make_ray<T>(i, Orig[i], Dir[i]);
+		Nearest[Count] = Expected[Count] = vec3Type(T(42));
+
+		// The nearest hit of each ray over a mesh
+		std::size_t Hits(0), ExpectedHits(0);
+		for(std::size_t t = 0; t < 64; ++t)
+		{
+			vec3Type v0, v1, v2;
+			make_triangle<T>(t, v0, v1, v2);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec3Type Bary;
+				if(glm::intersectRayTriangle(Orig[i], Dir[i], v0, v1, v2, Bary) && Bary.z < Expected[i].z)
+				{
+					Expected[i] = Bary;
+					++ExpectedHits;
+				}
+			}
+
+			Hits += glm::intersectRaysTriangle(&Orig[0], &Dir[0], Count, v0, v1, v2, &Nearest[0]);
+		}
+
+		Error += Hits == ExpectedHits ? 0 : 1;
+		for(std::size_t i = 0; i < Count + 1; ++i)
+			Error += glm::all(glm::epsilonEqual(Nearest[i], Expected[i], T(1e-5))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_intersect()
+{
+	int Error(0);
+
+	std::size_t const TriangleCount(1 << 16);
+	std::size_t const RayCount(64);
+
+	std::vector<glm::vec3> Vert0(TriangleCount), Vert1(TriangleCount), Vert2(TriangleCount);
+	for(std::size_t i = 0; i < TriangleCount; ++i)
+		make_triangle<float>(i, Vert0[i], Vert1[i], Vert2[i]);
+	std::vector<glm::vec3> Orig(RayCount), Dir(RayCount);
+	for(std::size_t i = 0; i < RayCount; ++i)
+		make_ray<float>(i, Orig[i], Dir[i]);
+
+	std::size_t LoopHits(0), PacketHits(0);
+
+	std::clock_t const TimeLoopStart = std::clock();
+	for(std::size_t r = 0; r < RayCount; ++r)
+	{
+		float Nearest = std::numeric_limits<float>::max();
+		for(std::size_t i = 0; i < TriangleCount; ++i)
+		{
+			glm::vec3 Bary;
+			if(glm::intersectRayTriangle(Orig[r], Dir[r], Vert0[i], Vert1[i], Vert2[i], Bary) && Bary.z < Nearest)
+				Nearest = Bary.z;
+		}
+		LoopHits += Nearest < std::numeric_limits<float>::max() ? 1 : 0;
+	}
+	std::clock_t const TimeLoopEnd = std::clock();
+
+	std::clock_t const TimeTrianglesStart = std::clock();
+	for(std::size_t r = 0; r < RayCount; ++r)
+	{
+		glm::vec3 Bary;
+		std::size_t Index;
+		PacketHits += glm::intersectRayTriangles(Orig[r], Dir[r], &Vert0[0], &Vert1[0], &Vert2[0], TriangleCount, Bary, Index) ? 1 : 0;
+	}
+	std::clock_t const TimeTrianglesEnd = std::clock();
+
+	std::vector<glm::vec3> Nearest(RayCount, glm::vec3(0, 0, std::numeric_limits<float>::max()));
+	std::clock_t const TimeRaysStart = std::clock();
+	for(std::size_t i = 0; i < TriangleCount; ++i)
+		glm::intersectRaysTriangle(&Orig[0], &Dir[0], RayCount, Vert0[i], Vert1[i], Vert2[i], &Nearest[0]);
+	std::clock_t const TimeRaysEnd = std::clock();
+
+	std::size_t RaysHits(0);
+	for(std::size_t r = 0; r < RayCount; ++r)
+		RaysHits += Nearest[r].z < std::numeric_limits<float>::max() ? 1 : 0;
+
+	Error += LoopHits == PacketHits && LoopHits == RaysHits ? 0 : 1;
+
+	printf("intersectRayTriangle loop: %ld clocks\n", static_cast<long>(TimeLoopEnd - TimeLoopStart));
+	printf("intersectRayTriangles: %ld clocks\n", static_cast<long>(TimeTrianglesEnd - TimeTrianglesStart));
+	printf("intersectRaysTriangle: %ld clocks\n", static_cast<long>(TimeRaysEnd - TimeRaysStart));
+
+	return Error;
+}
 
 int main()
 {
 	int Error(0);
 
+	Error += test_intersectRayTriangles<float>();
+	Error += test_intersectRayTriangles<double>();
+	Error += test_intersectRaysTriangle<float>();
+	Error += test_intersectRaysTriangle<double>();
+	Error += perf_intersect();
+
 	return Error;
 }
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_matrix_decompose.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/matrix_decompose.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tquat<T, glm::defaultp> make_rotation(std::size_t i)
+	{
+		glm::detail::tvec3<T, glm::defaultp> const Axis = glm::normalize(glm::detail::tvec3<T, glm::defaultp>(
+			static_cast<T>(std::sin(double(i) * 1.3) + 0.1),
+			static_cast<T>(std::cos(double(i) * 0.7)),
+			static_cast<T>(std::sin(double(i) * 2.9 + 1.0))));
+		// Covers angles up to 2 pi, including half turns around every axis
+		return glm::angleAxis(static_cast<T>(double(i) * 0.61), Axis);
+	}
+
+	template <typename T>
+	glm::detail::tvec3<T, glm::defaultp> make_scale(std::size_t i)
+	{
+		return glm::detail::tvec3<T, glm::defaultp>(T(1) + T(i % 3), T(0.5), i % 4 == 1 ? T(-2) : T(2));
+	}
+
+	template <typename T>
+	glm::detail::tvec3<T, glm::defaultp> make_translation(std::size_t i)
+	{
+		return glm::detail::tvec3<T, glm::defaultp>(T(i % 7), T(2) - T(i % 5), T(3));
+	}
+
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_trs(std::size_t i)
+	{
+		glm::detail::tmat4x4<T, glm::defaultp> const Translate = glm::translate(glm::detail::tmat4x4<T, glm::defaultp>(1), make_translation<T>(i));
+		return glm::scale(Translate * glm::mat4_cast(make_rotation<T>(i)), make_scale<T>(i));
+	}
+
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_sheared(std::size_t i)
+	{
+		glm::detail::tmat4x4<T, glm::defaultp> Shear(1);
+		Shear[1][0] = T(0.25);
+		return make_trs<T>(i) * Shear;
+	}
+
+	template <typename T>
+	bool mat_equal(glm::detail::tmat4x4<T, glm::defaultp> const & a, glm::detail::tmat4x4<T, glm::defaultp> const & b, T Epsilon)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+				return false;
+		return true;
+	}
+
+	// q and -q are the same rotation
+	template <typename T>
+	bool quat_equal(glm::detail::tquat<T, glm::defaultp> const & a, glm::detail::tquat<T, glm::defaultp> const & b, T Epsilon)
+	{
+		return glm::abs(glm::abs(glm::dot(a, b)) - T(1)) < Epsilon;
+	}
+}//namespace
+
+template <typename T>
+int test_decompose()
+{
+	typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+	typedef glm::detail::tquat<T, glm::defaultp> quatType;
+
+	int Error(0);
+
+	for(std::size_t i = 0; i < 64; ++i)
+	{
+		mat4Type const M = make_trs<T>(i);
+
+		vec3Type Translation, Scale;
+		quatType Rotation;
+		Error += glm::decompose(M, Translation, Rotation, Scale) ? 1 : 0;
+
+		Error += mat_equal(glm::recompose(Translation, Rotation, Scale), M, T(1e-5)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Translation, make_translation<T>(i), T(1e-6))) ? 0 : 1;
+		Error += glm::abs(glm::length(Rotation) - T(1)) < T(1e-5) ? 0 : 1;
+
+		// The reflection goes to the z scale
+		vec3Type const ExpectedScale = glm::abs(make_scale<T>(i)) * vec3Type(T(1), T(1), glm::sign(glm::determinant(M)));
+		Error += glm::all(glm::epsilonEqual(Scale, ExpectedScale, T(1e-5))) ? 0 : 1;
+		if(ExpectedScale == make_scale<T>(i))
+			Error += quat_equal(Rotation, make_rotation<T>(i), T(1e-5)) ? 0 : 1;
+	}
+
+	// Half turns, the trace is -1
+	for(glm::length_t i = 0; i < 3; ++i)
+	{
+		vec3Type Axis(T(0));
+		Axis[i] = T(1);
+		quatType const Half = glm::angleAxis(glm::pi<T>(), Axis);
+		mat4Type const M = glm::mat4_cast(Half);
+
+		vec3Type Translation, Scale;
+		quatType Rotation;
+		glm::decompose(M, Translation, Rotation, Scale);
+		Error += quat_equal(Rotation, Half, T(1e-5)) ? 0 : 1;
+		Error += mat_equal(glm::recompose(Translation, Rotation, Scale), M, T(1e-5)) ? 0 : 1;
+	}
+
+	for(std::size_t i = 0; i < 16; ++i)
+	{
+		vec3Type Translation, Scale;
+		quatType Rotation;
+		Error += glm::decompose(make_sheared<T>(i), Translation, Rotation, Scale) ? 0 : 1;
+		Error += glm::abs(glm::length(Rotation) - T(1)) < T(1e-5) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_decompose_array()
+{
+	typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+	typedef glm::detail::tquat<T, glm::defaultp> quatType;
+
+	int Error(0);
+
+	// Cover the tails of the blocks
+	for(std::size_t Count = 0; Count < 21; ++Count)
+	{
+		// Automatic storage, std::vector doesn't align dmat4 to 32 bytes with AVX
+		mat4Type In[21];
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = i % 5 == 3 ? make_sheared<T>(i) : make_trs<T>(i);
+
+		vec3Type Translations[22], Scales[22];
+		quatType Rotations[22];
+		bool Sheared[22];
+		Translations[Count] = Scales[Count] = vec3Type(42);
+		Sheared[Count] = false;
+		glm::decompose(&In[0], &Translations[0], &Rotations[0], &Scales[0], &Sheared[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3Type Translation, Scale;
+			quatType Rotation;
+			bool const Expected = glm::decompose(In[i], Translation, Rotation, Scale);
+			Error += Sheared[i] == Expected ? 0 : 1;
+			Error += Sheared[i] == (i % 5 == 3) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Translations[i], Translation, T(1e-6))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Scales[i], Scale, T(1e-5))) ? 0 : 1;
+			Error += quat_equal(Rotations[i], Rotation, T(1e-5)) ? 0 : 1;
+		}
+		Error += Translations[Count] == vec3Type(42) && Scales[Count] == vec3Type(42) && !Sheared[Count] ? 0 : 1;
+
+		mat4Type Out[22];
+		Out[Count] = mat4Type(42);
+		glm::recompose(&Translations[0], &Rotations[0], &Scales[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			if(i % 5 != 3)
+				Error += mat_equal(Out[i], In[i], T(1e-5)) ? 0 : 1;
+		Error += Out[Count] == mat4Type(42) ? 0 : 1;
+
+		// The shear flags are optional
+		glm::decompose(&In[0], &Translations[0], &Rotations[0], &Scales[0], static_cast<bool*>(0), Count);
+	}
+
+	return Error;
+}
+
+int perf_decompose_array()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 18);
+
+	std::vector<glm::mat4> In(Count), Out(Count);
+	std::vector<glm::vec3> Translations(Count), Scales(Count);
+	std::vector<glm::quat> Rotations(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = make_trs<float>(i % 64);
+
+	std::clock_t const TimeLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::decompose(In[i], Translations[i], Rotations[i], Scales[i]);
+	std::clock_t const TimeLoopEnd = std::clock();
+
+	std::clock_t const TimeDecomposeStart = std::clock();
+	glm::decompose(&In[0], &Translations[0], &Rotations[0], &Scales[0], static_cast<bool*>(0), Count);
+	std::clock_t const TimeDecomposeEnd = std::clock();
+
+	std::clock_t const TimeRecomposeStart = std::clock();
+	glm::recompose(&Translations[0], &Rotations[0], &Scales[0], &Out[0], Count);
+	std::clock_t const TimeRecomposeEnd = std::clock();
+
+	Error += mat_equal(Out[Count - 1], In[Count - 1], 0.0001f) ? 0 : 1;
+
+	printf("decompose loop: %ld clocks\n", static_cast<long>(TimeLoopEnd - TimeLoopStart));
+	printf("decompose array: %ld clocks\n", static_cast<long>(TimeDecomposeEnd - TimeDecomposeStart));
+	printf("recompose array: %ld clocks\n", static_cast<long>(TimeRecomposeEnd - TimeRecomposeStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_decompose<float>();
+	Error += test_decompose<double>();
+	Error += test_decompose_array<float>();
+	Error += test_decompose_array<double>();
+	Error += perf_decompose_array();
+
+	return Error;
+}
@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_matrix_hierarchy.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/matrix_hierarchy.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tmat4x4<T, glm::defaultp> make_local(std::size_t i)
+	{
+		glm::detail::tvec3<T, glm::defaultp> const Axis = glm::normalize(glm::detail::tvec3<T, glm::defaultp>(
+			static_cast<T>(std::sin(double(i) * 1.3) + 0.1),
+			static_cast<T>(std::cos(double(i) * 0.7)),
+			static_cast<T>(std::sin(double(i) * 2.9 + 1.0))));
+		glm::detail::tmat4x4<T, glm::defaultp> const Translate = glm::translate(
+			glm::detail::tmat4x4<T, glm::defaultp>(1),
+			glm::detail::tvec3<T, glm::defaultp>(T(i % 5), T(1), T(-0.5)));
+		return glm::rotate(Translate, static_cast<T>(double(i) * 0.37), Axis);
+	}
+
+	// Nodes sorted by depth, each node has 4 children
+	int breadth_first_parent(std::size_t i)
+	{
+		return i == 0 ? -1 : static_cast<int>((i - 1) / 4);
+	}
+
+	// Any topological order, with a few more roots
+	int random_parent(std::size_t i)
+	{
+		return i % 97 == 0 ? -1 : static_cast<int>((i * 2654435761u) % i);
+	}
+
+	template <typename T>
+	bool mat_equal(glm::detail::tmat4x4<T, glm::defaultp> const & a, glm::detail::tmat4x4<T, glm::defaultp> const & b, T Epsilon)
+	{
+		for(glm::length_t i = 0; i < 4; ++i)
+			if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+				return false;
+		return true;
+	}
+
+	template <typename T>
+	int test_propagate(std::size_t Count, int (*parent)(std::size_t))
+	{
+		typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+
+		int Error(0);
+
+		std::vector<mat4Type> Locals(Count), Worlds(Count), Expected(Count);
+		std::vector<int> Parents(Count);
+		std::vector<unsigned int> UnsignedParents(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Locals[i] = make_local<T>(i);
+			Parents[i] = parent(i);
+			UnsignedParents[i] = static_cast<unsigned int>(Parents[i]);
+			Expected[i] = Parents[i] < 0 ? Locals[i] : Expected[Parents[i]] * Locals[i];
+		}
+
+		glm::propagateHierarchy(&Locals[0], &Parents[0], &Worlds[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += mat_equal(Worlds[i], Expected[i], T(1e-3)) ? 0 : 1;
+
+		// Unsigned indices and in place
+		glm::propagateHierarchy(&Locals[0], &UnsignedParents[0], &Locals[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += mat_equal(Locals[i], Expected[i], T(1e-3)) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace
+
+int test_multiply()
+{
+	int Error(0);
+
+	std::size_t const Count(1000);
+	std::vector<glm::mat4> A(Count), B(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = make_local<float>(i);
+		B[i] = make_local<float>(i * 3 + 1);
+	}
+
+	glm::multiply(&A[0], &B[0], &Out[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += mat_equal(Out[i], A[i] * B[i], 1e-5f) ? 0 : 1;
+
+	glm::multiply(&A[0], &B[0], &A[0], Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += A[i] == Out[i] ? 0 : 1;
+
+	return Error;
+}
+
+int test_propagateHierarchy()
+{
+	int Error(0);
+
+	std::size_t const Counts[] = {1, 2, 5, 21, 600, 5000};
+	for(std::size_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); ++i)
+	{
+		Error += test_propagate<float>(Counts[i], breadth_first_parent);
+		Error += test_propagate<float>(Counts[i], random_parent);
+	}
+
+	// Automatic storage, std::vector doesn't align dmat4 to 32 bytes with AVX
+	{
+		std::size_t const Count(21);
+		glm::dmat4 Locals[Count], Worlds[Count], Expected[Count];
+		int Parents[Count];
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Locals[i] = make_local<double>(i);
+			Parents[i] = random_parent(i);
+			Expected[i] = Parents[i] < 0 ? Locals[i] : Expected[Parents[i]] * Locals[i];
+		}
+
+		glm::propagateHierarchy(Locals, Parents, Worlds, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += mat_equal(Worlds[i], Expected[i], 1e-9) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_propagateHierarchy(std::size_t Count)
+{
+	int Error(0);
+
+	std::vector<glm::mat4> Locals(Count), Worlds(Count), Expected(Count);
+	std::vector<int> Parents(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Locals[i] = make_local<float>(i);
+		Parents[i] = breadth_first_parent(i);
+	}
+
+	std::clock_t const TimeLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Expected[i] = Parents[i] < 0 ? Locals[i] : Expected[Parents[i]] * Locals[i];
+	std::clock_t const TimeLoopEnd = std::clock();
+
+	std::clock_t const TimeArrayStart = std::clock();
+	glm::propagateHierarchy(&Locals[0], &Parents[0], &Worlds[0], Count);
+	std::clock_t const TimeArrayEnd = std::clock();
+
+	Error += mat_equal(Worlds[Count - 1], Expected[Count - 1], 1e-3f) ? 0 : 1;
+
+	printf("%ld nodes, operator* loop: %ld clocks\n", static_cast<long>(Count), static_cast<long>(TimeLoopEnd - TimeLoopStart));
+	printf("%ld nodes, propagateHierarchy: %ld clocks\n", static_cast<long>(Count), static_cast<long>(TimeArrayEnd - TimeArrayStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_multiply();
+	Error += test_propagateHierarchy();
+	Error += perf_propagateHierarchy(10000);
+	Error += perf_propagateHierarchy(100000);
+	Error += perf_propagateHierarchy(1000000);
+
+	return Error;
+}
@@ -0,0 +1,260 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_morton.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/morton.hpp>
+#include <glm/gtx/bit.hpp>
+#include <vector>
+#include <limits>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	// Deterministic pseudo random integers
+	glm::uint32 random(glm::uint32 & Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed;
+	}
+
+	// Bit by bit interleave of the Bits lowest bits of Components coordinates
+	glm::uint64 interleave(glm::uint64 const * Coords, int Components, int Bits)
+	{
+		glm::uint64 Key(0);
+		for(int i = 0; i < Bits; ++i)
+		for(int c = 0; c < Components; ++c)
+			Key |= ((Coords[c] >> i) & 1) << (i * Components + c);
+		return Key;
+	}
+
+	std::vector<glm::vec3> make_positions(std::size_t Count)
+	{
+		std::vector<glm::vec3> Positions(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const t = double(i);
+			Positions[i] = glm::vec3(
+				static_cast<float>(std::sin(t * 0.37) * 100.0),
+				static_cast<float>(std::cos(t * 0.71) * 50.0 + 20.0),
+				static_cast<float>(std::sin(t * 1.13 + 0.5) * 10.0));
+		}
+		return Positions;
+	}
+
+	// Key computed with the quantization documented in morton.hpp
+	template <typename genUType>
+	genUType reference_key(glm::vec3 const & Position, glm::vec3 const & Min, glm::vec3 const & Max, int Bits)
+	{
+		float const Cells = static_cast<float>(1 << Bits);
+		glm::uint64 Coords[3];
+		for(glm::length_t c = 0; c < 3; ++c)
+		{
+			float const Scale = Max[c] > Min[c] ? Cells / (Max[c] - Min[c]) : 0.0f;
+			float const Cell = (Position[c] - Min[c]) * Scale;
+			Coords[c] = Cell > 0.0f ? glm::uint64(glm::min(Cell, Cells - 1.0f)) : 0;
+		}
+		return static_cast<genUType>(interleave(Coords, 3, Bits));
+	}
+}//namespace
+
+int test_encode()
+{
+	int Error(0);
+
+	glm::uint32 Seed(1);
+	for(std::size_t i = 0; i < 100000; ++i)
+	{
+		glm::uint64 const Coords[] = {random(Seed), random(Seed), random(Seed)};
+
+		glm::u16vec2 const P16(static_cast<glm::uint16>(Coords[0]), static_cast<glm::uint16>(Coords[1]));
+		glm::uint64 const Low16[] = {P16.x, P16.y};
+		Error += glm::mortonEncode(P16) == interleave(Low16, 2, 16) ? 0 : 1;
+		Error += glm::mortonEncode(P16) == glm::bitfieldInterleave(P16.x, P16.y) ? 0 : 1;
+
+		glm::u32vec2 const P32(static_cast<glm::uint32>(Coords[0]), static_cast<glm::uint32>(Coords[1]));
+		Error += glm::mortonEncode(P32) == interleave(Coords, 2, 32) ? 0 : 1;
+		Error += glm::mortonEncode(P32) == glm::bitfieldInterleave(P32.x, P32.y) ? 0 : 1;
+
+		// The upper bits are ignored
+		glm::u16vec3 const P10(static_cast<glm::uint16>(Coords[0]), static_cast<glm::uint16>(Coords[1]), static_cast<glm::uint16>(Coords[2]));
+		Error += glm::mortonEncode(P10) == interleave(Coords, 3, 10) ? 0 : 1;
+
+		glm::u32vec3 const P21(static_cast<glm::uint32>(Coords[0]), static_cast<glm::uint32>(Coords[1]), static_cast<glm::uint32>(Coords[2]));
+		Error += glm::mortonEncode(P21) == interleave(Coords, 3, 21) ? 0 : 1;
+		Error += glm::mortonEncode(P21 & glm::u32vec3(0x1FFFFF)) == glm::bitfieldInterleave(P21.x & 0x1FFFFF, P21.y & 0x1FFFFF, P21.z & 0x1FFFFF) ? 0 : 1;
+	}
+
+	Error += glm::mortonEncode(glm::u16vec3(0x3FF)) == 0x3FFFFFFF ? 0 : 1;
+	Error += glm::mortonEncode(glm::u32vec3(0x1FFFFF)) == glm::uint64(0x7FFFFFFFFFFFFFFF) ? 0 : 1;
+	Error += glm::mortonEncode(glm::u32vec2(0xFFFFFFFF)) == glm::uint64(0xFFFFFFFFFFFFFFFF) ? 0 : 1;
+
+	return Error;
+}
+
+int test_decode()
+{
+	int Error(0);
+
+	glm::uint32 Seed(2);
+	for(std::size_t i = 0; i < 100000; ++i)
+	{
+		glm::uint32 const Key32 = random(Seed);
+		glm::uint64 const Key64 = (glm::uint64(random(Seed)) << 32) | random(Seed);
+
+		Error += glm::mortonEncode(glm::mortonDecode2(Key32)) == Key32 ? 0 : 1;
+		Error += glm::mortonEncode(glm::mortonDecode2(Key64)) == Key64 ? 0 : 1;
+		Error += glm::mortonEncode(glm::mortonDecode3(Key32)) == (Key32 & 0x3FFFFFFF) ? 0 : 1;
+		Error += glm::mortonEncode(glm::mortonDecode3(Key64)) == (Key64 & glm::uint64(0x7FFFFFFFFFFFFFFF)) ? 0 : 1;
+
+		glm::u16vec3 const P10(random(Seed) & 0x3FF, random(Seed) & 0x3FF, random(Seed) & 0x3FF);
+		Error += glm::mortonDecode3(glm::mortonEncode(P10)) == P10 ? 0 : 1;
+
+		glm::u32vec3 const P21(random(Seed) & 0x1FFFFF, random(Seed) & 0x1FFFFF, random(Seed) & 0x1FFFFF);
+		Error += glm::mortonDecode3(glm::mortonEncode(P21)) == P21 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_array()
+{
+	int Error(0);
+
+	std::size_t const Count(1000);
+	std::vector<glm::vec3> const Positions(make_positions(Count));
+
+	// The box doesn't contain every position to test the clamping
+	glm::vec3 const Min(-90.0f, -30.0f, -10.0f);
+	glm::vec3 const Max(90.0f, 70.0f, 10.0f);
+
+	std::vector<glm::uint32> Keys32(Count);
+	std::vector<glm::uint64> Keys64(Count);
+	glm::mortonEncode(&Positions[0], &Keys32[0], Count, Min, Max);
+	glm::mortonEncode(&Positions[0], &Keys64[0], Count, Min, Max);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Keys32[i] == reference_key<glm::uint32>(Positions[i], Min, Max, 10) ? 0 : 1;
+		Error += Keys64[i] == reference_key<glm::uint64>(Positions[i], Min, Max, 21) ? 0 : 1;
+	}
+
+	// Decoding gives the centers of the cells. With 21 bits per axis, the quantization of
+	// floats, which have 24 bits, can select the next cell when the position is close to it.
+	std::vector<glm::vec3> Centers(Count);
+	glm::mortonDecode(&Keys64[0], &Centers[0], Count, Min, Max);
+	glm::vec3 const Tolerance((Max - Min) / float(1 << 21));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Clamped(glm::clamp(Positions[i], Min, Max));
+		Error += glm::all(glm::lessThanEqual(glm::abs(Centers[i] - Clamped), Tolerance)) ? 0 : 1;
+	}
+
+	// Cover the tails of the blocks
+	for(std::size_t n = 0; n < 20; ++n)
+	{
+		std::vector<glm::uint32> Tail(n + 1, 42);
+		glm::mortonEncode(&Positions[0], &Tail[0], n, Min, Max);
+		Error += Tail[n] == 42 ? 0 : 1;
+		for(std::size_t i = 0; i < n; ++i)
+			Error += Tail[i] == Keys32[i] ? 0 : 1;
+	}
+
+	// NaN coordinates go to Min, empty boxes to their first cell
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	glm::vec3 const Special[] = {glm::vec3(NaN), glm::vec3(NaN, 100.0f, -100.0f), Max, Min};
+	glm::uint32 SpecialKeys[4];
+	glm::mortonEncode(Special, SpecialKeys, 4, Min, Max);
+	Error += SpecialKeys[0] == 0 ? 0 : 1;
+	Error += SpecialKeys[1] == glm::mortonEncode(glm::u16vec3(0, 1023, 0)) ? 0 : 1;
+	Error += SpecialKeys[2] == 0x3FFFFFFF ? 0 : 1;
+	Error += SpecialKeys[3] == 0 ? 0 : 1;
+
+	glm::mortonEncode(Special, SpecialKeys, 4, Min, glm::vec3(Max.x, Min.y, Max.z));
+	Error += SpecialKeys[2] == glm::mortonEncode(glm::u16vec3(1023, 0, 1023)) ? 0 : 1;
+
+	// Doubles use the scalar code
+	std::vector<glm::dvec3> PositionsDouble(Positions.begin(), Positions.begin() + 100);
+	std::vector<glm::uint32> KeysDouble(100);
+	glm::mortonEncode(&PositionsDouble[0], &KeysDouble[0], 100, glm::dvec3(Min), glm::dvec3(Max));
+	for(std::size_t i = 0; i < 100; ++i)
+	{
+		glm::u16vec3 const Cell = glm::mortonDecode3(KeysDouble[i]);
+		glm::u16vec3 const CellFloat = glm::mortonDecode3(Keys32[i]);
+		for(glm::length_t c = 0; c < 3; ++c)
+			Error += glm::abs(int(Cell[c]) - int(CellFloat[c])) <= 1 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_morton()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 20);
+	std::vector<glm::vec3> const Positions(make_positions(Count));
+	glm::vec3 const Min(-100.0f, -30.0f, -10.0f);
+	glm::vec3 const Max(100.0f, 70.0f, 10.0f);
+	glm::vec3 const Scale(float(1 << 21) / (Max - Min));
+
+	std::vector<glm::u32vec3> Cells(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Cells[i] = glm::u32vec3(glm::min((Positions[i] - Min) * Scale, glm::vec3(float((1 << 21) - 1))));
+
+	std::vector<glm::uint64> Keys(Count), KeysInterleave(Count);
+	std::vector<glm::uint32> Keys32(Count);
+
+	std::clock_t const TimeInterleaveStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		KeysInterleave[i] = glm::bitfieldInterleave(Cells[i].x, Cells[i].y, Cells[i].z);
+	std::clock_t const TimeInterleaveEnd = std::clock();
+
+	std::clock_t const TimeEncodeStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Keys[i] = glm::mortonEncode(Cells[i]);
+	std::clock_t const TimeEncodeEnd = std::clock();
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Keys[i] == KeysInterleave[i] ? 0 : 1;
+
+	std::clock_t const TimeDecodeStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Cells[i] = glm::mortonDecode3(Keys[i]);
+	std::clock_t const TimeDecodeEnd = std::clock();
+
+	std::clock_t const TimeArray32Start = std::clock();
+	glm::mortonEncode(&Positions[0], &Keys32[0], Count, Min, Max);
+	std::clock_t const TimeArray32End = std::clock();
+
+	std::clock_t const TimeArray64Start = std::clock();
+	glm::mortonEncode(&Positions[0], &Keys[0], Count, Min, Max);
+	std::clock_t const TimeArray64End = std::clock();
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::mortonEncode(Cells[i]) == Keys[i] ? 0 : 1;
+
+	printf("bitfieldInterleave 3D: %ld clocks\n", static_cast<long>(TimeInterleaveEnd - TimeInterleaveStart));
+	printf("mortonEncode 3D: %ld clocks\n", static_cast<long>(TimeEncodeEnd - TimeEncodeStart));
+	printf("mortonDecode3: %ld clocks\n", static_cast<long>(TimeDecodeEnd - TimeDecodeStart));
+	printf("mortonEncode vec3 array, 32 bits keys: %ld clocks\n", static_cast<long>(TimeArray32End - TimeArray32Start));
+	printf("mortonEncode vec3 array, 64 bits keys: %ld clocks\n", static_cast<long>(TimeArray64End - TimeArray64Start));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_encode();
+	Error += test_decode();
+	Error += test_array();
+	Error += perf_morton();
+
+	return Error;
+}
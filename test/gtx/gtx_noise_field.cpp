@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_noise_field.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/noise_field.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+#if GLM_HAS_OPENMP
+#	include <omp.h>
+#endif
+
+namespace
+{
+	// Octaves of glm::simplex accumulated one sample at a time
+	template <typename vecType>
+	typename vecType::value_type reference(vecType const & Position, int Octaves, int Fractal)
+	{
+		typedef typename vecType::value_type T;
+
+		T Sum(0), Norm(0), Amplitude(1), Frequency(1);
+		for(int o = 0; o < Octaves; ++o, Amplitude *= T(0.5), Frequency *= T(2))
+		{
+			T const Noise = glm::simplex(Position * Frequency);
+			T const Value = Fractal == 0 ? Noise : Fractal == 1 ? (T(1) - glm::abs(Noise)) * (T(1) - glm::abs(Noise)) : glm::abs(Noise);
+			Sum += Amplitude * Value;
+			Norm += Amplitude;
+		}
+		return Sum / Norm;
+	}
+
+	template <typename vecType, typename ivecType>
+	void field(int Fractal, typename vecType::value_type * Out, vecType const & Origin, vecType const & Step, ivecType const & Dims, int Octaves)
+	{
+		if(Fractal == 0)
+			glm::fbm(Out, Origin, Step, Dims, Octaves);
+		else if(Fractal == 1)
+			glm::ridged(Out, Origin, Step, Dims, Octaves);
+		else
+			glm::turbulence(Out, Origin, Step, Dims, Octaves);
+	}
+}//namespace
+
+template <typename vecType, typename ivecType>
+int test_field(ivecType const & Dims, int Octaves)
+{
+	typedef typename vecType::value_type T;
+	int Error(0);
+
+	std::size_t Size = 1;
+	for(glm::length_t c = 0; c < Dims.length(); ++c)
+		Size *= static_cast<std::size_t>(Dims[c]);
+
+	vecType const Origin(T(-1.3));
+	vecType const Step(T(0.07));
+
+	for(int Fractal = 0; Fractal < 3; ++Fractal)
+	{
+		std::vector<T> Out(Size + 1, T(42));
+		field(Fractal, &Out[0], Origin, Step, Dims, Octaves);
+
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			vecType Position;
+			std::size_t Index = i;
+			for(glm::length_t c = 0; c < Dims.length(); ++c)
+			{
+				Position[c] = Origin[c] + Step[c] * static_cast<T>(Index % static_cast<std::size_t>(Dims[c]));
+				Index /= static_cast<std::size_t>(Dims[c]);
+			}
+
+			Error += glm::epsilonEqual(Out[i], reference(Position, Octaves, Fractal), T(0.0001)) ? 0 : 1;
+			Error += Out[i] >= (Fractal == 0 ? T(-1) : T(0)) && Out[i] <= T(1) ? 0 : 1;
+		}
+
+		// Nothing is written past the end of the field
+		Error += Out[Size] == T(42) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_single_octave()
+{
+	int Error(0);
+
+	// One octave of fBm is the simplex noise
+	glm::ivec2 const Dims(37, 21);
+	std::vector<float> Field(37 * 21), Grid(37 * 21);
+	glm::fbm(&Field[0], glm::vec2(0.25f), glm::vec2(0.1f), Dims, 1);
+	glm::simplex(&Grid[0], glm::vec2(0.25f), glm::vec2(0.1f), Dims);
+
+	for(std::size_t i = 0; i < Field.size(); ++i)
+		Error += Field[i] == Grid[i] ? 0 : 1;
+
+	// Empty fields
+	float Out = 42.0f;
+	glm::fbm(&Out, glm::vec2(0.0f), glm::vec2(1.0f), glm::ivec2(0, 5), 4);
+	glm::ridged(&Out, glm::vec3(0.0f), glm::vec3(1.0f), glm::ivec3(5, 5, 0), 4);
+	Error += Out == 42.0f ? 0 : 1;
+
+	return Error;
+}
+
+int test_determinism()
+{
+	int Error(0);
+
+	glm::ivec3 const Dims(150, 40, 3);
+	std::size_t const Size = 150 * 40 * 3;
+
+	std::vector<float> A(Size), B(Size);
+#	if GLM_HAS_OPENMP
+		int const Threads = omp_get_max_threads();
+		omp_set_num_threads(1);
+#	endif
+	glm::fbm(&A[0], glm::vec3(0.1f), glm::vec3(0.03f), Dims, 6);
+#	if GLM_HAS_OPENMP
+		omp_set_num_threads(Threads > 1 ? Threads : 4);
+#	endif
+	glm::fbm(&B[0], glm::vec3(0.1f), glm::vec3(0.03f), Dims, 6);
+#	if GLM_HAS_OPENMP
+		omp_set_num_threads(Threads);
+#	endif
+
+	for(std::size_t i = 0; i < Size; ++i)
+		Error += A[i] == B[i] ? 0 : 1;
+
+	return Error;
+}
+
+int perf_field()
+{
+	int Error(0);
+
+	int const Size = 512;
+	int const Octaves = 8;
+	std::size_t const Count = static_cast<std::size_t>(Size) * static_cast<std::size_t>(Size);
+	glm::vec2 const Origin(0.5f);
+	glm::vec2 const Step(1.0f / 64.0f);
+
+	std::vector<float> Loop(Count, 0.0f);
+	std::clock_t TimeLoopStart = std::clock();
+	{
+		float Amplitude = 1.0f, Frequency = 1.0f, Norm = 0.0f;
+		for(int o = 0; o < Octaves; ++o, Amplitude *= 0.5f, Frequency *= 2.0f)
+		{
+			for(int y = 0; y < Size; ++y)
+			for(int x = 0; x < Size; ++x)
+				Loop[x + y * Size] += Amplitude * glm::simplex((Origin + Step * glm::vec2(x, y)) * Frequency);
+			Norm += Amplitude;
+		}
+		for(std::size_t i = 0; i < Count; ++i)
+			Loop[i] /= Norm;
+	}
+	std::clock_t TimeLoopEnd = std::clock();
+
+	std::vector<float> Field(Count);
+	std::clock_t TimeFieldStart = std::clock();
+	glm::fbm(&Field[0], Origin, Step, glm::ivec2(Size), Octaves);
+	std::clock_t TimeFieldEnd = std::clock();
+
+	for(std::size_t i = 0; i < Count; i += 101)
+		Error += glm::epsilonEqual(Loop[i], Field[i], 0.0001f) ? 0 : 1;
+
+	// std::clock measures the time of all threads
+	double const Scale = 1e9 / double(CLOCKS_PER_SEC) / double(Count);
+	printf("fbm nested loops: %f ns/sample\n", double(TimeLoopEnd - TimeLoopStart) * Scale);
+	printf("fbm field: %f ns/sample\n", double(TimeFieldEnd - TimeFieldStart) * Scale);
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_field<glm::vec2>(glm::ivec2(133, 35), 5);
+	Error += test_field<glm::vec3>(glm::ivec3(70, 17, 3), 3);
+	Error += test_field<glm::dvec2>(glm::ivec2(9, 4), 4);
+	Error += test_single_octave();
+	Error += test_determinism();
+	Error += perf_field();
+
+	return Error;
+}
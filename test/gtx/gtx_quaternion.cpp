@@ -13,6 +13,9 @@
 #include <glm/gtx/transform.hpp>
 #include <glm/gtx/quaternion.hpp>
 #include <glm/ext.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
 
 int test_quat_fastMix()
 {
@@ -31,6 +34,86 @@ int test_quat_fastMix()
 	return Error;
 }
 
+// Angle of the rotation between two rotations
+template <typename T>
+double rotation_distance(glm::detail::tquat<T, glm::defaultp> const & a, glm::detail::tquat<T, glm::defaultp> const & b)
+{
+	glm::dquat const Delta = glm::conjugate(glm::dquat(a.w, a.x, a.y, a.z)) * glm::dquat(b.w, b.x, b.y, b.z);
+	return 2.0 * std::atan2(glm::length(glm::dvec3(Delta.x, Delta.y, Delta.z)), glm::abs(Delta.w));
+}
+
+// Measure the error against slerp over every angle between the two rotations, including opposite rotations
+template <typename T>
+int test_quat_fastSlerp()
+{
+	typedef glm::detail::tquat<T, glm::defaultp> quatType;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	double MaxErrorSlerp(0), MaxErrorMix(0);
+	for(int i = 0; i <= 1000; ++i)
+	{
+		T const Angle = glm::pi<T>() * static_cast<T>(i) / static_cast<T>(1000);
+		quatType const A = glm::angleAxis(static_cast<T>(i) * static_cast<T>(0.1), glm::normalize(vec3Type(1, 2, static_cast<T>(i % 7))));
+		quatType const Rotation = glm::angleAxis(Angle, glm::normalize(vec3Type(static_cast<T>(i % 3), -1, 1)));
+		// Go through both signs of the dot product
+		quatType const B = i & 1 ? -(A * Rotation) : A * Rotation;
+
+		for(int j = 0; j <= 64; ++j)
+		{
+			T const a = static_cast<T>(j) / static_cast<T>(64);
+			quatType const Exact = glm::slerp(A, B, a);
+			MaxErrorSlerp = glm::max(MaxErrorSlerp, rotation_distance(glm::fastSlerp(A, B, a), Exact));
+			MaxErrorMix = glm::max(MaxErrorMix, rotation_distance(glm::fastMix(A, B * glm::sign(glm::dot(A, B)), a), Exact));
+		}
+	}
+
+	Error += MaxErrorSlerp < 6e-5 ? 0 : 1;
+	Error += MaxErrorMix < 0.15 ? 0 : 1;
+
+	printf("fastSlerp max error: %g radians\n", MaxErrorSlerp);
+	printf("fastMix max error: %g radians\n", MaxErrorMix);
+
+	return Error;
+}
+
+int perf_quat_fastSlerp()
+{
+	int Error(0);
+
+	std::size_t const Count = 1 << 20;
+	std::vector<glm::quat> A(Count), B(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = glm::angleAxis(static_cast<float>(i % 1000) * 0.01f, glm::vec3(0, 0, 1));
+		B[i] = glm::angleAxis(static_cast<float>(i % 997) * -0.003f, glm::vec3(0, 1, 0));
+	}
+
+	std::clock_t TimeSlerpStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::slerp(A[i], B[i], 0.3f);
+	std::clock_t TimeSlerpEnd = std::clock();
+
+	std::clock_t TimeFastSlerpStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastSlerp(A[i], B[i], 0.3f);
+	std::clock_t TimeFastSlerpEnd = std::clock();
+
+	std::clock_t TimeFastMixStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastMix(A[i], B[i], 0.3f);
+	std::clock_t TimeFastMixEnd = std::clock();
+
+	Error += glm::epsilonEqual(glm::length(Out[Count - 1]), 1.0f, 0.001f) ? 0 : 1;
+
+	printf("slerp: %ld clocks\n", static_cast<long>(TimeSlerpEnd - TimeSlerpStart));
+	printf("fastSlerp: %ld clocks\n", static_cast<long>(TimeFastSlerpEnd - TimeFastSlerpStart));
+	printf("fastMix: %ld clocks\n", static_cast<long>(TimeFastMixEnd - TimeFastMixStart));
+
+	return Error;
+}
+
 int test_quat_shortMix()
 {
 	int Error(0);
@@ -105,6 +188,9 @@ int main()
 	Error += test_rotation();
 	Error += test_quat_fastMix();
 	Error += test_quat_shortMix();
+	Error += test_quat_fastSlerp<float>();
+	Error += test_quat_fastSlerp<double>();
+	Error += perf_quat_fastSlerp();
 
 	return Error;
 }
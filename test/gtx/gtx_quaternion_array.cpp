@@ -0,0 +1,269 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_quaternion_array.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/quaternion_array.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	template <typename T>
+	glm::detail::tquat<T, glm::defaultp> make_quat(std::size_t i)
+	{
+		glm::detail::tvec3<T, glm::defaultp> const Axis = glm::normalize(glm::detail::tvec3<T, glm::defaultp>(
+			static_cast<T>(std::sin(double(i) * 1.3) + 0.1),
+			static_cast<T>(std::cos(double(i) * 0.7)),
+			static_cast<T>(std::sin(double(i) * 2.9 + 1.0))));
+		return glm::angleAxis(static_cast<T>(double(i) * 0.37), Axis);
+	}
+
+	template <typename T>
+	bool quat_equal(glm::detail::tquat<T, glm::defaultp> const & a, glm::detail::tquat<T, glm::defaultp> const & b, T Epsilon)
+	{
+		return glm::all(glm::epsilonEqual(glm::detail::tvec4<T, glm::defaultp>(a.x, a.y, a.z, a.w), glm::detail::tvec4<T, glm::defaultp>(b.x, b.y, b.z, b.w), Epsilon));
+	}
+}//namespace
+
+template <typename T>
+int test_multiply_rotate()
+{
+	typedef glm::detail::tquat<T, glm::defaultp> quatType;
+	typedef glm::detail::tvec3<T, glm::defaultp> vec3Type;
+
+	int Error(0);
+
+	// Cover the tails of the blocks
+	for(std::size_t Count = 0; Count < 21; ++Count)
+	{
+		std::vector<quatType> A(Count + 1), B(Count + 1), Out(Count + 1, quatType(42, 42, 42, 42));
+		std::vector<vec3Type> V(Count + 1), OutV(Count + 1, vec3Type(42));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = make_quat<T>(i);
+			B[i] = make_quat<T>(i * 3 + 1);
+			V[i] = vec3Type(T(i), T(1) - T(i), T(2));
+		}
+
+		glm::multiply(&A[0], &B[0], &Out[0], Count);
+		glm::rotate(&A[0], &V[0], &OutV[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += quat_equal(Out[i], A[i] * B[i], T(1e-6)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(OutV[i], A[i] * V[i], T(1e-4))) ? 0 : 1;
+		}
+		Error += Out[Count] == quatType(42, 42, 42, 42) ? 0 : 1;
+		Error += OutV[Count] == vec3Type(42) ? 0 : 1;
+	}
+
+	// The output may alias the inputs
+	{
+		std::vector<quatType> A(13), B(13), Expected(13);
+		for(std::size_t i = 0; i < A.size(); ++i)
+		{
+			A[i] = make_quat<T>(i);
+			B[i] = make_quat<T>(i + 5);
+			Expected[i] = A[i] * B[i];
+		}
+		glm::multiply(&A[0], &B[0], &A[0], A.size());
+		for(std::size_t i = 0; i < A.size(); ++i)
+			Error += quat_equal(A[i], Expected[i], T(1e-6)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_slerp()
+{
+	typedef glm::detail::tquat<T, glm::defaultp> quatType;
+
+	int Error(0);
+
+	for(std::size_t Count = 0; Count < 21; ++Count)
+	{
+		std::vector<quatType> A(Count + 1), B(Count + 1), Out(Count + 1, quatType(42, 42, 42, 42));
+		std::vector<T> Alpha(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = make_quat<T>(i);
+			B[i] = make_quat<T>(i * 7 + 2);
+			Alpha[i] = T(i % 5) / T(4);
+		}
+
+		glm::slerp(&A[0], &B[0], &Alpha[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += quat_equal(Out[i], glm::slerp(A[i], B[i], Alpha[i]), T(2e-6)) ? 0 : 1;
+		Error += Out[Count] == quatType(42, 42, 42, 42) ? 0 : 1;
+
+		std::vector<quatType> Fast(Count + 1, quatType(42, 42, 42, 42));
+		glm::fastSlerp(&A[0], &B[0], &Alpha[0], &Fast[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += quat_equal(Fast[i], glm::fastSlerp(A[i], B[i], Alpha[i]), T(2e-6)) ? 0 : 1;
+		Error += Fast[Count] == quatType(42, 42, 42, 42) ? 0 : 1;
+	}
+
+	// Negative dot products, nearly equal and opposite quaternions
+	{
+		std::vector<quatType> A, B;
+		std::vector<T> Alpha;
+		for(std::size_t i = 0; i < 8; ++i)
+		{
+			quatType const Q = make_quat<T>(i + 1);
+			A.push_back(Q);
+			B.push_back(-make_quat<T>(i + 2));
+			A.push_back(Q);
+			B.push_back(Q);
+			A.push_back(Q);
+			B.push_back(-Q);
+			A.push_back(Q);
+			B.push_back(glm::normalize(Q * glm::angleAxis(T(1e-4), glm::detail::tvec3<T, glm::defaultp>(0, 0, 1))));
+			for(std::size_t j = 0; j < 4; ++j)
+				Alpha.push_back(T(i) / T(7));
+		}
+
+		std::vector<quatType> Out(A.size());
+		glm::slerp(&A[0], &B[0], &Alpha[0], &Out[0], A.size());
+		for(std::size_t i = 0; i < A.size(); ++i)
+			Error += quat_equal(Out[i], glm::slerp(A[i], B[i], Alpha[i]), T(2e-6)) ? 0 : 1;
+
+		glm::fastSlerp(&A[0], &B[0], &Alpha[0], &Out[0], A.size());
+		for(std::size_t i = 0; i < A.size(); ++i)
+			Error += quat_equal(Out[i], glm::fastSlerp(A[i], B[i], Alpha[i]), T(2e-6)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_mat4_cast()
+{
+	typedef glm::detail::tquat<T, glm::defaultp> quatType;
+	typedef glm::detail::tmat4x4<T, glm::defaultp> mat4Type;
+
+	int Error(0);
+
+	for(std::size_t Count = 0; Count < 21; ++Count)
+	{
+		std::vector<quatType> Q(Count + 1);
+		std::vector<mat4Type> Out(Count + 1, mat4Type(42));
+		for(std::size_t i = 0; i < Count; ++i)
+			Q[i] = make_quat<T>(i);
+
+		glm::mat4_cast(&Q[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			mat4Type const Expected = glm::mat4_cast(Q[i]);
+			for(glm::length_t c = 0; c < 4; ++c)
+				Error += glm::all(glm::epsilonEqual(Out[i][c], Expected[c], T(1e-6))) ? 0 : 1;
+		}
+		Error += Out[Count] == mat4Type(42) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_quaternion_array()
+{
+	int Error(0);
+
+	std::size_t const Count = 1 << 20;
+	std::vector<glm::quat> A(Count), B(Count), Out(Count);
+	std::vector<glm::vec3> V(Count), OutV(Count);
+	std::vector<glm::mat4> OutM(Count);
+	std::vector<float> Alpha(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = make_quat<float>(i);
+		B[i] = make_quat<float>(i + 1);
+		V[i] = glm::vec3(float(i % 17), 1.0f, -2.0f);
+		Alpha[i] = float(i % 101) / 100.0f;
+	}
+
+	std::clock_t TimeMulLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = A[i] * B[i];
+	std::clock_t TimeMulLoopEnd = std::clock();
+
+	std::clock_t TimeMulArrayStart = std::clock();
+	glm::multiply(&A[0], &B[0], &Out[0], Count);
+	std::clock_t TimeMulArrayEnd = std::clock();
+
+	std::clock_t TimeRotateLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutV[i] = A[i] * V[i];
+	std::clock_t TimeRotateLoopEnd = std::clock();
+
+	std::clock_t TimeRotateArrayStart = std::clock();
+	glm::rotate(&A[0], &V[0], &OutV[0], Count);
+	std::clock_t TimeRotateArrayEnd = std::clock();
+
+	std::clock_t TimeSlerpLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::slerp(A[i], B[i], Alpha[i]);
+	std::clock_t TimeSlerpLoopEnd = std::clock();
+
+	std::clock_t TimeSlerpArrayStart = std::clock();
+	glm::slerp(&A[0], &B[0], &Alpha[0], &Out[0], Count);
+	std::clock_t TimeSlerpArrayEnd = std::clock();
+
+	std::clock_t TimeFastSlerpLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::fastSlerp(A[i], B[i], Alpha[i]);
+	std::clock_t TimeFastSlerpLoopEnd = std::clock();
+
+	std::clock_t TimeFastSlerpArrayStart = std::clock();
+	glm::fastSlerp(&A[0], &B[0], &Alpha[0], &Out[0], Count);
+	std::clock_t TimeFastSlerpArrayEnd = std::clock();
+
+	std::clock_t TimeCastLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		OutM[i] = glm::mat4_cast(A[i]);
+	std::clock_t TimeCastLoopEnd = std::clock();
+
+	std::clock_t TimeCastArrayStart = std::clock();
+	glm::mat4_cast(&A[0], &OutM[0], Count);
+	std::clock_t TimeCastArrayEnd = std::clock();
+
+	Error += glm::epsilonEqual(glm::length(Out[Count - 1]), 1.0f, 0.001f) ? 0 : 1;
+	Error += OutM[Count - 1][3] == glm::vec4(0, 0, 0, 1) ? 0 : 1;
+
+	printf("multiply loop: %ld clocks\n", static_cast<long>(TimeMulLoopEnd - TimeMulLoopStart));
+	printf("multiply array: %ld clocks\n", static_cast<long>(TimeMulArrayEnd - TimeMulArrayStart));
+	printf("rotate loop: %ld clocks\n", static_cast<long>(TimeRotateLoopEnd - TimeRotateLoopStart));
+	printf("rotate array: %ld clocks\n", static_cast<long>(TimeRotateArrayEnd - TimeRotateArrayStart));
+	printf("slerp loop: %ld clocks\n", static_cast<long>(TimeSlerpLoopEnd - TimeSlerpLoopStart));
+	printf("slerp array: %ld clocks\n", static_cast<long>(TimeSlerpArrayEnd - TimeSlerpArrayStart));
+	printf("fastSlerp loop: %ld clocks\n", static_cast<long>(TimeFastSlerpLoopEnd - TimeFastSlerpLoopStart));
+	printf("fastSlerp array: %ld clocks\n", static_cast<long>(TimeFastSlerpArrayEnd - TimeFastSlerpArrayStart));
+	printf("mat4_cast loop: %ld clocks\n", static_cast<long>(TimeCastLoopEnd - TimeCastLoopStart));
+	printf("mat4_cast array: %ld clocks\n", static_cast<long>(TimeCastArrayEnd - TimeCastArrayStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_multiply_rotate<float>();
+	Error += test_multiply_rotate<double>();
+	Error += test_slerp<float>();
+	Error += test_slerp<double>();
+	Error += test_mat4_cast<float>();
+	Error += perf_quaternion_array();
+
+	return Error;
+}
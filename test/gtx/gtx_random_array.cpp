@@ -0,0 +1,259 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_random_array.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/random_array.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+int test_engine()
+{
+	int Error(0);
+
+	// Each lane is a xoshiro128+ stream
+	{
+		glm::xoshiro128plus_x8 A(3), B(3);
+		glm::uint32 Values[8];
+		A.generate(Values);
+		for(std::size_t i = 0; i < 8; ++i)
+			Error += Values[i] == B() ? 0 : 1;
+
+		glm::uint32 Or = 0;
+		for(std::size_t i = 0; i < 1000; ++i)
+		{
+			A.generate(Values);
+			for(std::size_t j = 0; j < 8; ++j)
+				Or |= Values[j];
+		}
+		Error += Or == 0xFFFFFFFF ? 0 : 1;
+	}
+
+	// The engine works with the single value functions too
+	{
+		glm::xoshiro128plus_x8 Engine(1);
+		float const Value = glm::linearRand(2.0f, 3.0f, Engine);
+		Error += Value >= 2.0f && Value <= 3.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename engineType>
+int test_linearRand(engineType & Engine)
+{
+	int Error(0);
+
+	// Cover the tails of the blocks
+	for(std::size_t Count = 0; Count < 150; Count += 7)
+	{
+		std::vector<float> Out(Count + 1, 42.0f);
+		glm::linearRand(Count ? &Out[0] : 0, Count, -2.0f, 3.0f, Engine);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Out[i] >= -2.0f && Out[i] <= 3.0f ? 0 : 1;
+		Error += Out[Count] == 42.0f ? 0 : 1;
+	}
+
+	{
+		std::size_t const Count = 100000;
+		std::vector<glm::vec3> Out(Count);
+		glm::linearRand(&Out[0], Count, glm::vec3(-1, 0, 10), glm::vec3(1, 2, 20), Engine);
+
+		glm::dvec3 Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::greaterThanEqual(Out[i], glm::vec3(-1, 0, 10))) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(Out[i], glm::vec3(1, 2, 20))) ? 0 : 1;
+			Sum += glm::dvec3(Out[i]);
+		}
+		Error += glm::all(glm::epsilonEqual(Sum / double(Count), glm::dvec3(0, 1, 15), 0.05)) ? 0 : 1;
+	}
+
+	{
+		std::vector<double> Out(1000);
+		glm::linearRand(&Out[0], Out.size(), 1.0, 2.0, Engine);
+		for(std::size_t i = 0; i < Out.size(); ++i)
+			Error += Out[i] >= 1.0 && Out[i] <= 2.0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename engineType>
+int test_gaussRand(engineType & Engine)
+{
+	int Error(0);
+
+	std::size_t const Count = 100001;
+
+	{
+		std::vector<float> Out(Count);
+		glm::gaussRand(&Out[0], Count, 3.0f, 2.0f, Engine);
+
+		double Sum = 0.0, SumSquare = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sum += Out[i];
+			SumSquare += double(Out[i]) * double(Out[i]);
+		}
+		double const Mean = Sum / double(Count);
+		double const Variance = SumSquare / double(Count) - Mean * Mean;
+		Error += glm::epsilonEqual(Mean, 3.0, 0.05) ? 0 : 1;
+		Error += glm::epsilonEqual(Variance, 4.0, 0.1) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::dvec2> Out(Count);
+		glm::gaussRand(&Out[0], Count, glm::dvec2(-1, 1), glm::dvec2(1, 0.5), Engine);
+
+		glm::dvec2 Sum(0), SumSquare(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sum += Out[i];
+			SumSquare += Out[i] * Out[i];
+		}
+		glm::dvec2 const Mean = Sum / double(Count);
+		glm::dvec2 const Variance = SumSquare / double(Count) - Mean * Mean;
+		Error += glm::all(glm::epsilonEqual(Mean, glm::dvec2(-1, 1), 0.05)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Variance, glm::dvec2(1, 0.25), 0.05)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename engineType>
+int test_geometric(engineType & Engine)
+{
+	int Error(0);
+
+	std::size_t const Count = 100000;
+
+	{
+		std::vector<glm::vec2> Out(Count);
+		glm::circularRand(&Out[0], Count, 2.0f, Engine);
+
+		glm::dvec2 Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(Out[i]), 2.0f, 0.0001f) ? 0 : 1;
+			Sum += glm::dvec2(Out[i]);
+		}
+		Error += glm::all(glm::epsilonEqual(Sum / double(Count), glm::dvec2(0), 0.05)) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::vec3> Out(Count);
+		glm::sphericalRand(&Out[0], Count, 3.0f, Engine);
+
+		glm::dvec3 Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(Out[i]), 3.0f, 0.0001f) ? 0 : 1;
+			Sum += glm::dvec3(Out[i]);
+		}
+		Error += glm::all(glm::epsilonEqual(Sum / double(Count), glm::dvec3(0), 0.05)) ? 0 : 1;
+	}
+
+	// The mean distance to the center is 2/3 of the radius in a disk and 3/4 in a ball
+	{
+		std::vector<glm::vec2> Out(Count);
+		glm::diskRand(&Out[0], Count, 2.0f, Engine);
+
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::length(Out[i]) <= 2.0001f ? 0 : 1;
+			Sum += glm::length(Out[i]);
+		}
+		Error += glm::epsilonEqual(Sum / double(Count), 4.0 / 3.0, 0.01) ? 0 : 1;
+	}
+
+	{
+		std::vector<glm::dvec3> Out(Count);
+		glm::ballRand(&Out[0], Count, 2.0, Engine);
+
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::length(Out[i]) <= 2.0001 ? 0 : 1;
+			Sum += glm::length(Out[i]);
+		}
+		Error += glm::epsilonEqual(Sum / double(Count), 1.5, 0.01) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_random()
+{
+	int Error(0);
+
+	std::size_t const Count = 1 << 22;
+	std::vector<glm::vec3> Out(Count);
+
+	glm::xoshiro128plus Engine(1);
+	std::clock_t TimeScalarStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::ballRand(1.0f, Engine);
+	std::clock_t TimeScalarEnd = std::clock();
+
+	glm::xoshiro128plus_x8 Engine8(1);
+	std::clock_t TimeArrayStart = std::clock();
+	glm::ballRand(&Out[0], Count, 1.0f, Engine8);
+	std::clock_t TimeArrayEnd = std::clock();
+
+	Error += glm::length(Out[Count - 1]) <= 1.0001f ? 0 : 1;
+
+	std::clock_t TimeScalarSphereStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::sphericalRand(1.0f, Engine);
+	std::clock_t TimeScalarSphereEnd = std::clock();
+
+	std::clock_t TimeArraySphereStart = std::clock();
+	glm::sphericalRand(&Out[0], Count, 1.0f, Engine8);
+	std::clock_t TimeArraySphereEnd = std::clock();
+
+	std::vector<float> Values(Count);
+	std::clock_t TimeScalarLinearStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = glm::linearRand(0.0f, 1.0f, Engine);
+	std::clock_t TimeScalarLinearEnd = std::clock();
+
+	std::clock_t TimeArrayLinearStart = std::clock();
+	glm::linearRand(&Values[0], Count, 0.0f, 1.0f, Engine8);
+	std::clock_t TimeArrayLinearEnd = std::clock();
+
+	printf("ballRand loop: %ld clocks\n", static_cast<long>(TimeScalarEnd - TimeScalarStart));
+	printf("ballRand array: %ld clocks\n", static_cast<long>(TimeArrayEnd - TimeArrayStart));
+	printf("sphericalRand loop: %ld clocks\n", static_cast<long>(TimeScalarSphereEnd - TimeScalarSphereStart));
+	printf("sphericalRand array: %ld clocks\n", static_cast<long>(TimeArraySphereEnd - TimeArraySphereStart));
+	printf("linearRand loop: %ld clocks\n", static_cast<long>(TimeScalarLinearEnd - TimeScalarLinearStart));
+	printf("linearRand array: %ld clocks\n", static_cast<long>(TimeArrayLinearEnd - TimeArrayLinearStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	glm::xoshiro128plus_x8 Engine8(42);
+	glm::pcg32 Engine(42);
+
+	Error += test_engine();
+	Error += test_linearRand(Engine8);
+	Error += test_linearRand(Engine);
+	Error += test_gaussRand(Engine8);
+	Error += test_gaussRand(Engine);
+	Error += test_geometric(Engine8);
+	Error += test_geometric(Engine);
+	Error += perf_random();
+
+	return Error;
+}
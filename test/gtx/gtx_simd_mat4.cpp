@@ -11,6 +11,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/random.hpp>
+#include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/simd_vec4.hpp>
 #include <glm/gtx/simd_mat4.hpp>
 #include <iostream>
@@ -190,6 +191,103 @@ void test_mulD(std::vector<glm::mat4> const & Data, std::vector<glm::mat4> & Out
 	printf("Mul D: %ld\n", TimeEnd - TimeStart);
 }
 
+bool equalMat4(glm::mat4 const & a, glm::mat4 const & b, float Epsilon)
+{
+	for(glm::length_t i = 0; i < a.length(); ++i)
+		if(!glm::all(glm::epsilonEqual(a[i], b[i], Epsilon)))
+			return false;
+	return true;
+}
+
+int test_operators_pure()
+{
+	int Error(0);
+
+	glm::mat4 const A(
+		glm::vec4(0.6f, 0.2f, 0.3f, 0.4f),
+		glm::vec4(0.2f, 0.7f, 0.5f, 0.3f),
+		glm::vec4(0.3f, 0.5f, 0.7f, 0.2f),
+		glm::vec4(0.4f, 0.3f, 0.2f, 0.6f));
+	glm::mat4 const B(
+		glm::vec4(1.0f, 2.0f,-3.0f, 4.0f),
+		glm::vec4(5.0f,-6.0f, 7.0f, 8.0f),
+		glm::vec4(9.0f, 1.5f, 2.5f,-3.5f),
+		glm::vec4(0.5f, 4.5f,-5.5f, 6.5f));
+	glm::simdMat4 const SimdA(A);
+	glm::simdMat4 const SimdB(B);
+
+	// Every path, SSE2 or AVX, matches the generic mat4 code
+	Error += equalMat4(glm::mat4_cast(SimdA * SimdB), A * B, 0.0001f) ? 0 : 1;
+	Error += equalMat4(glm::mat4_cast(glm::matrixCompMult(SimdA, SimdB)), glm::matrixCompMult(A, B), 0.0001f) ? 0 : 1;
+	Error += equalMat4(glm::mat4_cast(SimdB / SimdA), B * glm::inverse(A), 0.001f) ? 0 : 1;
+
+	{
+		glm::simdMat4 C(SimdA);
+		C *= SimdB;
+		Error += equalMat4(glm::mat4_cast(C), A * B, 0.0001f) ? 0 : 1;
+
+		C = SimdB;
+		C /= SimdA;
+		Error += equalMat4(glm::mat4_cast(C), B * glm::inverse(A), 0.001f) ? 0 : 1;
+
+		C = SimdA;
+		C += SimdB;
+		Error += equalMat4(glm::mat4_cast(C), A + B, 0.0001f) ? 0 : 1;
+
+		C = SimdA;
+		C -= SimdB;
+		Error += equalMat4(glm::mat4_cast(C), A - B, 0.0001f) ? 0 : 1;
+	}
+
+	{
+		std::size_t const Count = 7;
+		std::vector<glm::simdMat4> Left(Count, SimdA);
+		std::vector<glm::simdMat4> Right(Count, SimdB);
+		std::vector<glm::simdMat4> Out(Count);
+
+		glm::matrixMultiply(&Left[0], &Right[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equalMat4(glm::mat4_cast(Out[i]), A * B, 0.0001f) ? 0 : 1;
+
+		// In-place
+		glm::matrixMultiply(&Left[0], &Right[0], &Left[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equalMat4(glm::mat4_cast(Left[i]), A * B, 0.0001f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int perf_matrixMultiply(std::vector<glm::mat4> const & Data)
+{
+	int Error(0);
+
+	std::size_t const Count = Data.size();
+	std::vector<glm::simdMat4> In(Data.begin(), Data.end());
+	std::vector<glm::simdMat4> Out(Count);
+
+	std::clock_t TimeLoopStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = In[i] * In[(i + 1) % Count];
+	std::clock_t TimeLoopEnd = std::clock();
+
+	glm::mat4 const Check = glm::mat4_cast(Out[Count / 2]);
+
+	std::vector<glm::simdMat4> Shifted(In.begin() + 1, In.end());
+	Shifted.push_back(In[0]);
+
+	std::clock_t TimeBatchStart = std::clock();
+	glm::matrixMultiply(&In[0], &Shifted[0], &Out[0], Count);
+	std::clock_t TimeBatchEnd = std::clock();
+
+	Error += equalMat4(Check, glm::mat4_cast(Out[Count / 2]), 0.0001f) ? 0 : 1;
+
+	printf("simdMat4 operator* loop: %ld\n", static_cast<long>(TimeLoopEnd - TimeLoopStart));
+	printf("simdMat4 matrixMultiply: %ld\n", static_cast<long>(TimeBatchEnd - TimeBatchStart));
+
+	return Error;
+}
+
 int test_compute_glm()
 {
 	return 0;
@@ -283,6 +381,8 @@ int main()
 
 	Error += test_compute_glm();
 	Error += test_compute_gtx();
+	Error += test_operators_pure();
+	Error += perf_matrixMultiply(Data);
 	
 	float Det = glm::determinant(glm::simdMat4(1.0));
 	Error += Det == 1.0f ? 0 : 1;
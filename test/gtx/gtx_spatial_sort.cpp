@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_spatial_sort.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/spatial_sort.hpp>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	// Deterministic pseudo random integers
+	glm::uint32 random(glm::uint32 & Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed;
+	}
+
+	std::vector<glm::vec3> make_positions(std::size_t Count)
+	{
+		glm::uint32 Seed(3);
+		std::vector<glm::vec3> Positions(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = float(random(Seed) >> 8) / float(1 << 24);
+			float const y = float(random(Seed) >> 8) / float(1 << 24);
+			float const z = float(random(Seed) >> 8) / float(1 << 24);
+			Positions[i] = glm::vec3(x, y, z) * 100.0f - 50.0f;
+		}
+		return Positions;
+	}
+
+	template <typename genUType>
+	bool compare_keys(std::pair<genUType, std::size_t> const & a, std::pair<genUType, std::size_t> const & b)
+	{
+		return a.first < b.first;
+	}
+
+	// std::stable_sort gives the order of the stable radix sort
+	template <typename genUType>
+	int check_sort(std::vector<genUType> const & Keys)
+	{
+		int Error(0);
+
+		std::size_t const Count = Keys.size();
+		std::vector<std::pair<genUType, std::size_t> > Pairs(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Pairs[i] = std::make_pair(Keys[i], i);
+		std::stable_sort(Pairs.begin(), Pairs.end(), compare_keys<genUType>);
+
+		std::vector<genUType> Sorted(Keys);
+		std::vector<std::size_t> Permutation(Count + 1, 42);
+		glm::spatialSort(Count ? &Sorted[0] : static_cast<genUType*>(0), &Permutation[0], Count);
+
+		Error += Permutation[Count] == 42 ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Sorted[i] == Pairs[i].first ? 0 : 1;
+			Error += Permutation[i] == Pairs[i].second ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace
+
+int test_sort_keys()
+{
+	int Error(0);
+
+	glm::uint32 Seed(1);
+	std::size_t const Counts[] = {0, 1, 2, 17, 1000, (1 << 16) + 3, 300000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::vector<glm::uint32> Keys32(Counts[c]);
+		std::vector<glm::uint64> Keys64(Counts[c]);
+		std::vector<glm::uint32> Duplicates(Counts[c]);
+		for(std::size_t i = 0; i < Counts[c]; ++i)
+		{
+			Keys32[i] = random(Seed);
+			Keys64[i] = (glm::uint64(random(Seed)) << 32) | random(Seed);
+			// Few distinct keys sharing most digits, to test the stability and the skipped passes
+			Duplicates[i] = 0x00AB0000 | (random(Seed) >> 28);
+		}
+
+		Error += check_sort(Keys32);
+		Error += check_sort(Keys64);
+		Error += check_sort(Duplicates);
+	}
+
+	return Error;
+}
+
+int test_sort_positions()
+{
+	int Error(0);
+
+	std::size_t const Count(100000);
+	std::vector<glm::vec3> const Positions(make_positions(Count));
+	glm::vec3 const Min(-50.0f), Max(50.0f);
+
+	std::vector<glm::uint32> Keys(Count), Unsorted(Count);
+	std::vector<std::size_t> Permutation(Count);
+	glm::spatialSort(&Positions[0], &Keys[0], &Permutation[0], Count, Min, Max);
+	glm::mortonEncode(&Positions[0], &Unsorted[0], Count, Min, Max);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Keys[i] == Unsorted[Permutation[i]] ? 0 : 1;
+		Error += i == 0 || Keys[i - 1] <= Keys[i] ? 0 : 1;
+	}
+
+	// Reorder the positions and their indices in place
+	std::vector<glm::vec3> Sorted(Positions);
+	std::vector<int> Indices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Indices[i] = static_cast<int>(i);
+	glm::spatialReorder(&Permutation[0], &Sorted[0], Count);
+	glm::spatialReorder(&Permutation[0], &Indices[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Sorted[i] == Positions[Permutation[i]] ? 0 : 1;
+		Error += Indices[i] == static_cast<int>(Permutation[i]) ? 0 : 1;
+	}
+
+	// Consecutive sorted positions are closer than consecutive random positions
+	float Distance(0), SortedDistance(0);
+	for(std::size_t i = 1; i < Count; ++i)
+	{
+		Distance += glm::distance(Positions[i - 1], Positions[i]);
+		SortedDistance += glm::distance(Sorted[i - 1], Sorted[i]);
+	}
+	Error += SortedDistance * 10.0f < Distance ? 0 : 1;
+
+	// 64 bits keys
+	std::vector<glm::uint64> Keys64(Count);
+	glm::spatialSort(&Positions[0], &Keys64[0], &Permutation[0], Count, Min, Max);
+	for(std::size_t i = 1; i < Count; ++i)
+		Error += Keys64[i - 1] <= Keys64[i] ? 0 : 1;
+
+	return Error;
+}
+
+int perf_spatial_sort()
+{
+	int Error(0);
+
+	std::size_t const Count(1 << 20);
+	std::vector<glm::vec3> const Positions(make_positions(Count));
+	glm::vec3 const Min(-50.0f), Max(50.0f);
+
+	std::vector<glm::uint32> Keys(Count);
+	std::vector<std::size_t> Permutation(Count);
+	glm::mortonEncode(&Positions[0], &Keys[0], Count, Min, Max);
+
+	std::vector<std::pair<glm::uint32, std::size_t> > Pairs(Count);
+	std::clock_t const TimeStdStart = std::clock();
+	for(std::size_t i = 0; i < Count; ++i)
+		Pairs[i] = std::make_pair(Keys[i], i);
+	std::sort(Pairs.begin(), Pairs.end());
+	std::clock_t const TimeStdEnd = std::clock();
+
+	std::clock_t const TimeSortStart = std::clock();
+	glm::spatialSort(&Keys[0], &Permutation[0], Count);
+	std::clock_t const TimeSortEnd = std::clock();
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Keys[i] == Pairs[i].first ? 0 : 1;
+
+	std::vector<glm::vec3> Sorted(Positions);
+	std::clock_t const TimeReorderStart = std::clock();
+	glm::spatialReorder(&Permutation[0], &Sorted[0], Count);
+	std::clock_t const TimeReorderEnd = std::clock();
+
+	std::vector<glm::uint64> Keys64(Count);
+	std::clock_t const TimePositionsStart = std::clock();
+	glm::spatialSort(&Positions[0], &Keys64[0], &Permutation[0], Count, Min, Max);
+	std::clock_t const TimePositionsEnd = std::clock();
+
+	printf("std::sort of 32 bits keys: %ld clocks\n", static_cast<long>(TimeStdEnd - TimeStdStart));
+	printf("spatialSort of 32 bits keys: %ld clocks\n", static_cast<long>(TimeSortEnd - TimeSortStart));
+	printf("spatialReorder of vec3: %ld clocks\n", static_cast<long>(TimeReorderEnd - TimeReorderStart));
+	printf("spatialSort of vec3 with 64 bits keys: %ld clocks\n", static_cast<long>(TimePositionsEnd - TimePositionsStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_sort_keys();
+	Error += test_sort_positions();
+	Error += perf_spatial_sort();
+
+	return Error;
+}
@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2014 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2014-10-16
+// Updated : 2014-10-16
+// Licence : This source is under MIT licence
+// File    : test/gtx/gtx_transform_array.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtx/transform_array.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+
+namespace
+{
+	glm::mat4 const Transform =
+		glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f)) *
+		glm::rotate(glm::mat4(1.0f), 0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))) *
+		glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 0.5f, 1.5f));
+
+	glm::vec3 makePoint(std::size_t i)
+	{
+		float const f = static_cast<float>(i);
+		return glm::vec3(f * 0.5f - 10.0f, f * 0.25f + 1.0f, 7.0f - f * 0.125f);
+	}
+}//namespace
+
+int test_transform_vec3()
+{
+	int Error(0);
+
+	// Cover every tail length of the 4 and 8 wide loops
+	for(std::size_t Count = 0; Count < 27; ++Count)
+	{
+		std::vector<glm::vec3> In(Count + 1);
+		std::vector<glm::vec3> Out(Count + 1, glm::vec3(42.0f));
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = makePoint(i);
+
+		glm::transform(Transform, Count ? &In[0] : 0, Count ? &Out[0] : 0, Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec3 const Expected(Transform * glm::vec4(In[i], 1.0f));
+			Error += glm::all(glm::epsilonEqual(Out[i], Expected, 0.0001f)) ? 0 : 1;
+		}
+
+		// Nothing is written past the end of the array
+		Error += Out[Count] == glm::vec3(42.0f) ? 0 : 1;
+	}
+
+	// In-place and unaligned input
+	{
+		std::vector<float> Buffer(3 * 19 + 1);
+		for(std::size_t i = 0; i < Buffer.size(); ++i)
+			Buffer[i] = static_cast<float>(i) * 0.1f;
+		std::vector<float> Copy(Buffer);
+
+		glm::vec3 * Points = reinterpret_cast<glm::vec3*>(&Buffer[1]);
+		glm::transform(Transform, Points, Points, 19);
+
+		for(std::size_t i = 0; i < 19; ++i)
+		{
+			glm::vec3 const Source(Copy[1 + i * 3 + 0], Copy[1 + i * 3 + 1], Copy[1 + i * 3 + 2]);
+			glm::vec3 const Expected(Transform * glm::vec4(Source, 1.0f));
+			Error += glm::all(glm::epsilonEqual(Points[i], Expected, 0.0001f)) ? 0 : 1;
+		}
+		Error += Buffer[0] == Copy[0] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_transform_vec4()
+{
+	int Error(0);
+
+	for(std::size_t Count = 1; Count < 11; ++Count)
+	{
+		std::vector<glm::vec4> In(Count);
+		std::vector<glm::vec4> Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::vec4(makePoint(i), static_cast<float>(i % 3));
+
+		glm::transform(Transform, &In[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::epsilonEqual(Out[i], Transform * In[i], 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_transform_soa()
+{
+	int Error(0);
+
+	std::size_t const Count = 23;
+	std::vector<float> X(Count), Y(Count), Z(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Point = makePoint(i);
+		X[i] = Point.x;
+		Y[i] = Point.y;
+		Z[i] = Point.z;
+	}
+
+	std::vector<float> OutX(Count), OutY(Count), OutZ(Count);
+	glm::transform(Transform, &X[0], &Y[0], &Z[0], &OutX[0], &OutY[0], &OutZ[0], Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Expected(Transform * glm::vec4(makePoint(i), 1.0f));
+		Error += glm::all(glm::epsilonEqual(glm::vec3(OutX[i], OutY[i], OutZ[i]), Expected, 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_transform_double()
+{
+	int Error(0);
+
+	glm::dmat4 const Transform(glm::translate(glm::dmat4(1.0), glm::dvec3(1.0, 2.0, 3.0)));
+	std::vector<glm::dvec3> In(5, glm::dvec3(1.0, 1.0, 1.0));
+	std::vector<glm::dvec3> Out(5);
+	glm::transform(Transform, &In[0], &Out[0], In.size());
+
+	for(std::size_t i = 0; i < Out.size(); ++i)
+		Error += Out[i] == glm::dvec3(2.0, 3.0, 4.0) ? 0 : 1;
+
+	return Error;
+}
+
+int perf_transform()
+{
+	int Error(0);
+
+	// Small enough to stay in cache so that the arithmetic is measured rather than the memory bandwidth
+	std::size_t const Count = 1 << 12;
+	std::size_t const Iterations = 1024;
+
+	std::vector<glm::vec3> In(Count);
+	std::vector<glm::vec3> Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = makePoint(i);
+
+	std::clock_t TimeScalarStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::vec3(Transform * glm::vec4(In[i], 1.0f));
+	std::clock_t TimeScalarEnd = std::clock();
+
+	glm::vec3 const Check = Out[Count - 1];
+
+	std::clock_t TimeArrayStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::transform(Transform, &In[0], &Out[0], Count);
+	std::clock_t TimeArrayEnd = std::clock();
+
+	// The components are in the thousands and the scalar loop may be contracted into FMAs
+	Error += glm::all(glm::epsilonEqual(Check, Out[Count - 1], 0.01f)) ? 0 : 1;
+
+	std::vector<float> X(Count, 1.0f), Y(Count, 2.0f), Z(Count, 3.0f);
+	std::vector<float> OutX(Count), OutY(Count), OutZ(Count);
+	std::clock_t TimeSoAStart = std::clock();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::transform(Transform, &X[0], &Y[0], &Z[0], &OutX[0], &OutY[0], &OutZ[0], Count);
+	std::clock_t TimeSoAEnd = std::clock();
+
+	printf("transform vec3 scalar loop: %ld clocks\n", static_cast<long>(TimeScalarEnd - TimeScalarStart));
+	printf("transform vec3 array: %ld clocks\n", static_cast<long>(TimeArrayEnd - TimeArrayStart));
+	printf("transform SoA array: %ld clocks\n", static_cast<long>(TimeSoAEnd - TimeSoAStart));
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_transform_vec3();
+	Error += test_transform_vec4();
+	Error += test_transform_soa();
+	Error += test_transform_double();
+	Error += perf_transform();
+
+	return Error;
+}